@@ -0,0 +1,64 @@
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+#include "animation.h"
+#include "delta.h"
+#include "tvout.h"
+
+void animation_player_init(animation_player_t *player, const animation_t *animation,
+                           uint8_t *buffer0, uint8_t *buffer1) {
+  size_t size = animation->stride * animation->height;
+  player->animation = animation;
+  player->buffers[0] = buffer0;
+  player->buffers[1] = buffer1;
+  memset(buffer0, 0x00, size);
+  memset(buffer1, 0x00, size);
+  player->front = 0;
+  player->frame = 0;
+  player->started = 0;
+  memset(&player->stats, 0, sizeof(player->stats));
+  tvout_flip(buffer0);
+  player->shown_at = time_us_32();
+}
+
+bool animation_player_step(animation_player_t *player) {
+  const animation_t *animation = player->animation;
+  size_t size = animation->stride * animation->height;
+  uint8_t *back = player->buffers[player->front ^ 1];
+
+  // Until both buffers hold a frame, frames are decoded against black.
+  uint index = player->frame;
+  if (player->started < 2) {
+    index = animation->frame_count + player->started++;
+  }
+  uint32_t offset = animation->offsets[index];
+  uint32_t length = animation->offsets[index + 1] - offset;
+
+  uint32_t start = time_us_32();
+  delta_decoder_t decoder;
+  delta_decoder_init(&decoder, back, size);
+  bool ok = (delta_decode(&decoder, animation->data + offset, length) == length) &&
+            delta_decoder_idle(&decoder);
+  uint32_t decode_us = time_us_32() - start;
+  if (!ok) {
+    return false;
+  }
+
+  player->front ^= 1;
+  tvout_flip(back);
+  player->frame = (player->frame + 1) % animation->frame_count;
+
+  // tvout_flip() returns at the vblank before the frame is shown, one field after the previous
+  // frame's vblank if it was on time.
+  uint32_t now = time_us_32();
+  uint period = tvout_get_field_period_us();
+  if ((player->stats.frames > 0) && (now - player->shown_at > period + period / 2)) {
+    player->stats.late_frames++;
+  }
+  player->shown_at = now;
+  player->stats.frames++;
+  player->stats.decode_us += decode_us;
+  player->stats.max_decode_us = MAX(player->stats.max_decode_us, decode_us);
+  return true;
+}
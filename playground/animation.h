@@ -0,0 +1,50 @@
+#pragma once
+
+#include "pico/types.h"
+
+// Looping 1bpp animations compiled into flash by tools/animc.py (see playground_add_animation() in
+// CMakeLists.txt) and played back with double buffering at up to one frame per field.
+//
+// Frames are stored as deltas (see delta.h) in the layout of an uncompressed image_t. With double
+// buffering the back buffer holds the frame before last and so each frame is coded against that
+// frame, two back, rather than against the previous one. The back buffer is then decoded into in
+// place and the only memory written per frame is the bytes which differ. There is no copy from
+// the front buffer.
+//
+// Delta i, for 0 <= i < frame_count, codes frame i against frame i - 2, wrapping around. Deltas
+// frame_count and frame_count + 1 code frames 0 and 1 against black to start playback.
+
+typedef struct {
+  uint16_t width, height; // Size in pixels
+  uint16_t stride;        // Bytes between rows
+  bool byte_oriented;     // As for tvout_init()
+  uint frame_count;
+  const uint32_t *offsets; // Offset of each delta in data with a final entry for the end
+  const uint8_t *data;
+} animation_t;
+
+typedef struct {
+  uint32_t frames;        // Frames shown
+  uint32_t decode_us;     // Total time spent decoding
+  uint32_t max_decode_us; // Longest time spent decoding a single frame
+  uint32_t late_frames;   // Frames shown one or more fields late
+} animation_stats_t;
+
+typedef struct {
+  const animation_t *animation;
+  uint8_t *buffers[2];
+  uint front;        // Index of the buffer being shown
+  uint frame;        // Next frame
+  uint started;      // Number of the two starting deltas used so far
+  uint32_t shown_at; // Time at which the last frame was shown
+  animation_stats_t stats;
+} animation_player_t;
+
+// Start playing an animation into two frame buffers of animation->stride * animation->height bytes.
+// The buffers are cleared and the first shown.
+void animation_player_init(animation_player_t *player, const animation_t *animation,
+                           uint8_t *buffer0, uint8_t *buffer1);
+
+// Decode the next frame into the back buffer, show it from the next field and wait until the
+// previous frame is no longer being scanned out. Returns false if the animation is malformed.
+bool animation_player_step(animation_player_t *player);
@@ -0,0 +1,497 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "hardware/clocks.h"
+#include "hardware/structs/bus_ctrl.h"
+#include "hardware/structs/systick.h"
+#include "hardware/structs/xip_ctrl.h"
+#include "hardware/sync.h"
+#include "pico/stdlib.h"
+
+#include "animation.h"
+#include "console.h"
+#include "fbmem.h"
+#include "gfx.h"
+#include "glyph.h"
+#include "hotpath.h"
+#include "tvout.h"
+
+#include "demo_animation.h"
+#include "font_6x8.h"
+#include "font_8x8.h"
+
+// Benchmarks for the drawing code. Video output runs throughout so that the figures include
+// contention with the scanout DMA. Results are printed over stdio.
+
+#define GPIO_SYNC_PIN 16
+#define GPIO_VIDEO_PIN 17
+
+// Number of times each benchmark is repeated.
+#define BENCH_PASSES 8
+
+// Number of graphics primitives drawn per timed interval.
+#define BENCH_BATCH 32
+
+// Number of fields over which the video interrupt is measured.
+#define BENCH_ISR_FIELDS 50
+
+// Height of the sprites in the sprite benchmarks, enough for every mode.
+#define BENCH_SPRITE_HEIGHT 256
+
+// Pixel rows of the smooth scrolling console's ring below the screen, and the fields over which
+// text is written to it.
+#define BENCH_SCROLL_SPARE_ROWS 32
+#define BENCH_SCROLL_FIELDS 100
+
+// Source bitmap for the blit benchmarks.
+#define BENCH_BLIT_SIZE 64
+static uint32_t blit_source_buffer[BENCH_BLIT_SIZE * BENCH_BLIT_SIZE / 32];
+static gfx_surface_t blit_source;
+
+uint8_t *frame_buffer;
+uint width, height, stride;
+
+// SysTick counts processor cycles down from 0xFFFFFF. Each measured interval must be shorter than
+// 2^24 cycles, about 134ms at 125MHz.
+static void bench_init(void) {
+  systick_hw->rvr = 0xFFFFFF;
+  systick_hw->cvr = 0;
+  systick_hw->csr = 0x5; // Enable using the processor clock with no interrupt
+}
+
+static inline uint32_t bench_start(void) { return systick_hw->cvr; }
+
+static inline uint32_t bench_cycles_since(uint32_t start) {
+  return (start - systick_hw->cvr) & 0xFFFFFF;
+}
+
+// Empty the XIP cache so that the next access to anything in flash misses.
+static inline void bench_flush_xip_cache(void) {
+  xip_ctrl_hw->flush = 1;
+  (void)xip_ctrl_hw->flush; // Reading stalls until the flush is complete
+}
+
+static void bench_report(const char *name, const char *unit, uint64_t cycles, uint64_t count) {
+  printf("%-30s %8.2f cycles/%s %10lu %s/s\n", name, (double)cycles / count, unit,
+         (unsigned long)(clock_get_hz(clk_sys) * count / cycles), unit);
+}
+
+// Fill each console row with ASCII, timing only the glyphs and not the scroll. With cold set, each
+// glyph is written separately with the XIP cache flushed beforehand, as after a miss-heavy burst
+// of other work.
+static void bench_console(const char *name, const font_t *font, bool cold) {
+  console_init(font, frame_buffer, width, height, stride);
+
+  uint cols = width / font->width, rows = height / font->height;
+  char line[128];
+  for (uint i = 0; i < cols - 1; i++) {
+    line[i] = '!' + (i % 94);
+  }
+
+  uint64_t cycles = 0, glyphs = 0;
+  for (uint pass = 0; pass < BENCH_PASSES; pass++) {
+    for (uint row = 0; row < rows; row++) {
+      if (cold) {
+        for (uint i = 0; i < cols - 1; i++) {
+          bench_flush_xip_cache();
+          uint32_t start = bench_start();
+          console_putc(line[i]);
+          cycles += bench_cycles_since(start);
+        }
+      } else {
+        uint32_t start = bench_start();
+        console_write(line, cols - 1);
+        cycles += bench_cycles_since(start);
+      }
+      glyphs += cols - 1;
+      console_write("\r\n", 2);
+    }
+  }
+  bench_report(name, "glyph", cycles, glyphs);
+}
+
+static uint scroll_rows;
+
+static void bench_scroll_origin(uint row) { tvout_set_layer_origin(row, scroll_rows); }
+
+// Write burst lines to a smoothly scrolling console every interval fields, shown in a layer, and
+// report how far scrolling fell behind, the fields in which it jumped and the fields it took to
+// catch up after the last burst.
+static void bench_console_scroll(const char *name, uint burst, uint interval) {
+  scroll_rows = height + BENCH_SCROLL_SPARE_ROWS;
+  uint8_t *ring = fbmem_alloc(stride * scroll_rows);
+  console_init(&font_8x8, ring, width, scroll_rows, stride);
+  console_set_smooth_scroll(height, bench_scroll_origin);
+  tvout_set_layer(ring, TVOUT_BLEND_OR);
+  tvout_set_vblank_callback(console_refresh);
+
+  for (uint field = 0; field < BENCH_SCROLL_FIELDS; field++) {
+    tvout_wait_for_vblank();
+    if ((field % interval) == 0) {
+      for (uint i = 0; i < burst; i++) {
+        console_write("scroll\r\n", 8);
+      }
+    }
+  }
+  uint fields = 0;
+  console_scroll_stats_t stats;
+  for (console_get_scroll_stats(&stats); stats.backlog != 0; console_get_scroll_stats(&stats)) {
+    tvout_wait_for_vblank();
+    fields++;
+  }
+  printf("%-30s %8lu rows behind at most, %lu jumps, %u fields to catch up\n", name,
+         (unsigned long)stats.max_backlog, (unsigned long)stats.jumps, fields);
+
+  tvout_set_vblank_callback(NULL);
+  tvout_set_layer(NULL, TVOUT_BLEND_NONE);
+  tvout_set_layer_origin(0, 0);
+  tvout_wait_for_vblank();
+  fbmem_free(ring);
+}
+
+// Spin reading SysTick for a while and record the gaps between readings. Gaps longer than threshold
+// are time taken by interrupts and are recorded less the shortest gap, a loop iteration.
+typedef struct {
+  uint32_t min_gap, max_gap; // Gaps of at most the threshold
+  uint32_t interrupts;
+  uint64_t interrupt_cycles;
+  uint32_t max_interrupt_cycles;
+} bench_isr_stats_t;
+
+static void bench_isr_spin(bench_isr_stats_t *stats, uint32_t us, uint32_t threshold, bool cold) {
+  uint32_t end = time_us_32() + us;
+  uint32_t last = bench_start();
+  while ((int32_t)(end - time_us_32()) > 0) {
+    if (cold) {
+      bench_flush_xip_cache();
+    }
+    uint32_t now = bench_start();
+    uint32_t gap = (last - now) & 0xFFFFFF;
+    last = now;
+    if (gap <= threshold) {
+      stats->min_gap = MIN(stats->min_gap, gap);
+      stats->max_gap = MAX(stats->max_gap, gap);
+    } else {
+      uint32_t cycles = gap - stats->min_gap;
+      stats->interrupts++;
+      stats->interrupt_cycles += cycles;
+      stats->max_interrupt_cycles = MAX(stats->max_interrupt_cycles, cycles);
+    }
+  }
+}
+
+// Time the field timing interrupt, including the vblank callback, by the cycles it takes from a
+// loop. The loop is first run with interrupts disabled to find how long its iterations take. With
+// cold set the XIP cache is flushed on every iteration so that the interrupt finds nothing from
+// flash cached.
+static void bench_isr(const char *name, bool cold) {
+  bench_isr_stats_t stats = {.min_gap = UINT32_MAX};
+  uint32_t status = save_and_disable_interrupts();
+  bench_isr_spin(&stats, 2000, UINT32_MAX, cold);
+  restore_interrupts(status);
+
+  uint fields = BENCH_ISR_FIELDS;
+  bench_isr_spin(&stats, fields * tvout_get_field_period_us(), stats.max_gap, cold);
+  printf("%-30s %8.2f cycles/interrupt %8lu max, %lu interrupts/field\n", name,
+         (double)stats.interrupt_cycles / MAX(stats.interrupts, 1),
+         (unsigned long)stats.max_interrupt_cycles, (unsigned long)(stats.interrupts / fields));
+}
+
+// Time the video interrupts with count full height sprites on every line, which is the worst case
+// for the sprite engine, and count the lines which weren't built in time.
+static void bench_sprites(const char *name, uint count) {
+  static uint32_t bitmap[BENCH_SPRITE_HEIGHT];
+  static tvout_sprite_t sprites[TVOUT_SPRITES_PER_LINE];
+  for (uint i = 0; i < count_of(bitmap); i++) {
+    bitmap[i] = 0xf0f0f0f0 >> (i & 7);
+  }
+  for (uint i = 0; i < count; i++) {
+    sprites[i] = (tvout_sprite_t){
+        .x = 13 + (67 * i), .y = 0, .height = MIN(height, BENCH_SPRITE_HEIGHT), .bitmap = bitmap};
+  }
+  tvout_set_sprites(sprites, count);
+  tvout_wait_for_vblank();
+  tvout_wait_for_vblank();
+
+  tvout_line_stats_t before, after;
+  tvout_get_line_stats(&before);
+  bench_isr(name, false);
+  tvout_get_line_stats(&after);
+  printf("%-30s %8lu late lines of %lu\n", name,
+         (unsigned long)(after.late_lines - before.late_lines),
+         (unsigned long)(after.lines - before.lines));
+  tvout_set_sprites(NULL, 0);
+}
+
+// Pseudo-random numbers so that every run draws the same thing.
+static uint bench_random(uint n) {
+  static uint32_t state = 1;
+  state = state * 1664525u + 1013904223u;
+  return (state >> 8) % n;
+}
+
+// Arguments for one graphics primitive.
+typedef struct {
+  int a[4];
+} bench_gfx_args_t;
+
+typedef struct {
+  const char *name;
+  void (*generate)(const gfx_surface_t *surface, bench_gfx_args_t *args);
+  void (*draw)(const gfx_surface_t *surface, const bench_gfx_args_t *args, gfx_rop_t rop);
+} bench_gfx_t;
+
+static void bench_generate_span(const gfx_surface_t *surface, bench_gfx_args_t *args) {
+  int x0 = bench_random(surface->width), x1 = bench_random(surface->width);
+  *args = (bench_gfx_args_t){{MIN(x0, x1), MAX(x0, x1) + 1, bench_random(surface->height)}};
+}
+
+static void bench_draw_span(const gfx_surface_t *surface, const bench_gfx_args_t *args,
+                            gfx_rop_t rop) {
+  gfx_span(surface, args->a[0], args->a[1], args->a[2], GFX_PATTERN_WHITE, rop);
+}
+
+static void bench_generate_point_pair(const gfx_surface_t *surface, bench_gfx_args_t *args) {
+  *args = (bench_gfx_args_t){{bench_random(surface->width), bench_random(surface->height),
+                              bench_random(surface->width), bench_random(surface->height)}};
+}
+
+static void bench_draw_line(const gfx_surface_t *surface, const bench_gfx_args_t *args,
+                            gfx_rop_t rop) {
+  gfx_line(surface, args->a[0], args->a[1], args->a[2], args->a[3], 1, rop);
+}
+
+static void bench_generate_rect(const gfx_surface_t *surface, bench_gfx_args_t *args) {
+  *args = (bench_gfx_args_t){{bench_random(surface->width - 64), bench_random(surface->height - 64),
+                              1 + bench_random(64), 1 + bench_random(64)}};
+}
+
+static void bench_draw_fill_rect(const gfx_surface_t *surface, const bench_gfx_args_t *args,
+                                 gfx_rop_t rop) {
+  gfx_fill_rect(surface, args->a[0], args->a[1], args->a[2], args->a[3], GFX_PATTERN_WHITE, rop);
+}
+
+static void bench_generate_circle(const gfx_surface_t *surface, bench_gfx_args_t *args) {
+  int r = 4 + bench_random(60);
+  *args = (bench_gfx_args_t){{r + bench_random(surface->width - 2 * r),
+                              r + bench_random(surface->height - 2 * r), r}};
+}
+
+static void bench_draw_circle(const gfx_surface_t *surface, const bench_gfx_args_t *args,
+                              gfx_rop_t rop) {
+  gfx_circle(surface, args->a[0], args->a[1], args->a[2], 1, rop);
+}
+
+static void bench_draw_fill_circle(const gfx_surface_t *surface, const bench_gfx_args_t *args,
+                                   gfx_rop_t rop) {
+  gfx_fill_circle(surface, args->a[0], args->a[1], args->a[2], GFX_PATTERN_WHITE, rop);
+}
+
+static void bench_generate_blit(const gfx_surface_t *surface, bench_gfx_args_t *args) {
+  *args = (bench_gfx_args_t){{bench_random(surface->width - BENCH_BLIT_SIZE),
+                              bench_random(surface->height - BENCH_BLIT_SIZE)}};
+}
+
+static void bench_draw_blit(const gfx_surface_t *surface, const bench_gfx_args_t *args,
+                            gfx_rop_t rop) {
+  gfx_blit(surface, args->a[0], args->a[1], &blit_source, 0, 0, BENCH_BLIT_SIZE, BENCH_BLIT_SIZE,
+           rop);
+}
+
+static const bench_gfx_t bench_gfx_primitives[] = {
+    {"gfx_span", bench_generate_span, bench_draw_span},
+    {"gfx_line", bench_generate_point_pair, bench_draw_line},
+    {"gfx_fill_rect", bench_generate_rect, bench_draw_fill_rect},
+    {"gfx_circle", bench_generate_circle, bench_draw_circle},
+    {"gfx_fill_circle", bench_generate_circle, bench_draw_fill_circle},
+    {"gfx_blit 64x64", bench_generate_blit, bench_draw_blit},
+};
+
+// Count the set pixels in a surface.
+static uint bench_count_pixels(const gfx_surface_t *surface) {
+  const uint32_t *p = surface->buffer;
+  uint count = 0;
+  for (uint i = 0; i < (surface->stride >> 2) * surface->height; i++) {
+    count += __builtin_popcount(p[i]);
+  }
+  return count;
+}
+
+// Time batches of a primitive. The pixels drawn by each call are counted beforehand, untimed, by
+// drawing it alone into a cleared surface.
+static void bench_gfx(const gfx_surface_t *surface, const bench_gfx_t *primitive, gfx_rop_t rop) {
+  static const char *rop_names[] = {"COPY", "OR", "AND", "XOR"};
+  bench_gfx_args_t args[BENCH_BATCH];
+  uint64_t cycles = 0, pixels = 0;
+
+  for (uint pass = 0; pass < BENCH_PASSES; pass++) {
+    for (uint i = 0; i < BENCH_BATCH; i++) {
+      primitive->generate(surface, &args[i]);
+      memset(surface->buffer, 0x00, surface->stride * surface->height);
+      primitive->draw(surface, &args[i], GFX_ROP_OR);
+      pixels += bench_count_pixels(surface);
+    }
+
+    uint32_t start = bench_start();
+    for (uint i = 0; i < BENCH_BATCH; i++) {
+      primitive->draw(surface, &args[i], rop);
+    }
+    cycles += bench_cycles_since(start);
+  }
+
+  char name[48];
+  snprintf(name, sizeof(name), "%s %s %s", primitive->name, rop_names[rop],
+           surface->byte_oriented ? "(bytes)" : "(words)");
+  bench_report(name, "pixel", cycles, pixels);
+}
+
+static void bench_gfx_all(bool byte_oriented) {
+  gfx_surface_t surface;
+  gfx_surface_init(&surface, frame_buffer, width, height, stride, byte_oriented);
+  for (uint i = 0; i < count_of(bench_gfx_primitives); i++) {
+    bench_gfx(&surface, &bench_gfx_primitives[i], GFX_ROP_COPY);
+    bench_gfx(&surface, &bench_gfx_primitives[i], GFX_ROP_XOR);
+  }
+}
+
+// Contention between drawing and scanout. Rectangles are drawn into an off-screen surface on the
+// heap while a frame buffer is scanned out from either the heap, sharing its banks, or the reserved
+// bank. The bus fabric counts accesses to SRAM banks 0 to 3 which had to wait for another master.
+// Each placement is measured with the processors and then DMA given priority.
+static void bench_contention(void) {
+  static const uint8_t contested_events[] = {
+      arbiter_sram0_perf_event_access_contested,
+      arbiter_sram1_perf_event_access_contested,
+      arbiter_sram2_perf_event_access_contested,
+      arbiter_sram3_perf_event_access_contested,
+  };
+  size_t size = stride * height;
+  uint8_t *off_screen_buffer = fbmem_alloc_shared(size);
+  gfx_surface_t off_screen;
+  gfx_surface_init(&off_screen, off_screen_buffer, width, height, stride, true);
+  memset(off_screen_buffer, 0x00, size);
+
+  for (uint bank = 0; bank < 2; bank++) {
+    uint8_t *shown = bank ? fbmem_alloc(size) : fbmem_alloc_shared(size);
+    if ((shown == NULL) || (fbmem_in_bank(shown) != bank)) {
+      printf("contention %-19s unavailable\n", bank ? "(bank)" : "(shared)");
+      fbmem_free(shown);
+      continue;
+    }
+    memset(shown, 0x55, size);
+    tvout_flip(shown);
+
+    for (uint dma_priority = 0; dma_priority < 2; dma_priority++) {
+      bus_ctrl_hw->priority =
+          dma_priority ? (BUSCTRL_BUS_PRIORITY_DMA_R_BITS | BUSCTRL_BUS_PRIORITY_DMA_W_BITS) : 0;
+      for (uint i = 0; i < count_of(contested_events); i++) {
+        bus_ctrl_hw->counter[i].sel = contested_events[i];
+        bus_ctrl_hw->counter[i].value = 0; // Any write clears
+      }
+
+      uint64_t cycles = 0, count = 0;
+      for (uint pass = 0; pass < BENCH_PASSES; pass++) {
+        bench_gfx_args_t args[BENCH_BATCH];
+        for (uint i = 0; i < BENCH_BATCH; i++) {
+          bench_generate_rect(&off_screen, &args[i]);
+        }
+        uint32_t start = bench_start();
+        for (uint i = 0; i < BENCH_BATCH; i++) {
+          bench_draw_fill_rect(&off_screen, &args[i], GFX_ROP_XOR);
+        }
+        cycles += bench_cycles_since(start);
+        count += BENCH_BATCH;
+      }
+
+      uint32_t contested = 0;
+      for (uint i = 0; i < count_of(contested_events); i++) {
+        contested += bus_ctrl_hw->counter[i].value;
+      }
+      char name[48];
+      snprintf(name, sizeof(name), "contention %s %s", bank ? "(bank)" : "(shared)",
+               dma_priority ? "DMA first" : "CPU first");
+      printf("%-30s %8.2f cycles/rect %10lu contested accesses\n", name, (double)cycles / count,
+             (unsigned long)contested);
+    }
+
+    tvout_flip(frame_buffer);
+    fbmem_free(shown);
+  }
+
+  bus_ctrl_hw->priority = BUSCTRL_BUS_PRIORITY_DMA_R_BITS | BUSCTRL_BUS_PRIORITY_DMA_W_BITS;
+  fbmem_free(off_screen_buffer);
+}
+
+// Play an animation from flash at the full field rate, timing the decoding of each frame against
+// the field period.
+static void bench_animation(const char *name, const animation_t *animation, uint loops) {
+  uint8_t *back_buffer = fbmem_alloc(animation->stride * animation->height);
+  animation_player_t player;
+  animation_player_init(&player, animation, frame_buffer, back_buffer);
+  for (uint i = 0; i < loops * animation->frame_count; i++) {
+    if (!animation_player_step(&player)) {
+      printf("%-30s malformed\n", name);
+      break;
+    }
+  }
+
+  const animation_stats_t *stats = &player.stats;
+  uint32_t size = animation->offsets[animation->frame_count] - animation->offsets[0];
+  printf("%-30s %8lu us/frame %8lu us max of %u us, %lu late of %lu, %lu delta bytes/frame\n", name,
+         (unsigned long)(stats->decode_us / stats->frames), (unsigned long)stats->max_decode_us,
+         tvout_get_field_period_us(), (unsigned long)stats->late_frames,
+         (unsigned long)stats->frames, (unsigned long)(size / animation->frame_count));
+
+  tvout_flip(frame_buffer);
+  fbmem_free(back_buffer);
+}
+
+int main() {
+  stdio_init_all();
+
+  tvout_init(pio0, true, GPIO_SYNC_PIN, GPIO_VIDEO_PIN);
+  width = tvout_get_screen_width();
+  height = tvout_get_screen_height();
+  stride = width >> 3;
+  frame_buffer = fbmem_alloc(stride * height);
+  memset(frame_buffer, 0x00, stride * height);
+  tvout_set_frame_buffer(frame_buffer);
+  tvout_start();
+
+  bench_init();
+  printf("Benchmarks at %lu Hz with the hot paths in %s\n", (unsigned long)clock_get_hz(clk_sys),
+         HOTPATH_MEMORY);
+
+  bench_isr("video interrupt", false);
+  bench_isr("video interrupt cold", true);
+  bench_sprites("video interrupt 1 sprite", 1);
+  bench_sprites("video interrupt 8 sprites", TVOUT_SPRITES_PER_LINE);
+
+  bench_console("console 8x8 (80 columns)", &font_8x8, false);
+  bench_console("console 6x8 (106 columns)", &font_6x8, false);
+  bench_console("console 8x8 cold", &font_8x8, true);
+  const font_t *font_8x8_ram = glyph_copy_font_to_ram(&font_8x8);
+  bench_console("console 8x8 RAM font", font_8x8_ram, false);
+  bench_console("console 8x8 RAM font cold", font_8x8_ram, true);
+  bench_console_scroll("console scroll 1 line/4 fields", 1, 4);
+  bench_console_scroll("console scroll 1 line/field", 1, 1);
+  bench_console_scroll("console scroll burst of 8", 8, 25);
+
+  // Half-set pseudo-random source so that blits are not all ones.
+  gfx_surface_init(&blit_source, blit_source_buffer, BENCH_BLIT_SIZE, BENCH_BLIT_SIZE,
+                   BENCH_BLIT_SIZE >> 3, true);
+  for (uint i = 0; i < count_of(blit_source_buffer); i++) {
+    blit_source_buffer[i] = bench_random(0x10000) | (bench_random(0x10000) << 16);
+  }
+  bench_gfx_all(true);
+  bench_gfx_all(false);
+
+  bench_contention();
+  bench_animation("animation 640x256", &demo_animation, 2);
+
+  puts("Done");
+  while (true) {
+    tight_loop_contents();
+  }
+}
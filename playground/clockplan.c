@@ -0,0 +1,68 @@
+#include <stdlib.h>
+
+#include "clockplan.h"
+
+// PLL_SYS limits, as checked by the SDK's check_sys_clock_khz().
+#define REF_HZ 12000000
+#define VCO_MIN_HZ 750000000
+#define VCO_MAX_HZ 1600000000
+#define FBDIV_MIN 16
+#define FBDIV_MAX 320
+#define POSTDIV_MAX 7
+
+int32_t clockplan_error_ppm(uint32_t sys_hz, uint32_t divider_256, uint32_t target_hz) {
+  int64_t actual = (int64_t)sys_hz * 256;
+  int64_t target = (int64_t)target_hz * divider_256;
+  return (int32_t)(((actual - target) * 1000000) / target);
+}
+
+// Fill in the dividers and errors of a plan for sys_hz. Returns the worst error relative to its
+// target's tolerance in thousandths, or UINT32_MAX if a divider is out of range.
+static uint32_t clockplan_intl_evaluate(const clockplan_target_t *targets, unsigned count,
+                                        uint32_t sys_hz, clockplan_t *plan) {
+  uint32_t worst = 0;
+  for (unsigned i = 0; i < count; i++) {
+    uint32_t divider = (sys_hz + (targets[i].hz >> 1)) / targets[i].hz;
+    if ((divider < 1) || (divider > 65535)) {
+      return UINT32_MAX;
+    }
+    int32_t error_ppm = clockplan_error_ppm(sys_hz, divider << 8, targets[i].hz);
+    uint32_t badness = ((uint64_t)abs(error_ppm) * 1000) / targets[i].tolerance_ppm;
+    plan->divider[i] = divider;
+    plan->error_ppm[i] = error_ppm;
+    worst = (badness > worst) ? badness : worst;
+  }
+  return worst;
+}
+
+bool clockplan_search(const clockplan_target_t *targets, unsigned count, uint32_t min_hz,
+                      uint32_t max_hz, clockplan_t *plan) {
+  uint32_t best = UINT32_MAX;
+  for (uint32_t fbdiv = FBDIV_MIN; fbdiv <= FBDIV_MAX; fbdiv++) {
+    uint32_t vco_hz = REF_HZ * fbdiv;
+    if (vco_hz < VCO_MIN_HZ) {
+      continue;
+    }
+    if (vco_hz > VCO_MAX_HZ) {
+      break;
+    }
+    for (uint32_t postdiv1 = 1; postdiv1 <= POSTDIV_MAX; postdiv1++) {
+      for (uint32_t postdiv2 = 1; postdiv2 <= postdiv1; postdiv2++) {
+        // Only whole numbers of Hz, which the SDK's clock frequencies can represent exactly.
+        uint32_t sys_hz = vco_hz / (postdiv1 * postdiv2);
+        if ((vco_hz % (postdiv1 * postdiv2) != 0) || (sys_hz < min_hz) || (sys_hz > max_hz)) {
+          continue;
+        }
+        clockplan_t candidate = {
+            .sys_hz = sys_hz, .vco_hz = vco_hz, .postdiv1 = postdiv1, .postdiv2 = postdiv2};
+        uint32_t badness = clockplan_intl_evaluate(targets, count, sys_hz, &candidate);
+        if ((badness < best) || ((badness == best) && (badness != UINT32_MAX) &&
+                                 (sys_hz > plan->sys_hz))) {
+          best = badness;
+          *plan = candidate;
+        }
+      }
+    }
+  }
+  return best != UINT32_MAX;
+}
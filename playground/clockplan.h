@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Clock planning. Searches the system clocks which PLL_SYS can make from the 12MHz crystal for one
+// whose integer divisions come closest to a set of target clocks, e.g. those of PIO state machines.
+// A fractional divider alternates between the two nearest whole numbers of system clock cycles,
+// so its output has a cycle of jitter, which shows as shimmering vertical edges on a TV. This
+// module has no dependency on the Pico SDK so that it can also be built on the host.
+
+#define CLOCKPLAN_MAX_TARGETS 4
+
+typedef struct {
+  uint32_t hz;            // Target frequency
+  uint32_t tolerance_ppm; // Error which is as bad as any other target's tolerance
+} clockplan_target_t;
+
+typedef struct {
+  uint32_t sys_hz;                           // System clock
+  uint32_t vco_hz;                           // VCO and post dividers for set_sys_clock_pll()
+  uint8_t postdiv1, postdiv2;
+  uint16_t divider[CLOCKPLAN_MAX_TARGETS];   // Integer divider of each target
+  int32_t error_ppm[CLOCKPLAN_MAX_TARGETS];  // Frequency error of each target
+} clockplan_t;
+
+// Find the system clock between min_hz and max_hz whose worst target error, relative to the
+// target's tolerance, is the smallest. Ties go to the faster system clock. Returns false if no
+// system clock in range can make every target with a divider from 1 to 65535.
+bool clockplan_search(const clockplan_target_t *targets, unsigned count, uint32_t min_hz,
+                      uint32_t max_hz, clockplan_t *plan);
+
+// Frequency error in parts per million of sys_hz divided by divider_256 / 256 against target_hz.
+int32_t clockplan_error_ppm(uint32_t sys_hz, uint32_t divider_256, uint32_t target_hz);
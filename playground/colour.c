@@ -0,0 +1,62 @@
+#include "colour.h"
+
+// Colour burst amplitude relative to the swing from black to white: 300mV peak to peak against
+// 700mV for PAL and 40 IRE against 100 for NTSC.
+#define PAL_BURST_AMPLITUDE (0.15f / 0.7f)
+#define NTSC_BURST_AMPLITUDE 0.2f
+
+const uint32_t colour_default_palette[COLOUR_PALETTE_SIZE] = {
+    0x000000, 0x0000aa, 0x00aa00, 0x00aaaa, 0xaa0000, 0xaa00aa, 0xaa5500, 0xaaaaaa,
+    0x555555, 0x5555ff, 0x55ff55, 0x55ffff, 0xff5555, 0xff55ff, 0xffff55, 0xffffff,
+};
+
+uint32_t colour_sample_hz(colour_standard_t standard) {
+  return (standard == COLOUR_PAL) ? 17734475 : 14318182;
+}
+
+unsigned colour_burst_cycles(colour_standard_t standard) {
+  return (standard == COLOUR_PAL) ? 10 : 9;
+}
+
+// DAC code of a level, see colour.h.
+static uint32_t colour_intl_code(unsigned dac_bits, float level) {
+  float full_scale = (float)((1u << dac_bits) - 1);
+  float code = full_scale * (0.2f + (0.6f * level)) + 0.5f;
+  return (code < 0) ? 0 : (code > full_scale) ? (uint32_t)full_scale : (uint32_t)code;
+}
+
+// One subcarrier cycle of samples of luma y and colour differences u and v, starting at phase. The
+// subcarrier is sin for U and cos for V, so at each quarter cycle only one of them contributes.
+static uint32_t colour_intl_cycle(unsigned dac_bits, unsigned phase, float y, float u, float v) {
+  uint32_t cycle = 0;
+  for (unsigned i = 0; i < COLOUR_PHASES; i++) {
+    static const float chroma[COLOUR_PHASES][2] = {{0, 1}, {1, 0}, {0, -1}, {-1, 0}};
+    const float *c = chroma[(phase + i) % COLOUR_PHASES];
+    cycle = (cycle << 8) | colour_intl_code(dac_bits, y + (c[0] * u) + (c[1] * v));
+  }
+  return cycle;
+}
+
+void colour_encode(colour_standard_t standard, unsigned dac_bits, const uint32_t *palette,
+                   colour_patterns_t *patterns) {
+  // PAL's burst swings between +135 and -135 degrees with the V switch, NTSC's stays at 180.
+  float burst_u = (standard == COLOUR_PAL) ? -PAL_BURST_AMPLITUDE * 0.70710678f
+                                           : -NTSC_BURST_AMPLITUDE;
+  float burst_v = (standard == COLOUR_PAL) ? PAL_BURST_AMPLITUDE * 0.70710678f : 0;
+  for (unsigned v_switch = 0; v_switch < 2; v_switch++) {
+    float sign = ((standard == COLOUR_PAL) && v_switch) ? -1 : 1;
+    for (unsigned phase = 0; phase < COLOUR_PHASES; phase++) {
+      for (unsigned i = 0; i < COLOUR_PALETTE_SIZE; i++) {
+        float r = ((palette[i] >> 16) & 0xff) / 255.0f;
+        float g = ((palette[i] >> 8) & 0xff) / 255.0f;
+        float b = (palette[i] & 0xff) / 255.0f;
+        float y = (0.299f * r) + (0.587f * g) + (0.114f * b);
+        patterns->pixel[v_switch][phase][i] =
+            colour_intl_cycle(dac_bits, phase, y, 0.493f * (b - y), sign * 0.877f * (r - y));
+      }
+      patterns->burst[v_switch][phase] =
+          colour_intl_cycle(dac_bits, phase, 0, burst_u, sign * burst_v);
+    }
+  }
+  patterns->blank = colour_intl_cycle(dac_bits, 0, 0, 0, 0);
+}
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <stdint.h>
+
+// Composite colour encoding. A palette colour is turned into one cycle of the colour subcarrier as
+// four DAC samples, taken at four times the subcarrier frequency, so that scanout only has to look
+// its samples up. At that rate each sample falls on the U or V axis: a sample is the luma plus or
+// minus one of the colour differences. This module has no dependency on the Pico SDK so that it can
+// also be built on the host.
+//
+// Levels are relative to the swing from black to white. The DAC's full scale is 5/3 of that swing,
+// with blanking, which is also black, at a fifth of full scale and white at four fifths, leaving
+// room for the colour burst and for chroma above white and below black.
+
+#define COLOUR_PALETTE_SIZE 16
+
+// Samples per subcarrier cycle, and so the number of phases at which a line can start.
+#define COLOUR_PHASES 4
+
+typedef enum {
+  COLOUR_PAL,  // 4.43361875MHz, V inverted on alternate lines
+  COLOUR_NTSC, // 3.579545MHz
+} colour_standard_t;
+
+// Sample patterns of a palette. Each word is one subcarrier cycle of four 8 bit samples, the first
+// in the most significant byte. They're indexed by the PAL V switch, always 0 for NTSC, and by the
+// phase of the subcarrier, in quarter cycles, at the first sample.
+typedef struct {
+  uint32_t pixel[2][COLOUR_PHASES][COLOUR_PALETTE_SIZE];
+  uint32_t burst[2][COLOUR_PHASES];
+  uint32_t blank;
+} colour_patterns_t;
+
+// Default palette: the 16 colours of the IBM PC's CGA, as 0xRRGGBB.
+extern const uint32_t colour_default_palette[COLOUR_PALETTE_SIZE];
+
+// Sample clock, four times the subcarrier frequency.
+uint32_t colour_sample_hz(colour_standard_t standard);
+
+// Length of the colour burst in subcarrier cycles.
+unsigned colour_burst_cycles(colour_standard_t standard);
+
+// Encode a palette of 0xRRGGBB colours for a DAC of dac_bits bits, at most 8.
+void colour_encode(colour_standard_t standard, unsigned dac_bits, const uint32_t *palette,
+                   colour_patterns_t *patterns);
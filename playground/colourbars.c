@@ -0,0 +1,62 @@
+#include <stdio.h>
+
+#include "pico/stdlib.h"
+
+#include "fbmem.h"
+#include "tvout.h"
+
+// Colour bars in the colour mode: the 16 palette colours as vertical bars over the top half of the
+// screen and, below them, each colour in a row of blocks alternating with the next colour, which
+// shows how much chroma the TV lets through between neighbouring pixels.
+
+#define GPIO_SYNC_PIN 16
+#define GPIO_VIDEO_PIN 17
+
+#ifndef PLAYGROUND_COLOUR
+#define PLAYGROUND_COLOUR TVOUT_COLOUR_PAL
+#endif
+
+#ifndef PLAYGROUND_DAC_BITS
+#define PLAYGROUND_DAC_BITS 4
+#endif
+
+int main() {
+  tvout_init(pio0, true, GPIO_SYNC_PIN, GPIO_VIDEO_PIN);
+  tvout_set_mode(TVOUT_MODE_320X256_COLOUR);
+  tvout_set_colour(PLAYGROUND_COLOUR, PLAYGROUND_DAC_BITS);
+  tvout_set_clock(TVOUT_CLOCK_EXACT);
+
+  stdio_init_all();
+
+  uint width = tvout_get_screen_width();
+  uint height = tvout_get_screen_height();
+  uint stride = width >> 1;
+  uint8_t *frame_buffer = fbmem_alloc(stride * height);
+  for (uint y = 0; y < height; y++) {
+    uint8_t *row = frame_buffer + (y * stride);
+    if (y < (height >> 1)) {
+      for (uint x = 0; x < stride; x++) {
+        uint colour = (x * 16) / stride;
+        row[x] = (colour << 4) | colour;
+      }
+    } else {
+      uint colour = ((y - (height >> 1)) * 16) / (height - (height >> 1));
+      uint next = (colour + 1) & 0xf;
+      for (uint x = 0; x < stride; x++) {
+        row[x] = ((x >> 2) & 1) ? ((colour << 4) | colour) : ((next << 4) | next);
+      }
+    }
+  }
+  tvout_set_frame_buffer(frame_buffer);
+  tvout_start();
+
+  tvout_clock_info_t clocks;
+  tvout_get_clock_info(&clocks);
+  printf("Colour bars, sys_clk %luHz, PIO divider %.3f, subcarrier %+ldppm, jitter %lups\n",
+         (unsigned long)clocks.sys_clock_hz, clocks.video_divider, (long)clocks.dot_error_ppm,
+         (unsigned long)clocks.jitter_ps);
+
+  while (true) {
+    tight_loop_contents();
+  }
+}
@@ -0,0 +1,516 @@
+#include <stdatomic.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+#include "console.h"
+#include "gfx.h"
+#include "glyph.h"
+#include "hotpath.h"
+#include "sixel.h"
+
+static const font_t *font;
+static uint8_t *frame_buffer;
+static uint width, height, stride;
+
+static uint cursor_row, cursor_col;
+static bool cursor_shown, cursor_enabled;
+
+// UTF-8 decoder state. utf8_remaining is the number of continuation bytes still expected and
+// utf8_min the smallest code point which may be encoded with the current sequence's length.
+static uint32_t utf8_codepoint, utf8_min;
+static uint utf8_remaining;
+
+// Escape sequence state. The only sequences recognised are DCS strings, ESC P ... ESC \, of which
+// only sixel graphics are drawn. Other escape sequences are passed through as before.
+typedef enum {
+  CONSOLE_ESCAPE_NONE,
+  CONSOLE_ESCAPE_ESC,        // After ESC
+  CONSOLE_ESCAPE_DCS,        // Reading the parameters of a DCS string
+  CONSOLE_ESCAPE_DCS_IGNORE, // Inside an unsupported DCS string
+  CONSOLE_ESCAPE_SIXEL,      // Inside sixel data
+} console_escape_t;
+
+#define CONSOLE_DCS_PARAMS 3
+
+static console_escape_t escape_state;
+static bool escape_st_pending; // ESC seen inside a DCS string, which may start the terminator
+static uint dcs_params[CONSOLE_DCS_PARAMS], dcs_param_count;
+
+static gfx_surface_t surface; // The rows of the frame buffer holding text
+static sixel_decoder_t sixel;
+static bool sixel_dither;
+static int sixel_row; // Text row of the cursor in the sixel image's coordinates
+
+// Smooth scrolling, see console_set_smooth_scroll(). The frame buffer is a ring of console_rows()
+// text rows, of which shown_rows are on the screen once scrolling has caught up, starting with
+// top_row. Without smooth scrolling shown_rows is console_rows() and top_row 0.
+//
+// The main loop adds to scroll_requested, in pixel rows, as the screen follows the cursor and
+// console_refresh() adds to scroll_shown as it moves the origin. Each is the only writer of its
+// counter, so the backlog is their difference without a lock. scroll_limit is the backlog beyond
+// which the row cleared by a line feed is still on the screen.
+static bool smooth_scroll;
+static uint top_row, shown_rows;
+static _Atomic console_origin_callback_t scroll_callback;
+static atomic_uint scroll_requested, scroll_shown;
+static uint scroll_origin, scroll_limit;
+static volatile uint32_t scroll_max_backlog, scroll_jumps;
+
+// The origin moves by a pixel row per field plus the backlog shifted right by this, so that a
+// single line glides in over a few fields and a burst is caught up geometrically.
+#define CONSOLE_SCROLL_SHIFT 2
+
+#define console_rows() (height / font->height)
+#define console_cols() (width / font->width)
+
+// The cursor cell and cursor_shown are shared between the main loop and console_refresh(). Rather
+// than a lock, ownership is decided with a pair of flags in the manner of Dekker's algorithm. Each
+// side raises its own flag and then looks at the other's. Both accesses are sequentially
+// consistent so at least one side is guaranteed to see the other's flag:
+//
+// - The main loop raises update_in_progress and then waits for blink_in_progress to be lowered. A
+//   blink which has already started is at most two XORs so the wait is short and, when
+//   console_refresh() runs in an interrupt on the same core, never happens at all.
+// - console_refresh() raises blink_in_progress and then skips the blink if it sees
+//   update_in_progress. A skipped blink is retried on the next field.
+//
+// The cursor position and frame buffer are only written by the main loop while update_in_progress
+// is raised and so are never observed half-written by console_refresh().
+static atomic_bool update_in_progress;
+static atomic_bool blink_in_progress;
+
+static void console_intl_toggle_cursor(void);
+static void console_intl_line_feed(void);
+static void console_intl_carriage_return(void);
+static void console_intl_putc(char c);
+static void console_intl_put_glyph(const uint8_t *char_rows);
+static void console_intl_put_codepoint(uint32_t codepoint);
+
+// Claim the frame buffer for the main loop. Returns with the cursor hidden.
+static inline bool console_intl_begin_update(void) {
+  atomic_store(&update_in_progress, true);
+  while (atomic_load(&blink_in_progress)) {
+    tight_loop_contents();
+  }
+
+  bool cursor_was_shown = cursor_shown;
+  if (cursor_was_shown) {
+    console_intl_toggle_cursor();
+    cursor_shown = false;
+  }
+  return cursor_was_shown;
+}
+
+// Release the frame buffer claimed by console_intl_begin_update(), restoring the cursor.
+static inline void console_intl_end_update(bool cursor_was_shown) {
+  if (cursor_was_shown) {
+    console_intl_toggle_cursor();
+    cursor_shown = true;
+  }
+  atomic_store(&update_in_progress, false);
+}
+
+bool console_init(const font_t *f, uint8_t *fb, uint w, uint h, uint s) {
+  if (f->layout != FONT_LAYOUT_ROWS) {
+    return false;
+  }
+  font = f;
+  frame_buffer = fb;
+  width = w;
+  height = h;
+  stride = s;
+  atomic_init(&update_in_progress, false);
+  atomic_init(&blink_in_progress, false);
+  cursor_enabled = true;
+  sixel_dither = true;
+  atomic_store(&scroll_callback, NULL);
+  smooth_scroll = false;
+  top_row = 0;
+  shown_rows = console_rows();
+  gfx_surface_init(&surface, frame_buffer, width, console_rows() * font->height, stride, true);
+
+  memset(frame_buffer, 0x00, stride * height);
+  console_reset();
+  return true;
+}
+
+void console_reset(void) {
+  bool cursor_was_shown = console_intl_begin_update();
+  cursor_row = top_row;
+  cursor_col = 0;
+  utf8_remaining = 0;
+  escape_state = CONSOLE_ESCAPE_NONE;
+  escape_st_pending = false;
+  console_intl_end_update(cursor_was_shown);
+}
+
+// Cells narrower than eight pixels are not byte aligned. They are drawn by shifting each glyph row
+// into place and merging it into the one or two 32-bit words it overlaps. The frame buffer is
+// byte-oriented and so a word read from memory has its bytes in the reverse of screen order. Rather
+// than reversing every word read, the masks and the shifted row are reversed instead.
+typedef struct {
+  uint32_t *dest;        // Word containing the left-most pixel of the cell's top row
+  uint shift;            // Offset of the left-most pixel within the word
+  uint32_t mask0, mask1; // Cell pixels within the first and second words in memory byte order
+} console_narrow_cell_t;
+
+static inline console_narrow_cell_t console_intl_narrow_cell(uint first_row) {
+  uint x = cursor_col * font->width;
+  uint32_t mask = (0xFFu << (8 - font->width)) << 24;
+  console_narrow_cell_t cell = {
+      .dest = (uint32_t *)(frame_buffer + (cursor_row * font->height + first_row) * stride) +
+              (x >> 5),
+      .shift = x & 0x1f,
+  };
+  cell.mask0 = __builtin_bswap32(mask >> cell.shift);
+  cell.mask1 = (cell.shift > 32 - font->width) ? __builtin_bswap32(mask << (32 - cell.shift)) : 0;
+  return cell;
+}
+
+static void HOTPATH_ISR(console_intl_toggle_cursor)(void) {
+  // The cursor is the bottom two rows of the cell.
+  uint first_row = font->height - 2;
+  if (font->width == 8) {
+    uint8_t *dest = frame_buffer + cursor_col + (cursor_row * font->height + first_row) * stride;
+    for (int i = 0; i < 2; i++, dest += stride) {
+      *dest ^= 0xFF;
+    }
+    return;
+  }
+
+  console_narrow_cell_t cell = console_intl_narrow_cell(first_row);
+  for (int i = 0; i < 2; i++, cell.dest += stride >> 2) {
+    cell.dest[0] ^= cell.mask0;
+    if (cell.mask1 != 0) {
+      cell.dest[1] ^= cell.mask1;
+    }
+  }
+}
+
+static void HOTPATH_FUNC(console_intl_put_glyph)(const uint8_t *char_rows) {
+  if (font->width == 8) {
+    // Fast path. Cells are byte aligned and rows are simply copied.
+    uint8_t *dest = frame_buffer + cursor_col + cursor_row * font->height * stride;
+    for (uint i = 0; i < font->height; i++, char_rows++, dest += stride) {
+      *dest = *char_rows;
+    }
+  } else {
+    console_narrow_cell_t cell = console_intl_narrow_cell(0);
+    uint32_t *dest = cell.dest;
+    if (cell.mask1 == 0) {
+      for (uint i = 0; i < font->height; i++, char_rows++, dest += stride >> 2) {
+        uint32_t bits = __builtin_bswap32(((uint32_t)*char_rows << 24) >> cell.shift);
+        dest[0] = (dest[0] & ~cell.mask0) | bits;
+      }
+    } else {
+      // The cell straddles two words.
+      for (uint i = 0; i < font->height; i++, char_rows++, dest += stride >> 2) {
+        uint32_t row = (uint32_t)*char_rows << 24;
+        dest[0] = (dest[0] & ~cell.mask0) | __builtin_bswap32(row >> cell.shift);
+        dest[1] = (dest[1] & ~cell.mask1) | __builtin_bswap32(row << (32 - cell.shift));
+      }
+    }
+  }
+
+  cursor_col += 1;
+  if (cursor_col >= console_cols()) {
+    console_intl_carriage_return();
+    console_intl_line_feed();
+  }
+}
+
+static void HOTPATH_FUNC(console_intl_put_codepoint)(uint32_t codepoint) {
+  // C1 control characters have no glyph and are ignored like their C0 counterparts.
+  if (codepoint >= 0xA0) {
+    console_intl_put_glyph(glyph_get(font, codepoint));
+  }
+}
+
+// Make room for a band of a sixel image ending above row bottom. The cursor is moved down with line
+// feeds until it's on the text row holding the band's last row, so that the rows the image moves
+// into are scrolled onto the screen and cleared just as for text. Returns the number of pixel rows
+// the frame buffer scrolled up, which is none with smooth scrolling as the image carries on round
+// the ring.
+static int console_intl_sixel_band(int bottom) {
+  int scrolled = 0;
+  while (sixel_row < (bottom - scrolled - 1) / (int)font->height) {
+    uint row = cursor_row;
+    console_intl_line_feed();
+    if (cursor_row == row) {
+      // The frame buffer scrolled up under the cursor.
+      scrolled += font->height;
+    } else {
+      sixel_row++;
+    }
+  }
+  return scrolled;
+}
+
+static void console_intl_end_dcs(void) {
+  if (escape_state == CONSOLE_ESCAPE_SIXEL) {
+    // Continue below the image. The band callback has already brought its rows onto the screen.
+    int bottom = sixel_finish(&sixel);
+    if (bottom > 0) {
+      cursor_row = ((bottom - 1) / font->height) % console_rows();
+      console_intl_carriage_return();
+      console_intl_line_feed();
+    }
+  }
+  escape_state = CONSOLE_ESCAPE_NONE;
+}
+
+// Handle a byte of an escape sequence. Returns false if the byte is not part of one.
+static bool HOTPATH_FUNC(console_intl_escape)(uint8_t b) {
+  if (escape_st_pending) {
+    // ESC inside a DCS string ends it. ESC \ is the string terminator, anything else starts a new
+    // escape sequence.
+    escape_st_pending = false;
+    console_intl_end_dcs();
+    if (b == '\\') {
+      return true;
+    }
+    escape_state = CONSOLE_ESCAPE_ESC;
+  }
+
+  switch (escape_state) {
+  case CONSOLE_ESCAPE_NONE:
+    return false;
+  case CONSOLE_ESCAPE_ESC:
+    if (b != 'P') {
+      escape_state = CONSOLE_ESCAPE_NONE;
+      return false;
+    }
+    escape_state = CONSOLE_ESCAPE_DCS;
+    dcs_param_count = 1;
+    dcs_params[0] = 0;
+    return true;
+  default:
+    break;
+  }
+
+  // Inside a DCS string.
+  if (b == 0x1B) {
+    escape_st_pending = true;
+    return true;
+  }
+  // CAN and SUB abandon it.
+  if ((b == 0x18) || (b == 0x1A)) {
+    console_intl_end_dcs();
+    return true;
+  }
+
+  switch (escape_state) {
+  case CONSOLE_ESCAPE_DCS:
+    if ((b >= '0') && (b <= '9')) {
+      uint *p = &dcs_params[dcs_param_count - 1];
+      *p = MIN(*p * 10 + (b - '0'), 0xFFFF);
+    } else if (b == ';') {
+      if (dcs_param_count < CONSOLE_DCS_PARAMS) {
+        dcs_params[dcs_param_count++] = 0;
+      }
+    } else if (b == 'q') {
+      // The second parameter selects whether zero bits are transparent. The first, the aspect
+      // ratio, is ignored.
+      bool transparent = (dcs_param_count >= 2) && (dcs_params[1] == 1);
+      sixel_row = cursor_row;
+      sixel_decoder_init(&sixel, &surface, cursor_col * font->width, cursor_row * font->height,
+                         console_intl_sixel_band, transparent, sixel_dither);
+      escape_state = CONSOLE_ESCAPE_SIXEL;
+    } else if (b >= 0x20) {
+      escape_state = CONSOLE_ESCAPE_DCS_IGNORE;
+    }
+    break;
+  case CONSOLE_ESCAPE_SIXEL:
+    sixel_putc(&sixel, b);
+    break;
+  default:
+    break;
+  }
+  return true;
+}
+
+static void HOTPATH_FUNC(console_intl_putc)(char c) {
+  uint8_t b = c;
+
+  if (console_intl_escape(b)) {
+    return;
+  }
+
+  if (utf8_remaining > 0) {
+    if ((b & 0xC0) == 0x80) {
+      utf8_codepoint = (utf8_codepoint << 6) | (b & 0x3F);
+      if (--utf8_remaining == 0) {
+        // Reject overlong encodings, surrogates and anything beyond the Unicode range.
+        bool valid = (utf8_codepoint >= utf8_min) && (utf8_codepoint <= 0x10FFFF) &&
+                     ((utf8_codepoint & 0xFFFFF800) != 0xD800);
+        console_intl_put_codepoint(valid ? utf8_codepoint : GLYPH_REPLACEMENT_CHARACTER);
+      }
+      return;
+    }
+
+    // Truncated sequence. Mark it and then treat this byte as the start of a new one.
+    utf8_remaining = 0;
+    console_intl_put_codepoint(GLYPH_REPLACEMENT_CHARACTER);
+  }
+
+  if ((b >= 32) && (b < 127)) {
+    console_intl_put_glyph(font_ascii_rows(font, b));
+  } else if (b == 0x0A) {
+    console_intl_line_feed();
+  } else if (b == 0x0D) {
+    console_intl_carriage_return();
+  } else if (b == 0x1B) {
+    escape_state = CONSOLE_ESCAPE_ESC;
+  } else if ((b & 0xE0) == 0xC0) {
+    utf8_codepoint = b & 0x1F;
+    utf8_min = 0x80;
+    utf8_remaining = 1;
+  } else if ((b & 0xF0) == 0xE0) {
+    utf8_codepoint = b & 0x0F;
+    utf8_min = 0x800;
+    utf8_remaining = 2;
+  } else if ((b & 0xF8) == 0xF0) {
+    utf8_codepoint = b & 0x07;
+    utf8_min = 0x10000;
+    utf8_remaining = 3;
+  } else if (b >= 0x80) {
+    // Stray continuation byte or a byte which never appears in UTF-8.
+    console_intl_put_codepoint(GLYPH_REPLACEMENT_CHARACTER);
+  }
+}
+
+static void HOTPATH_FUNC(console_intl_carriage_return)(void) { cursor_col = 0; }
+
+static void HOTPATH_FUNC(console_intl_line_feed)(void) {
+  cursor_row += 1;
+  if (smooth_scroll) {
+    // The screen follows the cursor round the ring, clearing the row it scrolls on.
+    uint rows = console_rows();
+    cursor_row %= rows;
+    if (((cursor_row + rows - top_row) % rows) >= shown_rows) {
+      top_row = (top_row + 1) % rows;
+      atomic_store(&scroll_requested, atomic_load(&scroll_requested) + font->height);
+      uint row_bytes = font->height * stride;
+      memset(frame_buffer + cursor_row * row_bytes, 0x00, row_bytes);
+    }
+    return;
+  }
+
+  while (cursor_row >= console_rows()) {
+    uint row_bytes = font->height * stride;
+    uint used = console_rows() * row_bytes;
+    memmove(frame_buffer, frame_buffer + row_bytes, used - row_bytes);
+    memset(frame_buffer + used - row_bytes, 0x00, row_bytes);
+    cursor_row--;
+  }
+}
+
+void HOTPATH_FUNC(console_putc)(char c) {
+  bool cursor_was_shown = console_intl_begin_update();
+  console_intl_putc(c);
+  console_intl_end_update(cursor_was_shown);
+}
+
+void HOTPATH_FUNC(console_write)(const char *s, size_t n) {
+  bool cursor_was_shown = console_intl_begin_update();
+  for (; n > 0; n--, s++) {
+    console_intl_putc(*s);
+  }
+  console_intl_end_update(cursor_was_shown);
+}
+
+void console_carriage_return(void) {
+  bool cursor_was_shown = console_intl_begin_update();
+  console_intl_carriage_return();
+  console_intl_end_update(cursor_was_shown);
+}
+
+void HOTPATH_FUNC(console_line_feed)(void) {
+  bool cursor_was_shown = console_intl_begin_update();
+  console_intl_line_feed();
+  console_intl_end_update(cursor_was_shown);
+}
+
+void console_set_cursor_enabled(bool enabled) {
+  bool cursor_was_shown = console_intl_begin_update();
+  cursor_enabled = enabled;
+  console_intl_end_update(cursor_was_shown && enabled);
+}
+
+void console_set_sixel_dither(bool dither) { sixel_dither = dither; }
+
+bool console_set_smooth_scroll(uint screen_height, console_origin_callback_t origin) {
+  bool cursor_was_shown = console_intl_begin_update();
+  // console_refresh() leaves the scroll state alone until it's consistent again.
+  atomic_store(&scroll_callback, NULL);
+  uint screen_rows = screen_height / font->height;
+  smooth_scroll = (origin != NULL) && (screen_rows > 0) && (screen_rows < console_rows());
+  shown_rows = smooth_scroll ? screen_rows : console_rows();
+  top_row = 0;
+  scroll_origin = 0;
+  scroll_limit = (console_rows() - shown_rows) * font->height;
+  atomic_store(&scroll_requested, 0);
+  atomic_store(&scroll_shown, 0);
+  scroll_max_backlog = 0;
+  scroll_jumps = 0;
+  memset(frame_buffer, 0x00, stride * height);
+  cursor_row = cursor_col = 0;
+  if (origin != NULL) {
+    origin(0);
+  }
+  if (smooth_scroll) {
+    atomic_store(&scroll_callback, origin);
+  }
+  console_intl_end_update(cursor_was_shown);
+  return smooth_scroll;
+}
+
+void console_get_scroll_stats(console_scroll_stats_t *stats) {
+  stats->backlog = atomic_load(&scroll_requested) - atomic_load(&scroll_shown);
+  stats->max_backlog = scroll_max_backlog;
+  stats->jumps = scroll_jumps;
+}
+
+// Move the origin towards the top row. A backlog beyond scroll_limit means a line feed has already
+// cleared a row on the screen, so the origin jumps to catch up at least that far.
+static void HOTPATH_ISR(console_intl_scroll)(console_origin_callback_t origin) {
+  uint shown = atomic_load(&scroll_shown);
+  uint backlog = atomic_load(&scroll_requested) - shown;
+  if (backlog == 0) {
+    return;
+  }
+  scroll_max_backlog = MAX(scroll_max_backlog, backlog);
+  uint step = 1 + (backlog >> CONSOLE_SCROLL_SHIFT);
+  if (backlog > scroll_limit) {
+    step = MAX(step, backlog - scroll_limit);
+    scroll_jumps++;
+  }
+  step = MIN(step, backlog);
+  atomic_store(&scroll_shown, shown + step);
+  scroll_origin = (scroll_origin + step) % (console_rows() * font->height);
+  origin(scroll_origin);
+}
+
+void HOTPATH_ISR(console_refresh)(void) {
+  static uint frame_count = 0;
+
+  // Scrolling doesn't touch the frame buffer and so carries on while the main loop writes.
+  console_origin_callback_t origin = atomic_load(&scroll_callback);
+  if (origin != NULL) {
+    console_intl_scroll(origin);
+  }
+
+  if (frame_count == 0) {
+    atomic_store(&blink_in_progress, true);
+    if (atomic_load(&update_in_progress) || !cursor_enabled) {
+      // The main loop owns the cursor cell or the cursor is disabled. Try again next field.
+      atomic_store(&blink_in_progress, false);
+      return;
+    }
+    console_intl_toggle_cursor();
+    cursor_shown = !cursor_shown;
+    atomic_store(&blink_in_progress, false);
+  }
+  frame_count = (frame_count + 1) & 0xf;
+}
@@ -0,0 +1,74 @@
+#include "pico/types.h"
+
+#include "font.h"
+
+// Text console drawn into a byte-oriented 1bpp frame buffer. Input is UTF-8 and glyphs are looked
+// up with glyph_get(). The font must use FONT_LAYOUT_ROWS. Fonts eight pixels wide are drawn with
+// byte copies. Narrower fonts, e.g. 6x8 giving 106 columns on a 640 dot line, are shifted and
+// merged into 32-bit words and so the frame buffer and stride must be word aligned.
+//
+// DEC sixel graphics, ESC P ... q ... ESC \, are drawn at the cursor as they arrive (see sixel.h)
+// and the cursor then moved to the start of the line below the image. Sixel graphics are drawn with
+// gfx.h and so also need a word aligned frame buffer and stride.
+//
+// The console is driven from a single context, the "main loop", which calls every console_*()
+// function other than console_refresh(). console_refresh() blinks the cursor, scrolls smoothly and
+// is intended to be used as the tvout vblank callback. It may therefore run from interrupt context
+// or from the other core and only touches the frame buffer when no update from the main loop is in
+// progress.
+
+// Initialise the console to draw into the passed frame buffer with the passed font. The frame
+// buffer is cleared and the cursor moved to the top-left. Returns false, leaving the console and
+// frame buffer untouched, if the font doesn't use FONT_LAYOUT_ROWS.
+bool console_init(const font_t *font, uint8_t *frame_buffer, uint width, uint height, uint stride);
+
+// Move the cursor to the top-left.
+void console_reset(void);
+
+// Write a single byte of UTF-8, interpreting carriage return and line feed. Malformed input is
+// drawn as U+FFFD.
+void console_putc(char c);
+
+// Write a run of characters. This is cheaper than calling console_putc() for each character.
+void console_write(const char *s, size_t n);
+
+void console_line_feed(void);
+void console_carriage_return(void);
+
+// Hide the cursor and stop it blinking, e.g. while something else draws into the frame buffer, or
+// re-enable it.
+void console_set_cursor_enabled(bool enabled);
+
+// Select whether sixel graphics are drawn dithered, the default, or thresholded to black and white.
+void console_set_sixel_dither(bool dither);
+
+// Called by console_refresh() with the row of the frame buffer to show on the first row of the
+// screen, e.g. to pass to tvout_set_layer_origin().
+typedef void (*console_origin_callback_t)(uint row);
+
+// Scroll smoothly, a few pixels per field, rather than a whole text row at each line feed. The
+// frame buffer is then a ring of text rows of which the screen shows screen_height pixel rows, a
+// whole number of text rows, from the row passed to origin. Line feeds clear the next row of the
+// ring, below those shown, and console_refresh() moves the origin towards it by more pixels per
+// field the further it is behind. Scrolling can fall behind by as many pixel rows as the frame
+// buffer has beyond the screen. Beyond that the origin jumps, and the row being cleared may show
+// blank for a field. Sixel graphics wrap round the ring, each band scrolling on the rows it needs
+// as a line feed would.
+//
+// The frame buffer is cleared and the cursor moved to the top-left. Returns false, and scrolls a
+// text row at a time, if origin is NULL or the frame buffer has no text row beyond the screen.
+bool console_set_smooth_scroll(uint screen_height, console_origin_callback_t origin);
+
+// Smooth scrolling since console_set_smooth_scroll(): the pixel rows written but not yet scrolled
+// into view, the most there have been at the start of a field, and the number of fields in which
+// the origin jumped.
+typedef struct {
+  uint32_t backlog;
+  uint32_t max_backlog;
+  uint32_t jumps;
+} console_scroll_stats_t;
+
+void console_get_scroll_stats(console_scroll_stats_t *stats);
+
+// Blink the cursor and scroll smoothly. Call once per field.
+void console_refresh(void);
@@ -0,0 +1,96 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+#include "fbmem.h"
+#include "font_8x16.h"
+#include "font_8x8.h"
+#include "gfx.h"
+#include "glyph.h"
+#include "tvout.h"
+
+// A dashboard made of a display list rather than a frame buffer: a title, a rule, a chart which
+// scrolls sideways and a log which scrolls smoothly upwards. Only the chart is a bitmap, so the
+// whole screen takes about half the RAM of a frame buffer.
+
+#define GPIO_SYNC_PIN 16
+#define GPIO_VIDEO_PIN 17
+
+#define COLUMNS 80
+#define CHART_HEIGHT 128
+
+// The log is a ring of text rows, three more than it shows so that the next rows can be written
+// below those shown before they scroll into view.
+#define LOG_SHOWN_ROWS 13
+#define LOG_ROWS 16
+
+// Fields between log lines.
+#define LOG_INTERVAL 16
+
+static char title[COLUMNS];
+static uint32_t rule[COLUMNS / 4];
+static char log_text[LOG_ROWS][COLUMNS];
+
+// Write a row of text padded with spaces.
+static void set_text(char *row, const char *text) {
+  size_t n = strlen(text);
+  memset(row, ' ', COLUMNS);
+  memcpy(row, text, MIN(n, COLUMNS));
+}
+
+int main() {
+  tvout_init(pio0, true, GPIO_SYNC_PIN, GPIO_VIDEO_PIN);
+
+  stdio_init_all();
+
+  const font_t *title_font = glyph_copy_font_to_ram(&font_8x16);
+  const font_t *log_font = glyph_copy_font_to_ram(&font_8x8);
+  set_text(title, "  Dashboard - a display list of text, bitmap and blank bands");
+  memset(rule, 0xcc, sizeof(rule));
+  for (uint i = 0; i < LOG_ROWS; i++) {
+    set_text(log_text[i], "");
+  }
+
+  uint8_t *chart_buffer = fbmem_alloc(CHART_HEIGHT * COLUMNS);
+  memset(chart_buffer, 0x00, CHART_HEIGHT * COLUMNS);
+  gfx_surface_t chart;
+  gfx_surface_init(&chart, chart_buffer, COLUMNS * 8, CHART_HEIGHT, COLUMNS, true);
+
+  tvout_band_t bands[] = {
+      {TVOUT_BAND_TEXT, 16, 0, 0, COLUMNS, title, title_font},
+      {TVOUT_BAND_REPEAT, 2, 0, 0, 0, rule, NULL},
+      {TVOUT_BAND_BITMAP, CHART_HEIGHT, 0, 0, COLUMNS, chart_buffer, NULL},
+      {TVOUT_BAND_BLANK, 6, 0, 0, 0, NULL, NULL},
+      {TVOUT_BAND_TEXT, LOG_SHOWN_ROWS * 8, 0, LOG_ROWS * 8, COLUMNS, log_text, log_font},
+  };
+  tvout_band_t *log_band = &bands[count_of(bands) - 1];
+  tvout_set_display_list(bands, count_of(bands));
+  tvout_start();
+
+  // The log scrolls a pixel per field until its last line is at the bottom.
+  uint fields = 0, log_lines = 0, log_top = 0;
+  int level = CHART_HEIGHT / 2;
+  while (true) {
+    tvout_wait_for_vblank();
+    fields++;
+
+    // Move the chart left by a pixel and add a point of a random walk at its right.
+    gfx_blit(&chart, 0, 0, &chart, 1, 0, chart.width - 1, CHART_HEIGHT, GFX_ROP_COPY);
+    gfx_fill_rect(&chart, chart.width - 1, 0, 1, CHART_HEIGHT, GFX_PATTERN_BLACK, GFX_ROP_COPY);
+    level = MAX(MIN(level + (int)(rand() % 7) - 3, CHART_HEIGHT - 1), 0);
+    gfx_pixel(&chart, chart.width - 1, level, 1, GFX_ROP_COPY);
+
+    if ((fields % LOG_INTERVAL) == 0) {
+      char line[COLUMNS + 1];
+      snprintf(line, sizeof(line), "field %6u  level %3d", fields, level);
+      set_text(log_text[log_lines % LOG_ROWS], line);
+      log_lines++;
+    }
+    if (log_top + (LOG_SHOWN_ROWS * 8) < log_lines * 8) {
+      log_top++;
+      log_band->scroll = log_top % (LOG_ROWS * 8);
+    }
+  }
+}
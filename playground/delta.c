@@ -0,0 +1,95 @@
+#include "delta.h"
+
+void delta_decoder_init(delta_decoder_t *decoder, uint8_t *dest, size_t size) {
+  delta_decoder_set_dest(decoder, dest, size);
+  decoder->state = DELTA_STATE_RUN;
+  decoder->count = 0;
+}
+
+size_t delta_decode(delta_decoder_t *decoder, const uint8_t *src, size_t n) {
+  const uint8_t *src_start = src, *src_end = src + n;
+  uint8_t *dest = decoder->dest, *dest_end = decoder->dest_end;
+  delta_state_t state = decoder->state;
+  unsigned count = decoder->count;
+
+  // Each state either completes its run, moving on to the next, or stops because the source or
+  // destination is exhausted.
+  for (;;) {
+    switch (state) {
+    case DELTA_STATE_RUN: {
+      if ((src == src_end) || (dest == dest_end)) {
+        goto done;
+      }
+      uint8_t header = *src++;
+      if (!(header & 0x80)) {
+        count = header + 1;
+        state = DELTA_STATE_SKIP;
+      } else {
+        count = (header & 0x3f) + 1;
+        state = (header & 0x40) ? DELTA_STATE_REPEAT_VALUE : DELTA_STATE_LITERAL;
+      }
+      break;
+    }
+    case DELTA_STATE_SKIP: {
+      size_t k = dest_end - dest;
+      if (k > count) {
+        k = count;
+      }
+      dest += k;
+      count -= k;
+      if (count > 0) {
+        goto done;
+      }
+      state = DELTA_STATE_RUN;
+      break;
+    }
+    case DELTA_STATE_LITERAL: {
+      size_t k = dest_end - dest;
+      if (k > count) {
+        k = count;
+      }
+      if (k > (size_t)(src_end - src)) {
+        k = src_end - src;
+      }
+      count -= k;
+      for (; k > 0; k--) {
+        *dest++ ^= *src++;
+      }
+      if (count > 0) {
+        goto done;
+      }
+      state = DELTA_STATE_RUN;
+      break;
+    }
+    case DELTA_STATE_REPEAT_VALUE:
+      if (src == src_end) {
+        goto done;
+      }
+      decoder->value = *src++;
+      state = DELTA_STATE_REPEAT;
+      break;
+    case DELTA_STATE_REPEAT: {
+      uint8_t value = decoder->value;
+      size_t k = dest_end - dest;
+      if (k > count) {
+        k = count;
+      }
+      count -= k;
+      for (; k > 0; k--) {
+        *dest++ ^= value;
+      }
+      if (count > 0) {
+        goto done;
+      }
+      state = DELTA_STATE_RUN;
+      break;
+    }
+    }
+  }
+
+done:
+  decoder->dest = dest;
+  decoder->state = state;
+  decoder->count = count;
+  return src - src_start;
+}
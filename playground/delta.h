@@ -0,0 +1,59 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// XOR-delta run-length codec for 1bpp frames. A delta is applied to a destination holding the
+// previous frame and is a sequence of runs over the destination's bytes in memory order:
+//
+//   0nnnnnnn              Skip n + 1 unchanged bytes
+//   10nnnnnn b[n + 1]     XOR the next n + 1 bytes with b[]
+//   11nnnnnn b            XOR the next n + 1 bytes with b
+//
+// Trailing unchanged bytes may be omitted. A key frame is simply a delta against a cleared
+// destination. tools/delta.py is the encoder.
+//
+// The decoder is a streaming state machine. Data may be passed in chunks of any size, split
+// anywhere, and is decoded directly into the destination. The destination may also be supplied in
+// parts, e.g. a row at a time, with runs continuing from one part into the next. This module has no
+// dependency on the Pico SDK so that it can also be built on the host (see tools/loopback).
+
+typedef enum {
+  DELTA_STATE_RUN,          // Expecting a run header
+  DELTA_STATE_SKIP,         // Inside a skip run
+  DELTA_STATE_LITERAL,      // Inside a literal run
+  DELTA_STATE_REPEAT_VALUE, // Expecting the byte of a repeat run
+  DELTA_STATE_REPEAT,       // Inside a repeat run
+} delta_state_t;
+
+typedef struct {
+  uint8_t *dest, *dest_end;
+  delta_state_t state;
+  unsigned count; // Bytes remaining in the current run
+  uint8_t value;  // Byte of the current repeat run
+} delta_decoder_t;
+
+// Start decoding a delta into size bytes at dest.
+void delta_decoder_init(delta_decoder_t *decoder, uint8_t *dest, size_t size);
+
+// Continue decoding into size bytes at dest, keeping any run in progress.
+static inline void delta_decoder_set_dest(delta_decoder_t *decoder, uint8_t *dest, size_t size) {
+  decoder->dest = dest;
+  decoder->dest_end = dest + size;
+}
+
+// Decode up to n bytes of a delta, stopping early if the destination is filled. Returns the number
+// of bytes consumed. When decoding a whole frame, fewer than n bytes consumed means that the delta
+// runs past the end of the frame.
+size_t delta_decode(delta_decoder_t *decoder, const uint8_t *src, size_t n);
+
+// Return true once the destination has been filled.
+static inline bool delta_decoder_full(const delta_decoder_t *decoder) {
+  return decoder->dest == decoder->dest_end;
+}
+
+// Return true if the decoder is between runs, i.e. the delta so far is complete.
+static inline bool delta_decoder_idle(const delta_decoder_t *decoder) {
+  return decoder->state == DELTA_STATE_RUN;
+}
@@ -1,1710 +0,0 @@
-unsigned char family[] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb6, 0xdb, 0x6d, 0xb6,
-  0xdb, 0x6d, 0xb6, 0xdb, 0x6d, 0xb5, 0x6f, 0x76, 0xdb, 0x6d, 0xb6, 0xdb,
-  0x6d, 0xbf, 0xfd, 0xdd, 0xb6, 0xdb, 0x6d, 0xb6, 0xdb, 0x6d, 0xb6, 0xdb,
-  0x6d, 0xb6, 0xdb, 0xbb, 0xbb, 0xbd, 0xef, 0x7f, 0xff, 0xff, 0xff, 0xff,
-  0xef, 0x7d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x7f, 0xbe, 0xfb, 0xef, 0xbe, 0xff, 0xff, 0xff,
-  0xff, 0x7f, 0xfb, 0xdf, 0xff, 0xff, 0xff, 0xf7, 0xdf, 0xeb, 0x5f, 0x77,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe,
-  0xff, 0xef, 0x7b, 0xd6, 0xb6, 0xdb, 0x6d, 0xb7, 0xfb, 0xdf, 0x55, 0xad,
-  0x6d, 0xb6, 0xdb, 0x6d, 0xb6, 0xdb, 0x6d, 0xb6, 0xdb, 0x6d, 0xb6, 0xdb,
-  0x6d, 0xb7, 0x6e, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee,
-  0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xee, 0xed, 0xb6, 0xdb, 0x6d,
-  0xd5, 0xf7, 0xdf, 0x7d, 0xf7, 0xaa, 0xaa, 0xaa, 0xab, 0xdb, 0x7f, 0xfd,
-  0xaa, 0xaa, 0xaa, 0xbe, 0xed, 0x7f, 0xef, 0xfe, 0xdb, 0x6d, 0xb6, 0xdb,
-  0x6d, 0xb6, 0xdb, 0x6d, 0xb6, 0xee, 0xef, 0xef, 0xee, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x7f, 0x5e, 0xf5, 0xd7,
-  0x5e, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xdd, 0xef, 0xff, 0xff, 0xff, 0xeb,
-  0xff, 0xdb, 0xff, 0xbf, 0xff, 0xff, 0x7f, 0xbe, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xbf, 0xbe, 0xfe, 0xfb, 0xef, 0x7b, 0xf7, 0xbb, 0xdf, 0x7f, 0xfb,
-  0xdd, 0xfb, 0xfd, 0xef, 0xb7, 0x77, 0x77, 0x77, 0x77, 0x7b, 0xef, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xf7, 0x77, 0x77, 0x77, 0x77, 0x77,
-  0x77, 0x77, 0xbf, 0x7f, 0x7f, 0xff, 0xff, 0x7f, 0x77, 0xbf, 0x77, 0x77,
-  0x7f, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xbf, 0xff, 0xf7, 0xfb, 0xbb, 0xbb,
-  0xbb, 0xd5, 0xef, 0x7e, 0xfd, 0xee, 0xee, 0xff, 0xb6, 0xff, 0x7b, 0xdb,
-  0x6d, 0xab, 0xb5, 0xf7, 0x6d, 0x5b, 0x6d, 0xb6, 0xdb, 0xfb, 0xf7, 0xb7,
-  0xbf, 0x7b, 0xdf, 0x7b, 0xfe, 0xfb, 0xed, 0xbf, 0xef, 0x7e, 0xde, 0xfd,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0x7d, 0xb6, 0xdb, 0x6d, 0xb6, 0xdb,
-  0x6d, 0xbf, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7,
-  0xdb, 0x6d, 0xb7, 0xf7, 0xff, 0xfb, 0xff, 0xff, 0xf6, 0xdb, 0x6d, 0xb6,
-  0xdd, 0xdd, 0xf6, 0xdb, 0xbd, 0x5e, 0xee, 0xee, 0xef, 0x7f, 0x7f, 0xef,
-  0xbf, 0x7b, 0xbb, 0xb5, 0xef, 0xb5, 0xdf, 0xff, 0xfb, 0xff, 0xff, 0xbf,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xfb, 0xff, 0xfb, 0xff,
-  0xbf, 0xef, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xef, 0xf7, 0x77, 0x77, 0x77,
-  0x7b, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb, 0xfb,
-  0xfb, 0xfb, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xbf,
-  0xfb, 0xdf, 0xfb, 0xfb, 0xdf, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xbf, 0xfd,
-  0xdf, 0xf7, 0xff, 0xff, 0xfb, 0xfb, 0xfb, 0x7b, 0xf7, 0xbf, 0xff, 0xff,
-  0x7d, 0xff, 0xed, 0xb6, 0xdf, 0x7b, 0x6d, 0xf6, 0xdb, 0xdb, 0x6d, 0xb6,
-  0xed, 0xed, 0x5b, 0x76, 0xdf, 0xdb, 0x7f, 0xbb, 0xdb, 0xfd, 0xbd, 0xf7,
-  0xed, 0xf7, 0x77, 0x7f, 0xbb, 0xfb, 0xff, 0xff, 0xdf, 0xdf, 0xed, 0xf7,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xbf, 0xbf, 0xbf, 0xbf, 0xb6, 0xdb,
-  0x6d, 0xbf, 0xbb, 0xfd, 0xff, 0xff, 0xfb, 0xfd, 0xbf, 0xff, 0xbf, 0xbf,
-  0xff, 0xff, 0xfd, 0xfb, 0x6f, 0xad, 0xea, 0xdf, 0xf7, 0x7d, 0x6b, 0x6b,
-  0x6e, 0xaf, 0x6f, 0xdf, 0x7f, 0xed, 0xb5, 0xb7, 0xdb, 0x5a, 0xff, 0xff,
-  0xf7, 0xdf, 0xff, 0x7f, 0xfe, 0xff, 0xff, 0xff, 0xbf, 0xbf, 0xff, 0xdf,
-  0xfb, 0x7f, 0xdd, 0xff, 0xfe, 0xff, 0xf7, 0xbf, 0xff, 0xff, 0xdf, 0xed,
-  0xff, 0x7f, 0x77, 0x77, 0xfd, 0xff, 0x7f, 0x7d, 0xb6, 0xdb, 0x6d, 0xb6,
-  0xdb, 0xff, 0xfd, 0xfd, 0xfd, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xdf,
-  0xb6, 0xdb, 0x7f, 0xdf, 0xfd, 0xed, 0xfd, 0xfd, 0xf6, 0xdb, 0x6f, 0x6e,
-  0xfb, 0xef, 0x7f, 0xf6, 0xbb, 0xaf, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xeb,
-  0xdd, 0xff, 0xff, 0xfa, 0xff, 0xff, 0x6a, 0xd6, 0xba, 0xed, 0xb7, 0xdb,
-  0x6f, 0x6d, 0xb6, 0xdb, 0xfb, 0xf7, 0xdd, 0xf7, 0x7f, 0xfd, 0xff, 0xde,
-  0xff, 0xef, 0xff, 0xff, 0xfb, 0x5d, 0xfd, 0xff, 0xff, 0xdf, 0xfb, 0xfb,
-  0x7f, 0xdb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xdf, 0xdf,
-  0xdf, 0xdf, 0xff, 0xff, 0xff, 0xef, 0xfd, 0xff, 0xff, 0xff, 0xbd, 0xff,
-  0xde, 0xff, 0xdf, 0xdf, 0x7f, 0xff, 0xff, 0xff, 0x6e, 0xfb, 0xda, 0xbf,
-  0xff, 0xfd, 0xb5, 0x6d, 0x6d, 0xdf, 0xf5, 0xbe, 0xf7, 0x6a, 0xb6, 0xbf,
-  0xb6, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xfb, 0xff, 0xff, 0xff,
-  0xbf, 0xde, 0xff, 0xff, 0xdd, 0xb7, 0xdd, 0xf7, 0xb7, 0x7d, 0xbd, 0xdb,
-  0xbf, 0xf7, 0xef, 0x76, 0xdb, 0xf7, 0x7f, 0x7f, 0xde, 0xff, 0xb7, 0xbf,
-  0xdf, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xfe, 0xdb, 0x6d,
-  0xb6, 0xfe, 0xdf, 0xef, 0xff, 0xff, 0xff, 0xed, 0xff, 0xfe, 0xff, 0xff,
-  0xff, 0xfd, 0xfb, 0xff, 0x7f, 0xde, 0xff, 0xeb, 0x6d, 0x6f, 0xff, 0xff,
-  0xfe, 0xea, 0xbf, 0xd7, 0xbf, 0xff, 0xff, 0xed, 0xff, 0xf5, 0x6e, 0xb5,
-  0xb7, 0x6d, 0xaf, 0x6d, 0xbf, 0x6d, 0xb6, 0xed, 0xf6, 0xff, 0xed, 0xbd,
-  0xff, 0xfe, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xed, 0xff, 0x7f, 0xff,
-  0xfe, 0xff, 0xdf, 0xdf, 0xef, 0xff, 0xfb, 0xf6, 0xfd, 0xb6, 0xdb, 0x6d,
-  0xb7, 0xfe, 0xf6, 0xf6, 0xf6, 0xef, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfb,
-  0x6d, 0xb7, 0xde, 0xff, 0xef, 0xef, 0xf6, 0xf7, 0xdb, 0x6f, 0xdf, 0xb7,
-  0xd6, 0xf7, 0xb7, 0x7f, 0xff, 0xfa, 0xdd, 0xad, 0x6f, 0xff, 0xfd, 0xbd,
-  0xeb, 0x6e, 0xb6, 0xff, 0x56, 0xdf, 0xfb, 0xff, 0xfd, 0xff, 0xfd, 0xff,
-  0xef, 0xff, 0xff, 0xbf, 0xbf, 0xee, 0xff, 0xef, 0xb7, 0xbf, 0xdf, 0xf7,
-  0xdd, 0xb7, 0xdf, 0xff, 0xff, 0x77, 0xed, 0xbb, 0x7f, 0xdb, 0xfb, 0xf6,
-  0xff, 0x6d, 0xff, 0xbf, 0xef, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xdf, 0xdf,
-  0xff, 0xff, 0xff, 0xff, 0xfe, 0xdf, 0xef, 0xff, 0xff, 0xfe, 0xff, 0xfe,
-  0xfd, 0xbf, 0xbf, 0xde, 0xff, 0xfe, 0xfd, 0xfe, 0xff, 0x7d, 0xfb, 0xdb,
-  0x56, 0xdf, 0xef, 0xff, 0x7b, 0x5b, 0xef, 0xee, 0xff, 0xf7, 0xbf, 0x5b,
-  0xff, 0xf7, 0x5f, 0xdb, 0x6f, 0x6a, 0xef, 0xdb, 0x7d, 0xb6, 0xdb, 0xfd,
-  0xfb, 0x77, 0x6e, 0xfb, 0xfd, 0xfb, 0xf7, 0xbe, 0xff, 0xfe, 0xf6, 0xdf,
-  0xb7, 0xbe, 0xff, 0xff, 0xdb, 0xff, 0x7e, 0xff, 0xfb, 0xfe, 0xdd, 0xff,
-  0xfe, 0xf7, 0xff, 0xff, 0xff, 0xb7, 0xff, 0xff, 0xbf, 0xfd, 0xb6, 0xdb,
-  0x6f, 0xfb, 0x7f, 0xdf, 0xff, 0xff, 0xf7, 0xb7, 0xff, 0xfb, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x6b, 0xdf, 0x7e, 0xff, 0xff, 0xf6, 0xfa, 0xdb,
-  0xdf, 0xfe, 0xfe, 0xff, 0xb5, 0x7f, 0xeb, 0xfe, 0xea, 0xfd, 0xf5, 0x7f,
-  0xfb, 0xff, 0xbd, 0x7f, 0xef, 0xff, 0xff, 0x6f, 0xbf, 0xff, 0xfb, 0xff,
-  0xbf, 0xbe, 0xfd, 0xfb, 0xef, 0xfb, 0xff, 0xff, 0xff, 0xf7, 0xde, 0xdf,
-  0xfe, 0xfb, 0xdf, 0xdf, 0x6f, 0xef, 0xff, 0xdb, 0x77, 0xde, 0xdb, 0x6d,
-  0xb7, 0xfe, 0xf6, 0xf7, 0xed, 0xb7, 0xff, 0xff, 0xff, 0xef, 0xf6, 0xfb,
-  0x6d, 0xbf, 0xbe, 0xff, 0x6f, 0xff, 0xdb, 0xf7, 0xb6, 0xdb, 0xb6, 0xdb,
-  0xfe, 0xfb, 0xd7, 0xb5, 0xb6, 0xbe, 0xdf, 0xff, 0xfa, 0xd7, 0x6f, 0x55,
-  0xff, 0xed, 0x7d, 0xd7, 0x7f, 0xaf, 0xff, 0xf6, 0xbd, 0xbb, 0xff, 0xdb,
-  0x7d, 0xb6, 0xdb, 0xff, 0xdd, 0xdf, 0x7f, 0xad, 0xf7, 0xef, 0xdf, 0xbf,
-  0xfd, 0xbf, 0xbf, 0xef, 0xda, 0xfd, 0xf7, 0xfa, 0xdf, 0xdf, 0xfb, 0xfb,
-  0xff, 0x7f, 0xed, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd,
-  0xff, 0xff, 0xff, 0xff, 0xf6, 0xff, 0xff, 0xff, 0xff, 0xdb, 0xff, 0xff,
-  0xfe, 0xdd, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xff, 0x77, 0xaf, 0x7e, 0xff,
-  0xff, 0xf7, 0xfb, 0x5a, 0xdf, 0xff, 0xff, 0xff, 0x6e, 0xbf, 0xef, 0x7f,
-  0xdd, 0xfa, 0xbb, 0x5f, 0xef, 0xef, 0x6f, 0xff, 0xdf, 0xff, 0xff, 0x6b,
-  0xf7, 0xf7, 0xdd, 0xff, 0xbd, 0xbb, 0x75, 0xfd, 0xf7, 0xff, 0xf6, 0xff,
-  0xff, 0xbf, 0xfe, 0xdf, 0xf7, 0x7d, 0xef, 0x7f, 0xf7, 0xf6, 0xff, 0xef,
-  0xbd, 0xf7, 0x7b, 0xf7, 0xfb, 0x6f, 0x7f, 0x7f, 0xff, 0xfd, 0xb6, 0xdb,
-  0x7f, 0xfb, 0x7f, 0x7f, 0xff, 0xff, 0xef, 0xb7, 0xf7, 0xff, 0xfb, 0xfb,
-  0xfb, 0xfb, 0xff, 0x7b, 0xbb, 0xfb, 0xf7, 0x6d, 0xb5, 0xbe, 0xdf, 0xff,
-  0xdb, 0x6b, 0xed, 0xb7, 0xf7, 0xdb, 0x7f, 0xed, 0xef, 0xbf, 0xdf, 0xfb,
-  0x7f, 0x7b, 0xfd, 0x6d, 0xed, 0xb7, 0x7b, 0xfd, 0x7e, 0xbd, 0xee, 0xed,
-  0xef, 0xff, 0xff, 0x6f, 0xbf, 0xed, 0xff, 0xff, 0xef, 0xf7, 0x6f, 0xff,
-  0xff, 0xfe, 0xff, 0xdb, 0x7b, 0x7f, 0xbf, 0x7d, 0xff, 0x7f, 0xbf, 0xbe,
-  0xdf, 0xf7, 0xb7, 0xdd, 0xb6, 0xdf, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xdb,
-  0x6d, 0xfe, 0xfb, 0xff, 0x7f, 0xef, 0xbf, 0xde, 0xde, 0xdd, 0xb7, 0xbf,
-  0xfe, 0xfe, 0xdf, 0xff, 0x7f, 0xef, 0xf6, 0xdb, 0x7f, 0xfe, 0xff, 0xfd,
-  0xbf, 0xff, 0xd5, 0xbf, 0x7a, 0xef, 0xf6, 0xdf, 0xeb, 0xfe, 0xd7, 0xff,
-  0xff, 0xfd, 0xdf, 0x7f, 0xdb, 0xef, 0x7f, 0xbf, 0x7b, 0x5b, 0x5b, 0xfe,
-  0xfd, 0xbf, 0xbf, 0x6f, 0xfb, 0x7d, 0xfe, 0xda, 0xdb, 0xb7, 0xf7, 0xff,
-  0xff, 0xf7, 0xed, 0xff, 0xdf, 0xfb, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0x6d, 0xff, 0xbf, 0xff, 0xff, 0xb7, 0xff, 0xfb,
-  0xfb, 0x7d, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xb7, 0xd7, 0xfb, 0x6b,
-  0xdb, 0x7a, 0xbf, 0xff, 0xda, 0xb7, 0xee, 0xaf, 0xed, 0xb6, 0xff, 0xfb,
-  0xdf, 0xfa, 0xbf, 0xfb, 0x7e, 0xd7, 0xff, 0xdb, 0x6d, 0xdf, 0xff, 0xd6,
-  0xff, 0xfb, 0xfb, 0xf7, 0xff, 0xff, 0xfb, 0x6f, 0xff, 0xff, 0xf7, 0xff,
-  0xdf, 0xdf, 0x77, 0xff, 0xff, 0xff, 0x7b, 0x7d, 0xdf, 0xbd, 0xff, 0xb7,
-  0xfb, 0xdf, 0xef, 0xfb, 0xfb, 0x7b, 0xfe, 0xef, 0xff, 0xed, 0xb6, 0xdb,
-  0xff, 0xed, 0xfe, 0xff, 0xff, 0xff, 0xbe, 0xdf, 0xbf, 0xff, 0xef, 0xf7,
-  0xfe, 0xff, 0xbb, 0xed, 0xfd, 0x7d, 0xbf, 0xff, 0x7f, 0xdf, 0xeb, 0x5b,
-  0xff, 0xfe, 0xff, 0xfb, 0x7f, 0xef, 0xdb, 0x5e, 0xfb, 0x6f, 0xed, 0xaf,
-  0xdb, 0xfd, 0x6a, 0xff, 0xff, 0x7d, 0xfb, 0xff, 0xdb, 0x7f, 0x6f, 0xff,
-  0x7f, 0xed, 0xdf, 0xff, 0xb7, 0xed, 0xff, 0xf7, 0xfb, 0xf7, 0xdf, 0x6f,
-  0x7b, 0xbf, 0xff, 0xdf, 0x7b, 0xff, 0x7f, 0xfd, 0xdf, 0x7e, 0xfe, 0xde,
-  0xdf, 0xff, 0x6f, 0xfd, 0xb6, 0xff, 0xff, 0xff, 0xfe, 0xff, 0xdf, 0xdb,
-  0x6f, 0xfb, 0xf7, 0xfd, 0xff, 0xde, 0xfe, 0xfd, 0xb7, 0xdb, 0xfe, 0xff,
-  0x6f, 0xff, 0xed, 0x5b, 0xf6, 0xee, 0xff, 0xfd, 0x6e, 0xd7, 0x7b, 0x5f,
-  0xb5, 0x76, 0xff, 0xf7, 0xdf, 0xf7, 0x7d, 0xfa, 0xff, 0x6f, 0x7f, 0xed,
-  0xb7, 0xef, 0xbe, 0xdd, 0xff, 0xef, 0xfd, 0xb7, 0xb6, 0xff, 0xfd, 0xbd,
-  0xfe, 0xff, 0xbb, 0x7f, 0xdf, 0x7b, 0xfb, 0xfb, 0xdf, 0xed, 0xbb, 0xef,
-  0xfd, 0xef, 0xed, 0xfe, 0xff, 0xef, 0x7f, 0xff, 0xff, 0xdf, 0xf7, 0x7f,
-  0xff, 0x7f, 0xbe, 0xff, 0x6f, 0xff, 0xf7, 0xff, 0xfd, 0xbf, 0xff, 0xff,
-  0xed, 0xef, 0x7f, 0xbf, 0xff, 0xfd, 0xdf, 0x6e, 0xfd, 0xad, 0xbf, 0xfe,
-  0xbf, 0xfb, 0xbb, 0x6f, 0xfb, 0xff, 0xde, 0xf7, 0xff, 0xff, 0xb6, 0xdd,
-  0x75, 0x7d, 0xdf, 0x6f, 0xab, 0xfb, 0xdd, 0xbf, 0xfe, 0xfd, 0xff, 0xf7,
-  0xbb, 0x7b, 0xbf, 0xff, 0xff, 0xff, 0x6f, 0x77, 0xff, 0xff, 0xff, 0xff,
-  0xf5, 0xfe, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xff, 0xbf, 0xbf, 0xff, 0xbf,
-  0xef, 0xff, 0xdb, 0xef, 0xdb, 0x7b, 0xff, 0xef, 0xbf, 0xed, 0xf7, 0xdb,
-  0xff, 0x6d, 0xfd, 0xff, 0xf7, 0xfd, 0xbd, 0xbf, 0x7f, 0xff, 0xef, 0xfe,
-  0xfb, 0x7f, 0xff, 0xff, 0x6f, 0xff, 0xed, 0xef, 0xf6, 0xdf, 0xdf, 0xff,
-  0x5f, 0xb7, 0xff, 0xbd, 0xb7, 0x6d, 0xff, 0xff, 0xff, 0x6f, 0xeb, 0xfb,
-  0xfe, 0xbd, 0xef, 0xed, 0xb7, 0x6f, 0xbf, 0xff, 0xff, 0xff, 0xee, 0xfb,
-  0xbb, 0xbf, 0xfb, 0xff, 0xb7, 0x6d, 0xdf, 0xef, 0x7f, 0xdf, 0xdb, 0x6f,
-  0x7e, 0xef, 0xbb, 0x7b, 0xdf, 0xfd, 0xbf, 0xef, 0xf6, 0xf7, 0xff, 0x7e,
-  0xff, 0xff, 0x7b, 0xfd, 0xf7, 0xff, 0xff, 0xff, 0xfb, 0xff, 0xbf, 0xdb,
-  0x7f, 0xef, 0xff, 0xf7, 0xfe, 0xf7, 0xfb, 0xb7, 0xdf, 0xde, 0xdb, 0xf6,
-  0xfb, 0x6a, 0xff, 0x7b, 0x5f, 0xfb, 0xf6, 0xd7, 0xf5, 0xfd, 0xda, 0xef,
-  0xfd, 0xff, 0x5b, 0xad, 0xb7, 0xfb, 0x7f, 0x7e, 0xf7, 0xef, 0x7b, 0xff,
-  0xff, 0xfd, 0xfd, 0xb5, 0xbb, 0xbb, 0xff, 0xbf, 0xfe, 0xfb, 0xb7, 0x7d,
-  0xff, 0xff, 0xfb, 0x7f, 0xfd, 0xf7, 0x7f, 0xfb, 0xef, 0xfb, 0xff, 0xef,
-  0xfb, 0xef, 0xf7, 0xfd, 0xff, 0xde, 0xfd, 0xf7, 0xff, 0xdf, 0xff, 0x7f,
-  0xfe, 0xfe, 0xfb, 0xfd, 0xbf, 0xff, 0xfe, 0xff, 0xfd, 0xff, 0xdf, 0xdf,
-  0xb7, 0xfe, 0xff, 0xff, 0x7f, 0xfb, 0xfe, 0xdf, 0xdf, 0xff, 0xdb, 0xdf,
-  0xfa, 0xdd, 0xbf, 0xfb, 0x7f, 0x6f, 0xfe, 0xed, 0x6f, 0x6b, 0xff, 0xff,
-  0xfe, 0xdf, 0xfb, 0xef, 0xbe, 0xff, 0xde, 0xb6, 0xee, 0xee, 0xdf, 0xbf,
-  0xfd, 0xfd, 0xbb, 0xee, 0xef, 0xff, 0xfb, 0xef, 0xfb, 0xfe, 0xff, 0xff,
-  0xef, 0x7f, 0xff, 0x7f, 0xff, 0x7f, 0xdf, 0xff, 0xfe, 0xff, 0xfe, 0xff,
-  0xbf, 0xff, 0xdf, 0xff, 0x6d, 0xfd, 0xdf, 0xf7, 0xdf, 0x6f, 0xdf, 0x6f,
-  0xdf, 0x6d, 0xef, 0xff, 0xdf, 0x7d, 0xed, 0xfb, 0xff, 0xbf, 0xde, 0xff,
-  0xf6, 0xff, 0xff, 0xff, 0xf6, 0xdd, 0x7e, 0xfb, 0xbf, 0xff, 0xeb, 0x7f,
-  0xdd, 0xfd, 0xfd, 0xbf, 0xff, 0xff, 0x6d, 0xd6, 0xb7, 0xfb, 0x5e, 0xfb,
-  0xf7, 0xeb, 0x7b, 0xff, 0xbb, 0xff, 0xff, 0xed, 0xbf, 0xbf, 0xef, 0xfb,
-  0xff, 0x7f, 0xbe, 0xfe, 0xdf, 0x6f, 0xdf, 0xbf, 0x7f, 0xf7, 0xb7, 0xfd,
-  0xf7, 0xfd, 0xfb, 0xfb, 0xbf, 0xfb, 0xff, 0xef, 0xed, 0xf7, 0xff, 0x7b,
-  0xff, 0xef, 0xf7, 0xbd, 0xff, 0xff, 0x7d, 0xff, 0xfb, 0xff, 0xbf, 0x6d,
-  0xff, 0xdf, 0xff, 0xff, 0xfd, 0xf7, 0x7b, 0xb7, 0xff, 0xbd, 0xb7, 0xed,
-  0xbf, 0xef, 0xb7, 0xdd, 0xdb, 0x6b, 0x7f, 0xd6, 0xef, 0xae, 0xdd, 0xf6,
-  0xda, 0xdb, 0xff, 0xf7, 0xfe, 0xdf, 0xff, 0x5d, 0xbb, 0xff, 0xdf, 0xbb,
-  0xff, 0xb6, 0xfb, 0x7f, 0xef, 0xee, 0xfd, 0xbf, 0xbb, 0xfd, 0xf7, 0x6f,
-  0xff, 0xf7, 0xfb, 0xef, 0xfb, 0x7b, 0xfb, 0xdf, 0x7f, 0xdf, 0xfd, 0xbf,
-  0xff, 0xff, 0xb7, 0xfd, 0xff, 0x7f, 0x77, 0xbf, 0xff, 0x7e, 0xfd, 0xfe,
-  0xf7, 0xf7, 0xff, 0xfd, 0xff, 0xff, 0xf7, 0xfe, 0xfb, 0xfe, 0xfe, 0xdf,
-  0x6f, 0xff, 0xff, 0xfe, 0xdf, 0xdf, 0xfb, 0x7f, 0xed, 0xff, 0xfd, 0xff,
-  0xff, 0xff, 0xed, 0xff, 0xfd, 0xff, 0xfe, 0xdf, 0xff, 0xfe, 0xb6, 0xfd,
-  0xb7, 0xf6, 0xd7, 0xff, 0xfe, 0xed, 0xf7, 0xef, 0x7b, 0xff, 0xbf, 0xd5,
-  0xfb, 0x7f, 0xff, 0xfd, 0xff, 0xbf, 0xbf, 0xff, 0xef, 0xfe, 0xff, 0xff,
-  0xbf, 0xff, 0xff, 0x7f, 0xfb, 0xfe, 0xff, 0xff, 0xee, 0xde, 0xfe, 0xff,
-  0xff, 0xfb, 0xff, 0xfe, 0xdb, 0xf7, 0xff, 0xdf, 0xde, 0xff, 0xdf, 0x6f,
-  0xbd, 0xb7, 0xff, 0xff, 0xdf, 0xef, 0xdf, 0xfb, 0xfe, 0xf7, 0xdf, 0xdf,
-  0xf7, 0xfd, 0xdf, 0xf7, 0x7e, 0xda, 0xde, 0xb6, 0xdb, 0x5b, 0x7e, 0xdb,
-  0x6e, 0xef, 0x76, 0xfb, 0x6d, 0xb7, 0xff, 0x6f, 0xbd, 0xbf, 0xfd, 0xdb,
-  0x6f, 0xfe, 0xbe, 0xff, 0xdd, 0xbb, 0xfd, 0xfe, 0xbf, 0xfb, 0xb6, 0xef,
-  0xdb, 0xff, 0xf5, 0x76, 0xfb, 0x7f, 0xef, 0x7f, 0xef, 0xbd, 0xbf, 0xfb,
-  0xbe, 0xef, 0xdf, 0xdb, 0x7f, 0xf7, 0xff, 0xee, 0xdb, 0xbf, 0xbb, 0xef,
-  0xff, 0xff, 0x6f, 0xff, 0xff, 0xbd, 0xf7, 0xff, 0xdf, 0xfb, 0x7b, 0x6f,
-  0xfe, 0xf7, 0xf7, 0xff, 0xff, 0xbe, 0xfd, 0xf6, 0xfe, 0xef, 0xff, 0x7d,
-  0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xff, 0xbd, 0xfd, 0xbf,
-  0xff, 0xfe, 0xdf, 0xfb, 0xef, 0xeb, 0x77, 0x7f, 0xfb, 0xb7, 0xef, 0xb6,
-  0xff, 0xef, 0xbf, 0x77, 0xed, 0xbe, 0xff, 0xbd, 0xff, 0xfe, 0xdf, 0xff,
-  0xff, 0xef, 0x7d, 0xff, 0xfb, 0xef, 0xed, 0xdf, 0xef, 0xfd, 0xf6, 0xff,
-  0xee, 0xff, 0x6e, 0xff, 0xff, 0xfd, 0xff, 0x7f, 0xdd, 0xbf, 0xfd, 0xed,
-  0xf7, 0xef, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfd, 0xef, 0xfe, 0xfe, 0xdd,
-  0xb7, 0xfb, 0xef, 0xff, 0xdb, 0xfd, 0xed, 0xff, 0x7b, 0x6d, 0xbf, 0xda,
-  0xd5, 0xb6, 0xf5, 0xb6, 0xdb, 0xdf, 0xdf, 0xea, 0xb6, 0xb7, 0xf7, 0x5d,
-  0x7b, 0x7f, 0xbf, 0xed, 0xbf, 0xfb, 0x7b, 0xff, 0xee, 0xfd, 0xff, 0xbb,
-  0xff, 0xef, 0xf7, 0xff, 0x7b, 0x7f, 0xfd, 0xde, 0xdf, 0xff, 0xff, 0xdf,
-  0x5e, 0xfb, 0x7e, 0xf6, 0xfb, 0x6f, 0x7f, 0xf6, 0xff, 0x77, 0xff, 0x77,
-  0xdd, 0xef, 0xdf, 0xf6, 0xff, 0xfb, 0xfe, 0xff, 0x7d, 0xff, 0xbd, 0xbd,
-  0xed, 0xbf, 0xdf, 0xfe, 0xf7, 0x7f, 0xbf, 0xff, 0xfd, 0xff, 0xfe, 0xdf,
-  0xff, 0xbf, 0x7f, 0xb7, 0xdf, 0xff, 0xea, 0xff, 0xff, 0xff, 0xdf, 0xff,
-  0xfe, 0xff, 0x7a, 0xbf, 0xff, 0xfd, 0xbd, 0xf7, 0xef, 0xed, 0xf6, 0xff,
-  0xed, 0xdf, 0xde, 0xdb, 0x7b, 0xf7, 0xef, 0xfe, 0xf7, 0x7d, 0xbd, 0xdf,
-  0xdf, 0xef, 0xb7, 0x7b, 0xf6, 0xf7, 0xbf, 0xff, 0xf7, 0xbf, 0xef, 0xdf,
-  0xbf, 0xff, 0xee, 0xdf, 0xb7, 0xff, 0x6f, 0xfe, 0xff, 0x7f, 0xf7, 0xff,
-  0xef, 0xde, 0xdf, 0xff, 0xff, 0xf6, 0xf7, 0xff, 0xff, 0xf6, 0xfb, 0x6f,
-  0xff, 0xef, 0xf7, 0xef, 0xff, 0xbe, 0xef, 0xf6, 0xfd, 0xf7, 0xf7, 0xff,
-  0xed, 0xb6, 0xff, 0x6d, 0xbd, 0xb6, 0xfe, 0xd6, 0xb7, 0xdb, 0xff, 0xff,
-  0xb5, 0xaf, 0xff, 0xbf, 0x7b, 0x7f, 0xbf, 0xdb, 0x7f, 0xf6, 0xef, 0xff,
-  0xff, 0xbf, 0x7a, 0xd7, 0xbf, 0xef, 0xff, 0xed, 0xfd, 0xfb, 0xff, 0xff,
-  0xff, 0x7b, 0xf6, 0xff, 0xfb, 0xdb, 0x7b, 0xfb, 0xef, 0x76, 0xf7, 0xff,
-  0xff, 0xbb, 0xfb, 0xff, 0xef, 0xfe, 0xfe, 0xdf, 0xfe, 0xff, 0xff, 0xdb,
-  0xdf, 0x7f, 0xff, 0xef, 0x7f, 0xff, 0xff, 0xff, 0xfb, 0xfb, 0xfe, 0xfb,
-  0x6f, 0xf7, 0xfe, 0xff, 0x6f, 0xff, 0x7d, 0xdd, 0x7f, 0xff, 0xbf, 0xff,
-  0xef, 0xff, 0xd7, 0xff, 0xfe, 0xff, 0xb6, 0xaa, 0xff, 0xfb, 0x5e, 0xeb,
-  0xff, 0xdb, 0xed, 0x7f, 0xef, 0xff, 0xbb, 0xb6, 0xbb, 0xfb, 0xff, 0xfd,
-  0xf7, 0x7d, 0xbd, 0xff, 0xdf, 0xff, 0xb5, 0xde, 0xff, 0xff, 0xdf, 0xdf,
-  0x7e, 0xff, 0xfe, 0xff, 0xfb, 0xff, 0xfe, 0xed, 0xdb, 0xff, 0xfe, 0xdf,
-  0x7f, 0xb7, 0xfb, 0xf6, 0xf7, 0xef, 0xdb, 0x7f, 0xfb, 0xff, 0xbd, 0xfd,
-  0xed, 0xbf, 0x7f, 0xf6, 0xdf, 0x7e, 0xfb, 0xff, 0xfd, 0xdf, 0x77, 0xdf,
-  0xfe, 0xdb, 0xff, 0xf7, 0xed, 0xad, 0xf6, 0xdb, 0x76, 0xd6, 0xfe, 0xdb,
-  0xb7, 0x6f, 0xff, 0xff, 0xdd, 0xbf, 0xef, 0xff, 0x5a, 0xfb, 0x7f, 0xdb,
-  0x7d, 0xb5, 0xfd, 0xff, 0xde, 0xdd, 0xff, 0x6f, 0xfb, 0xff, 0xee, 0xee,
-  0xee, 0xfd, 0xfe, 0xff, 0xb7, 0xbd, 0xff, 0xff, 0xaf, 0xed, 0xaf, 0xb6,
-  0xbf, 0xdb, 0xbf, 0xff, 0xfe, 0xee, 0xdf, 0xfb, 0xed, 0xff, 0xdf, 0xff,
-  0x7f, 0xfe, 0xff, 0xff, 0x7f, 0xdb, 0xff, 0x7f, 0xff, 0xf7, 0xdb, 0x7f,
-  0xff, 0xff, 0xdf, 0xdf, 0xff, 0xff, 0xff, 0xfb, 0xef, 0xff, 0xb7, 0x7e,
-  0xff, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xdb, 0xfe, 0xff, 0xfb, 0xeb, 0x77,
-  0x77, 0xed, 0xfd, 0x6b, 0xff, 0xdf, 0xdb, 0xff, 0xdf, 0xff, 0x6f, 0xbb,
-  0xfb, 0xff, 0x77, 0xfa, 0xdf, 0x6f, 0xbf, 0xff, 0xff, 0xff, 0xbf, 0xef,
-  0xff, 0xff, 0xf6, 0xff, 0xfb, 0x7f, 0xfd, 0xff, 0xf6, 0xfe, 0xee, 0xee,
-  0xff, 0xbf, 0xf7, 0xef, 0xff, 0xdb, 0x7e, 0xff, 0xfb, 0x77, 0xff, 0xdb,
-  0xee, 0xff, 0xdf, 0xdf, 0x7f, 0xdf, 0xff, 0xff, 0xef, 0x6f, 0x7e, 0xfb,
-  0x6e, 0xf7, 0x7b, 0xef, 0x7e, 0xfd, 0xff, 0xff, 0xb6, 0xed, 0xda, 0xd6,
-  0xdb, 0x76, 0xff, 0xb7, 0xed, 0xbf, 0x7f, 0xbb, 0xfe, 0xff, 0xbf, 0xff,
-  0x6e, 0xfd, 0xff, 0x6d, 0xf7, 0xdb, 0xff, 0xdf, 0x7e, 0xef, 0xfb, 0x5f,
-  0xff, 0xfd, 0xff, 0xbb, 0xf6, 0xff, 0xeb, 0x7d, 0xfd, 0xef, 0x7f, 0xdf,
-  0xff, 0xee, 0xef, 0xdb, 0xff, 0xdf, 0xff, 0x7f, 0xb7, 0xf6, 0xfe, 0xfe,
-  0xef, 0xff, 0xef, 0xdb, 0xdf, 0xff, 0x6d, 0xff, 0xff, 0xfd, 0xfb, 0xf7,
-  0xed, 0xfb, 0x7f, 0xb6, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xde, 0xff,
-  0xef, 0xdf, 0xfb, 0xb7, 0xff, 0xbf, 0xff, 0xff, 0xff, 0xdf, 0xdb, 0xfe,
-  0xff, 0xfb, 0xf5, 0xfe, 0xdb, 0xb5, 0xee, 0xb5, 0xfb, 0xaf, 0x6d, 0xff,
-  0x7e, 0xfe, 0xb6, 0xfb, 0xdf, 0xbb, 0xff, 0xfb, 0x6d, 0xb7, 0xdb, 0xee,
-  0xff, 0xfd, 0xff, 0xef, 0x6f, 0xff, 0xff, 0xfe, 0xb6, 0xfb, 0xfd, 0xfe,
-  0xdb, 0xf7, 0xb7, 0xef, 0xff, 0xff, 0xfb, 0xff, 0xfd, 0xff, 0xfe, 0xff,
-  0xff, 0xbf, 0xff, 0xfd, 0xf7, 0xbf, 0xef, 0xff, 0xff, 0xff, 0xed, 0xff,
-  0xff, 0xf7, 0xef, 0x7f, 0xf7, 0x77, 0xff, 0xfb, 0xff, 0xfe, 0xdf, 0xfe,
-  0xb5, 0xed, 0xb7, 0x6d, 0xb6, 0xf6, 0xfd, 0xb7, 0x5b, 0x5f, 0xff, 0x6f,
-  0xff, 0xff, 0x7f, 0xff, 0xdf, 0xfb, 0xff, 0xb7, 0xb7, 0xf7, 0xff, 0xff,
-  0xf7, 0xff, 0x7e, 0xdf, 0xff, 0xff, 0xfe, 0xff, 0xdf, 0x7f, 0x6d, 0xff,
-  0xff, 0x7b, 0xf6, 0xff, 0xff, 0xbf, 0xbe, 0xdf, 0xfe, 0xfd, 0xff, 0xfd,
-  0xdd, 0xbf, 0xbf, 0x77, 0x7f, 0xb6, 0xff, 0xfe, 0xfb, 0xfb, 0xfe, 0xdf,
-  0x7f, 0xde, 0xfe, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xdb,
-  0x7f, 0xfd, 0xf7, 0xbf, 0xf6, 0xef, 0xfd, 0xff, 0xff, 0xff, 0xfd, 0xff,
-  0xff, 0xff, 0xbf, 0xff, 0xff, 0xfd, 0xbb, 0xfb, 0x6d, 0xbb, 0xed, 0xb6,
-  0xfb, 0x7e, 0xdb, 0xfd, 0xff, 0x7d, 0xb7, 0x5b, 0x7d, 0xdd, 0xf7, 0xf7,
-  0x77, 0xbb, 0x6f, 0xfe, 0xf7, 0xff, 0xfb, 0xbb, 0xf7, 0xef, 0x7f, 0xdf,
-  0xb7, 0xfb, 0xef, 0xf7, 0x7f, 0xbf, 0xf6, 0xef, 0xff, 0xed, 0xff, 0xff,
-  0xef, 0xff, 0xdf, 0x6f, 0xdf, 0xdf, 0xbf, 0xff, 0xfd, 0xff, 0xff, 0xdb,
-  0xef, 0xde, 0xff, 0xbb, 0x77, 0xff, 0xf7, 0xff, 0xff, 0xbf, 0xff, 0xfd,
-  0xbf, 0xff, 0xff, 0xb7, 0xee, 0xdb, 0x6f, 0xb6, 0xdb, 0x5b, 0xeb, 0x6d,
-  0xdb, 0x7f, 0xff, 0x5f, 0xff, 0xdf, 0x7f, 0xf7, 0xdf, 0xd7, 0xfd, 0x6f,
-  0xef, 0xaf, 0xfb, 0xff, 0xdf, 0xef, 0xfd, 0xbb, 0xfd, 0xff, 0xf7, 0xb7,
-  0xfb, 0xee, 0xdd, 0xff, 0x7b, 0xff, 0xbf, 0xff, 0xfe, 0xde, 0xff, 0xff,
-  0xdb, 0xef, 0xbf, 0xfe, 0xed, 0xff, 0xb7, 0xbf, 0xfd, 0xff, 0xf7, 0xff,
-  0xff, 0xff, 0xef, 0xef, 0xff, 0xef, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xff,
-  0xff, 0xef, 0xff, 0xff, 0xdb, 0xff, 0x76, 0xef, 0xff, 0x6d, 0xad, 0xfb,
-  0xfb, 0xff, 0xfd, 0xff, 0xff, 0xfe, 0xff, 0xff, 0x7f, 0xdf, 0xb5, 0xf6,
-  0xdb, 0x7b, 0xf6, 0xbd, 0x76, 0xfe, 0xdf, 0xfd, 0x7f, 0xfa, 0xbf, 0xdb,
-  0xf6, 0xfd, 0xff, 0xff, 0x7f, 0xbb, 0xfe, 0xff, 0x7f, 0x7f, 0xff, 0xdf,
-  0xff, 0x7f, 0xf6, 0xff, 0x6f, 0xff, 0xda, 0xdb, 0xff, 0xfb, 0xfb, 0x77,
-  0xff, 0xff, 0xff, 0xf7, 0xff, 0xdf, 0xff, 0xfb, 0xfb, 0xfb, 0xff, 0xfd,
-  0xbf, 0xfe, 0xdf, 0xff, 0xff, 0xef, 0x7f, 0xdf, 0xbb, 0x7b, 0x76, 0xdb,
-  0x7f, 0xb7, 0xdf, 0xbd, 0xd7, 0xff, 0xff, 0x7e, 0xbe, 0xdb, 0x6f, 0xb6,
-  0xb6, 0xef, 0xdd, 0xb7, 0xf6, 0xed, 0xff, 0x7f, 0xff, 0xdd, 0xbf, 0xdf,
-  0xff, 0x77, 0xf7, 0x6f, 0xed, 0xff, 0xde, 0xff, 0x7f, 0x7f, 0xbd, 0xab,
-  0xb7, 0xfd, 0xbf, 0xbb, 0xdf, 0xff, 0xb6, 0xfb, 0xbf, 0xfb, 0xff, 0xff,
-  0xf5, 0xb6, 0xff, 0xff, 0xbb, 0x7d, 0xbf, 0xff, 0x7f, 0x6d, 0xfd, 0xfd,
-  0xdf, 0xf6, 0xff, 0xff, 0xbf, 0xbf, 0xf6, 0xff, 0xee, 0xff, 0xfa, 0xdb,
-  0x6a, 0xf7, 0xba, 0xfd, 0xff, 0xff, 0xbf, 0xff, 0xed, 0xfd, 0xfb, 0xfe,
-  0xfb, 0x6d, 0x77, 0xaf, 0xef, 0xff, 0xfb, 0xff, 0xff, 0xbb, 0x77, 0xfd,
-  0xbf, 0xff, 0xdb, 0xdb, 0x6d, 0xff, 0xf6, 0xf7, 0x6f, 0xdd, 0xbd, 0xfe,
-  0xff, 0x5b, 0xf7, 0xdb, 0xf7, 0xdb, 0xf7, 0xff, 0xfd, 0xbf, 0xef, 0xef,
-  0x77, 0xed, 0xff, 0xef, 0xf7, 0xbf, 0x7f, 0x7f, 0x7f, 0xff, 0xde, 0xf6,
-  0xff, 0xff, 0xff, 0xbf, 0xdb, 0xff, 0x6f, 0xff, 0xf6, 0xff, 0xb6, 0xbd,
-  0xfb, 0xfb, 0x7f, 0xbf, 0xff, 0xb7, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xdf,
-  0xb7, 0x6f, 0xf6, 0xdb, 0xff, 0xb7, 0xbe, 0xdf, 0xff, 0xff, 0xdf, 0xfb,
-  0xfb, 0x6d, 0xbf, 0x6d, 0xdb, 0xff, 0xfe, 0xdf, 0xdb, 0x7f, 0xfe, 0xff,
-  0xfe, 0xdb, 0x7f, 0xbb, 0xfd, 0xff, 0xff, 0xb7, 0x6f, 0xfd, 0x7d, 0xff,
-  0xbf, 0xfd, 0xfd, 0xbb, 0x6f, 0xb6, 0xf6, 0xff, 0xfd, 0x7f, 0xb5, 0xfd,
-  0xfb, 0xdf, 0xf7, 0xbf, 0xbd, 0xdb, 0xef, 0xbf, 0xef, 0x6f, 0xed, 0xfb,
-  0xff, 0xbf, 0xff, 0xb7, 0x7f, 0xf7, 0xff, 0xef, 0xdd, 0xdf, 0xbb, 0xf5,
-  0xbb, 0xfd, 0xee, 0xfb, 0xbf, 0xbd, 0xef, 0xfb, 0xfb, 0xf6, 0xff, 0xff,
-  0x6d, 0xfd, 0xef, 0xf7, 0x5b, 0x6d, 0xfd, 0xbf, 0xbf, 0xff, 0xed, 0xff,
-  0x7e, 0xdb, 0xbb, 0xf7, 0xff, 0xdb, 0x6b, 0xad, 0x6f, 0xff, 0xf6, 0xfe,
-  0xaf, 0x6d, 0xad, 0xff, 0xff, 0xdf, 0xdf, 0xbb, 0xf6, 0xef, 0xff, 0xef,
-  0xfd, 0xff, 0xff, 0xed, 0xdf, 0xf7, 0xff, 0x7f, 0xbf, 0xfb, 0xbf, 0xff,
-  0xef, 0xfe, 0xff, 0xfb, 0xbd, 0xfd, 0xbf, 0xdf, 0xfd, 0xef, 0xf6, 0xfd,
-  0xf7, 0x7d, 0xdb, 0xfd, 0xff, 0x7b, 0xfe, 0xdf, 0xef, 0xbf, 0xff, 0xbf,
-  0xed, 0xef, 0x7b, 0x6f, 0x7f, 0xbf, 0xbb, 0x77, 0xff, 0xbf, 0xfb, 0x7d,
-  0xff, 0xff, 0x6f, 0xed, 0xdb, 0x6b, 0x7f, 0xb7, 0xef, 0xfd, 0xdf, 0x7d,
-  0x76, 0xff, 0xff, 0xff, 0xf7, 0x6d, 0xbf, 0xd7, 0xfb, 0xfd, 0xfe, 0xd5,
-  0x6a, 0xf6, 0xfb, 0xdd, 0xbf, 0x7f, 0x7f, 0x7b, 0x6f, 0xf7, 0x5b, 0x7f,
-  0xf7, 0xbd, 0xb7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xdf, 0xed, 0xbf,
-  0xff, 0xff, 0xff, 0xfe, 0xdf, 0xfd, 0xbf, 0xdf, 0x7b, 0xdf, 0xfe, 0xde,
-  0xef, 0xff, 0xef, 0xfe, 0xfd, 0xf7, 0x77, 0xee, 0xff, 0xff, 0xff, 0xff,
-  0xdd, 0xfb, 0xdf, 0xfb, 0x77, 0xed, 0xbf, 0xdf, 0xed, 0xb7, 0xf6, 0xff,
-  0xff, 0xff, 0xed, 0xfd, 0xbb, 0x7f, 0xfd, 0xdf, 0xdf, 0xef, 0xba, 0xee,
-  0xfd, 0xff, 0xf6, 0xfd, 0xde, 0xb7, 0x6f, 0xff, 0xff, 0xbf, 0xbf, 0xff,
-  0xf7, 0xf7, 0xed, 0xff, 0xfd, 0xbd, 0xff, 0xee, 0xfd, 0xff, 0xfd, 0xb7,
-  0xed, 0xbf, 0xed, 0xde, 0xef, 0xf7, 0x7f, 0xfd, 0xef, 0x6f, 0xdb, 0x6f,
-  0xff, 0xf7, 0xff, 0x7f, 0xff, 0x7d, 0xdf, 0xff, 0xfb, 0xbb, 0x7f, 0x77,
-  0xff, 0xbf, 0xde, 0xfb, 0xed, 0xb7, 0x6e, 0xf7, 0xff, 0xdf, 0xfd, 0xbf,
-  0xfd, 0xff, 0xf7, 0xf6, 0xff, 0xfd, 0xbf, 0xb7, 0xed, 0xbb, 0x7f, 0x6f,
-  0xff, 0xee, 0xef, 0xfb, 0xfb, 0x7b, 0xff, 0x77, 0x5f, 0xb6, 0xfe, 0xde,
-  0xf7, 0xff, 0xf6, 0xb7, 0x5b, 0xf5, 0xf6, 0xf7, 0x7f, 0xbd, 0xff, 0xef,
-  0x7f, 0xff, 0xf5, 0x77, 0x56, 0xee, 0xef, 0xfe, 0xff, 0xf6, 0xff, 0xff,
-  0x7b, 0x7f, 0xf7, 0xee, 0xff, 0xfd, 0xff, 0xfe, 0xfb, 0x7f, 0xf7, 0xed,
-  0xdf, 0xee, 0xfb, 0xdb, 0xbf, 0xdf, 0xfb, 0xff, 0xb7, 0xfd, 0xff, 0xff,
-  0xff, 0xfb, 0xff, 0xbe, 0xee, 0xfe, 0xef, 0xfd, 0xdf, 0xbd, 0xbd, 0x7f,
-  0xb6, 0xdf, 0xfd, 0xfb, 0xbf, 0xef, 0xdb, 0xfd, 0xdd, 0xbb, 0xfd, 0xde,
-  0xef, 0xff, 0xef, 0xff, 0xf6, 0xff, 0xbb, 0xf7, 0xbd, 0xb5, 0xbf, 0xfd,
-  0xfe, 0xdf, 0x7f, 0xbd, 0xed, 0xf7, 0xfe, 0xfd, 0xee, 0xd5, 0x57, 0x56,
-  0xd5, 0x77, 0x5a, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xef, 0xf7, 0x7d, 0xbf,
-  0xed, 0xf7, 0xff, 0xf7, 0xdf, 0xfd, 0xbf, 0xff, 0x77, 0xff, 0xee, 0xfe,
-  0xfb, 0xfb, 0x6f, 0xbb, 0xfd, 0xdf, 0xee, 0xdd, 0xbe, 0xff, 0x77, 0xf7,
-  0xfb, 0xef, 0xfe, 0xdf, 0x7b, 0xef, 0xff, 0xdd, 0xff, 0xf6, 0xd7, 0xbf,
-  0xf6, 0xfd, 0xfd, 0xde, 0xef, 0xfe, 0xde, 0xef, 0x7d, 0xdf, 0x7b, 0x6d,
-  0xff, 0xb5, 0xff, 0xbb, 0xef, 0xff, 0xed, 0xdf, 0xf7, 0xfb, 0xdb, 0xff,
-  0xff, 0xfe, 0xef, 0xbf, 0xf6, 0xfb, 0x52, 0xab, 0xb5, 0x5a, 0xdb, 0x5b,
-  0x6d, 0xbf, 0x76, 0xfe, 0xff, 0xbf, 0xbf, 0xff, 0x7f, 0xbf, 0x6d, 0xbf,
-  0xff, 0xdf, 0xfd, 0xb7, 0xfb, 0x77, 0xff, 0xff, 0xbe, 0xff, 0xfd, 0xfd,
-  0xbf, 0xf7, 0x7f, 0xff, 0xf7, 0xdf, 0xfe, 0xfb, 0xbf, 0x7b, 0x77, 0xf7,
-  0xfe, 0xff, 0xb7, 0xef, 0xdb, 0x7f, 0xff, 0xed, 0xbf, 0xbf, 0x7f, 0x7f,
-  0xfd, 0xbf, 0xff, 0xff, 0xf7, 0xfb, 0xef, 0xff, 0x6f, 0xff, 0xdd, 0xfe,
-  0xfd, 0xbb, 0x7f, 0x7b, 0x7e, 0xdf, 0x7e, 0xdd, 0xb6, 0xbf, 0xff, 0xed,
-  0x7f, 0x5d, 0xbd, 0x74, 0xed, 0x6f, 0x6d, 0xb7, 0xff, 0xf7, 0xff, 0xff,
-  0xdb, 0xf7, 0xf7, 0xdb, 0xfe, 0xff, 0xff, 0xfd, 0xed, 0xff, 0xef, 0xff,
-  0xbf, 0xfd, 0xbe, 0xdf, 0xff, 0xbd, 0xff, 0xbf, 0xf6, 0xff, 0xef, 0x6f,
-  0xdf, 0x7b, 0xbb, 0xfe, 0xff, 0xff, 0xdf, 0x7f, 0x6f, 0xb5, 0xfd, 0xfd,
-  0xff, 0xdd, 0xed, 0xff, 0xfb, 0xf7, 0xd7, 0xf6, 0xef, 0xdb, 0x6b, 0xb5,
-  0xbf, 0x7f, 0xfa, 0xdb, 0xfd, 0x6e, 0xfe, 0xef, 0x6f, 0xdf, 0xf7, 0xff,
-  0xb7, 0xff, 0xef, 0xef, 0xff, 0xf6, 0xda, 0xfb, 0x55, 0xed, 0xab, 0x5e,
-  0xbb, 0xbb, 0xae, 0xfd, 0x56, 0xff, 0xbf, 0x7f, 0xff, 0x7d, 0xfd, 0xff,
-  0xb7, 0xed, 0xef, 0xde, 0xff, 0xee, 0xff, 0xdd, 0xfd, 0xdf, 0xf7, 0xfb,
-  0xb7, 0xef, 0xb7, 0xef, 0xff, 0xdd, 0xfb, 0xf6, 0xff, 0xff, 0xfe, 0xdf,
-  0xdb, 0x6d, 0xff, 0xbb, 0xfb, 0xff, 0xdf, 0x7e, 0xdd, 0xef, 0x7f, 0x5b,
-  0xbe, 0xdd, 0xfe, 0xdf, 0xbd, 0xff, 0xfe, 0xff, 0xf5, 0xee, 0xff, 0xfe,
-  0xd7, 0xfb, 0xef, 0xbf, 0xfb, 0xfb, 0x7d, 0xb7, 0xfe, 0xd6, 0xfd, 0xfd,
-  0xdf, 0xbf, 0xff, 0xad, 0x56, 0x56, 0xfe, 0xef, 0xfe, 0xee, 0xfb, 0xb7,
-  0xfd, 0xbb, 0xff, 0xfd, 0xb7, 0xdf, 0x7f, 0xff, 0xff, 0xff, 0xbd, 0xff,
-  0xfe, 0xff, 0xfb, 0x7f, 0xdf, 0x7d, 0xdf, 0x6f, 0xfd, 0xfe, 0xfe, 0xfb,
-  0x7e, 0xff, 0xbf, 0xff, 0xef, 0xbb, 0xbf, 0xff, 0xff, 0xff, 0xed, 0xff,
-  0x7f, 0xbd, 0xfd, 0xdf, 0xf7, 0xff, 0xed, 0xff, 0xb7, 0xff, 0x77, 0xfb,
-  0xfe, 0xed, 0xbf, 0xdf, 0x7f, 0xff, 0xab, 0x6f, 0xff, 0xbf, 0x7b, 0xf5,
-  0xbe, 0xdf, 0xef, 0xfd, 0xb7, 0xff, 0x6f, 0xbe, 0xf5, 0xf7, 0x6d, 0xb5,
-  0x6b, 0x55, 0x4b, 0xb5, 0xb6, 0xff, 0xef, 0xfe, 0xdf, 0xdf, 0xdb, 0xff,
-  0xfd, 0xef, 0xed, 0xb6, 0xff, 0x7f, 0xff, 0xff, 0xef, 0xff, 0x7f, 0xed,
-  0xef, 0xdf, 0xff, 0xfb, 0xbf, 0xbf, 0xbf, 0xff, 0xb7, 0xf7, 0xff, 0x7f,
-  0xfd, 0xfd, 0xef, 0x76, 0xef, 0xbf, 0x7f, 0xb7, 0xdd, 0xef, 0x6f, 0xf7,
-  0x7d, 0xbb, 0x7f, 0xdb, 0xfe, 0xdd, 0xfe, 0xdf, 0xb7, 0xff, 0xef, 0x77,
-  0xdd, 0xf7, 0xff, 0xfb, 0x76, 0xef, 0xee, 0xdf, 0xef, 0xf6, 0xbd, 0xb7,
-  0xfe, 0xf7, 0xfd, 0xef, 0xff, 0xbf, 0xf6, 0xd5, 0x55, 0x55, 0x2a, 0xaa,
-  0xbd, 0xaf, 0x7a, 0xb7, 0xfb, 0xf5, 0xff, 0x7e, 0xf7, 0xfd, 0xbf, 0xff,
-  0xb7, 0xed, 0xfe, 0xdb, 0x7f, 0xb7, 0xff, 0xff, 0xff, 0xfd, 0xed, 0xff,
-  0xef, 0xef, 0xee, 0xdf, 0xff, 0x7d, 0xdb, 0xdb, 0x77, 0xdf, 0xfb, 0xff,
-  0xfb, 0xed, 0xef, 0xff, 0xf7, 0xff, 0xfe, 0xfd, 0xff, 0xef, 0xee, 0xff,
-  0xb7, 0xef, 0xb7, 0xfd, 0xff, 0x6e, 0xfb, 0xfd, 0xef, 0x7d, 0xfa, 0xdf,
-  0xbf, 0xfb, 0x7f, 0xfe, 0xf5, 0xbf, 0xff, 0xfd, 0xb7, 0xbf, 0xbf, 0xff,
-  0xdf, 0xfa, 0xb5, 0x2a, 0xaa, 0xaa, 0xa5, 0x55, 0x26, 0xb3, 0xef, 0xde,
-  0xff, 0xff, 0x5f, 0xff, 0xbf, 0x7f, 0xff, 0xdf, 0xfb, 0xff, 0xef, 0xff,
-  0xfb, 0xff, 0xbb, 0x6e, 0xed, 0xde, 0xff, 0xbd, 0xf6, 0xfd, 0xff, 0xed,
-  0xff, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x7f, 0xb7, 0x7d, 0xff, 0xfd, 0xdd,
-  0x7f, 0xbb, 0x77, 0xdf, 0xee, 0xfe, 0xf7, 0xed, 0xfe, 0xfe, 0xfe, 0xdf,
-  0xbb, 0xfb, 0xdf, 0xb7, 0xfb, 0xff, 0x5f, 0xfb, 0xf6, 0xdf, 0xed, 0xdb,
-  0xff, 0xed, 0xad, 0xbf, 0xfe, 0xf6, 0xed, 0xb5, 0xf6, 0xdf, 0xaa, 0xd5,
-  0x2a, 0xaa, 0x94, 0xa5, 0x54, 0x95, 0x5a, 0x6b, 0xbb, 0x7d, 0xf7, 0xff,
-  0xfb, 0xdf, 0xdb, 0x7b, 0xff, 0x7e, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xff, 0xff, 0xee, 0xf7, 0xff, 0xef, 0xef, 0xff, 0x6f, 0xfe, 0xfb, 0xef,
-  0x7b, 0x77, 0xfd, 0xff, 0xdf, 0x77, 0x77, 0xf7, 0xfb, 0xef, 0xfe, 0xfd,
-  0xbf, 0xef, 0xfe, 0xff, 0x6f, 0x77, 0xb7, 0xfb, 0xdf, 0xbf, 0xfd, 0xfd,
-  0xbf, 0xdf, 0xf6, 0xdf, 0xbf, 0xfb, 0x7e, 0xff, 0xae, 0xff, 0xff, 0xf7,
-  0x6f, 0xff, 0xff, 0xff, 0x7f, 0xea, 0xaa, 0x2a, 0xaa, 0xa5, 0x55, 0x29,
-  0x25, 0x55, 0x6f, 0xb6, 0xff, 0xff, 0xfb, 0x7d, 0xdf, 0xf6, 0xff, 0xff,
-  0xbf, 0xef, 0x76, 0xee, 0xdf, 0xbb, 0xff, 0xbb, 0x6e, 0xf7, 0x7f, 0xff,
-  0xbf, 0x7f, 0x7b, 0x7f, 0xfb, 0xb7, 0xbe, 0xf7, 0xbf, 0xff, 0x6f, 0xfd,
-  0xff, 0xff, 0xfe, 0xff, 0xde, 0xff, 0x6f, 0xef, 0xfb, 0x76, 0xdf, 0xb7,
-  0xfb, 0xdf, 0xfe, 0xde, 0xfb, 0xed, 0xb7, 0xbf, 0xed, 0xfb, 0xdf, 0xfb,
-  0xed, 0xbf, 0xdf, 0xb5, 0xfb, 0xb7, 0x6d, 0xbd, 0xfb, 0x6f, 0x76, 0xfd,
-  0xed, 0xb5, 0x55, 0xa5, 0x55, 0x5a, 0xa5, 0x55, 0x55, 0x55, 0x55, 0x5b,
-  0x5d, 0xdf, 0x6f, 0xff, 0x7d, 0xff, 0xff, 0xdd, 0xf7, 0xff, 0xff, 0xff,
-  0xfb, 0xff, 0x6d, 0xef, 0xff, 0xbf, 0xf7, 0xbd, 0xf7, 0xf7, 0xff, 0xef,
-  0xbf, 0xff, 0xff, 0xff, 0xff, 0x77, 0xfe, 0xdf, 0xef, 0x77, 0x7f, 0xbd,
-  0xff, 0xf7, 0xfd, 0xbd, 0xdf, 0xff, 0xf7, 0xfd, 0xbf, 0xfd, 0xb7, 0xef,
-  0xfe, 0xff, 0xff, 0xf6, 0xfe, 0xff, 0xf6, 0xde, 0xff, 0xed, 0xed, 0xff,
-  0x7f, 0xfb, 0xff, 0xdf, 0xbf, 0xfb, 0xff, 0x6f, 0x7e, 0xaa, 0xa9, 0x55,
-  0x55, 0x4a, 0xa9, 0x55, 0x54, 0x95, 0x55, 0xaa, 0xee, 0xf7, 0xfd, 0xff,
-  0xfe, 0xdf, 0x6d, 0xff, 0xff, 0x7f, 0xff, 0x77, 0xff, 0xff, 0xff, 0xff,
-  0xfb, 0xfb, 0xff, 0xef, 0xfb, 0xfb, 0xdb, 0xfd, 0xfd, 0xfd, 0xf7, 0x7b,
-  0xdb, 0xfb, 0xff, 0xf7, 0x7b, 0xfb, 0xdb, 0xde, 0xdb, 0xbd, 0xdf, 0xff,
-  0xef, 0x77, 0x7e, 0xdf, 0xed, 0xdf, 0xfe, 0xfe, 0xdb, 0xed, 0xbb, 0xbf,
-  0xb7, 0xde, 0xff, 0xf7, 0xb6, 0xff, 0x7f, 0x6d, 0xdb, 0x7f, 0x6d, 0xf7,
-  0xf6, 0xef, 0x77, 0xff, 0xd5, 0x55, 0x55, 0x54, 0xaa, 0xb5, 0x55, 0x55,
-  0x55, 0x65, 0x56, 0xd6, 0xbb, 0xff, 0xff, 0xff, 0xb7, 0xf7, 0xff, 0xee,
-  0xfb, 0xed, 0xbf, 0xfe, 0xfd, 0xdf, 0xfe, 0xf5, 0xbf, 0xde, 0xdb, 0xfe,
-  0xfe, 0xff, 0x7e, 0xef, 0xdf, 0x6f, 0x7f, 0xff, 0xff, 0xbe, 0xdb, 0xff,
-  0xff, 0x7f, 0xff, 0xff, 0xfe, 0xff, 0xfb, 0xb6, 0xfb, 0xfd, 0xef, 0xf6,
-  0xfe, 0xf6, 0xef, 0x77, 0xff, 0x7f, 0xdd, 0xfb, 0xff, 0xff, 0xdb, 0x7b,
-  0xff, 0xdb, 0xf7, 0xff, 0xff, 0xdb, 0xff, 0x7d, 0xbf, 0x7f, 0xbd, 0xb5,
-  0x55, 0x4a, 0xa5, 0x55, 0x56, 0xd5, 0x55, 0x55, 0x6d, 0xb5, 0x5b, 0x6a,
-  0xaf, 0x5b, 0x6e, 0xbd, 0xff, 0xfb, 0xf7, 0x7f, 0xdf, 0xff, 0xdb, 0xff,
-  0xdf, 0xfd, 0xff, 0xbf, 0xee, 0xff, 0xff, 0x7f, 0xdf, 0xdf, 0xff, 0xff,
-  0xef, 0xff, 0xbb, 0xde, 0xdf, 0xff, 0xfe, 0xdd, 0xef, 0xde, 0xee, 0xf7,
-  0xef, 0xed, 0xbf, 0xff, 0x7f, 0xdf, 0xfb, 0x7f, 0xbf, 0xdf, 0xbf, 0xde,
-  0xdd, 0xef, 0xff, 0xbe, 0xdb, 0xef, 0xf7, 0xfe, 0xdb, 0x7f, 0x5d, 0xb6,
-  0xdb, 0x7e, 0xdb, 0xdf, 0xf7, 0xf7, 0xff, 0xd5, 0x56, 0xa9, 0x5a, 0xaa,
-  0xaa, 0xbf, 0xbb, 0x7e, 0xdb, 0x6d, 0xd5, 0xb7, 0x75, 0xff, 0xff, 0xef,
-  0xfb, 0x7e, 0xdf, 0xff, 0x7d, 0xff, 0xff, 0x7f, 0xff, 0xef, 0xbf, 0xfd,
-  0xff, 0xef, 0xfb, 0xdb, 0x7e, 0xf7, 0xde, 0xed, 0xff, 0xff, 0xfe, 0xf7,
-  0xf6, 0xef, 0x7f, 0xff, 0x7d, 0xfb, 0xff, 0xbd, 0xbf, 0x7f, 0xed, 0xdf,
-  0xdb, 0x7d, 0xbf, 0xf7, 0xed, 0xfb, 0xf5, 0xf7, 0xff, 0xfa, 0xed, 0xef,
-  0xff, 0x7d, 0xbd, 0xaf, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xef, 0xfd, 0xfb,
-  0x7f, 0xbd, 0xed, 0x75, 0x51, 0x55, 0x4a, 0xaa, 0xab, 0xaa, 0xed, 0xd6,
-  0xff, 0x76, 0xdd, 0xdb, 0x57, 0x55, 0xb7, 0xff, 0x5f, 0xff, 0xfb, 0xb7,
-  0xfe, 0xdb, 0xff, 0xed, 0xee, 0xff, 0xed, 0xdf, 0x76, 0xf6, 0xdf, 0xff,
-  0xf7, 0xfd, 0xef, 0xff, 0xf6, 0xdb, 0xdf, 0xff, 0xff, 0xf7, 0xee, 0xf7,
-  0xff, 0xff, 0xbb, 0xff, 0xfb, 0xee, 0xfe, 0xfb, 0xff, 0xef, 0xdb, 0xbe,
-  0x7f, 0x7e, 0xff, 0xfe, 0xdd, 0xbf, 0xff, 0xbd, 0xad, 0xff, 0xf7, 0xfd,
-  0xb6, 0xff, 0xb6, 0xdb, 0x5b, 0x7b, 0x6f, 0x6f, 0xdb, 0xf7, 0x7f, 0x95,
-  0x4a, 0xaa, 0x55, 0x5d, 0xfd, 0xff, 0xbb, 0x7f, 0xab, 0xdd, 0xb7, 0x6d,
-  0xba, 0xff, 0x7d, 0xef, 0xfb, 0xbf, 0xff, 0xff, 0xef, 0xff, 0x77, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xdf, 0x7f, 0xfe, 0xf6,
-  0xff, 0xff, 0xff, 0x7b, 0x7f, 0x7f, 0xbf, 0xbf, 0x6e, 0xdd, 0xef, 0xb7,
-  0xdf, 0xbf, 0xf7, 0xde, 0xed, 0xfd, 0xfe, 0xf7, 0xf7, 0xef, 0xde, 0xb7,
-  0xef, 0xef, 0xbb, 0xef, 0xff, 0xf7, 0xbe, 0xef, 0xff, 0xed, 0xff, 0xff,
-  0xff, 0xbf, 0xff, 0xfd, 0xfe, 0xff, 0xea, 0xd5, 0x54, 0x2a, 0xaa, 0xd6,
-  0xad, 0x55, 0xdf, 0xaa, 0xfe, 0xed, 0xfb, 0x7d, 0xdf, 0x6b, 0xdf, 0x7f,
-  0xfd, 0xed, 0xbf, 0xfe, 0xff, 0xff, 0xff, 0x7e, 0xff, 0xdd, 0xfe, 0xed,
-  0xdf, 0xbe, 0xff, 0xb6, 0xff, 0xee, 0xef, 0x7f, 0xbf, 0xfe, 0xdb, 0xbf,
-  0xdb, 0xfd, 0xf7, 0xf7, 0xff, 0xff, 0xfd, 0xfe, 0xfd, 0xfb, 0xbf, 0xff,
-  0xfe, 0xdf, 0xdf, 0xff, 0x7d, 0xbb, 0x77, 0xfe, 0xfd, 0xfa, 0xfe, 0xfd,
-  0xdf, 0x7e, 0xf7, 0xfd, 0xb6, 0xff, 0x6d, 0xad, 0xb7, 0xed, 0xb6, 0xdf,
-  0x6f, 0xba, 0xb6, 0xaa, 0xab, 0x4a, 0xa5, 0x7b, 0xff, 0xfe, 0xf5, 0xff,
-  0xab, 0xbf, 0x5f, 0xd7, 0xf7, 0xde, 0xf7, 0xed, 0xff, 0xff, 0xf6, 0xdb,
-  0xfd, 0xdf, 0xfd, 0xff, 0xdb, 0xff, 0xff, 0xff, 0xf6, 0xf7, 0xb7, 0xff,
-  0xf7, 0xbf, 0xff, 0xff, 0xed, 0xb7, 0xff, 0xfb, 0xff, 0xb7, 0xfe, 0xfe,
-  0xed, 0xb6, 0xff, 0xb7, 0xdf, 0xde, 0xfb, 0x6e, 0xff, 0xfd, 0xf7, 0x6d,
-  0xaf, 0xff, 0xfb, 0xf7, 0xef, 0xbf, 0xef, 0xbe, 0xf7, 0xbf, 0xbf, 0x6f,
-  0xff, 0x5b, 0xef, 0xff, 0xfd, 0x7d, 0xf7, 0xfb, 0xf5, 0xdf, 0xaa, 0xaa,
-  0xaa, 0xa9, 0x5b, 0xad, 0x55, 0x57, 0xbe, 0xb5, 0xff, 0xdb, 0xda, 0xfe,
-  0xba, 0xf7, 0xbb, 0x7f, 0xdf, 0x6f, 0xff, 0xff, 0xdf, 0xf6, 0xdf, 0xef,
-  0xff, 0xff, 0xb7, 0x6e, 0xff, 0xff, 0xfd, 0xdf, 0x7b, 0xf7, 0x7b, 0xed,
-  0xff, 0xff, 0xff, 0xdd, 0xdd, 0xfe, 0xdf, 0xdf, 0x7f, 0xff, 0xdb, 0xfb,
-  0xee, 0xff, 0xdf, 0xf7, 0xd6, 0xee, 0xff, 0xff, 0xfd, 0xbb, 0x7e, 0xbe,
-  0xfd, 0xfe, 0xff, 0xef, 0xdf, 0xf7, 0xed, 0xfd, 0xb7, 0xff, 0x7a, 0xd5,
-  0x57, 0xdf, 0x7d, 0x5e, 0xdf, 0xf7, 0xea, 0xa9, 0x55, 0x56, 0xb6, 0xdf,
-  0xbf, 0xfa, 0xef, 0xef, 0x55, 0xf7, 0x7f, 0xb7, 0xff, 0xdd, 0xef, 0xd6,
-  0xf7, 0xfb, 0x7f, 0xfe, 0xfe, 0xff, 0xff, 0xbf, 0xfd, 0xdd, 0xff, 0xff,
-  0xff, 0xbd, 0xff, 0xf7, 0xff, 0xff, 0xef, 0x7f, 0xfd, 0xf6, 0xdb, 0xff,
-  0xff, 0xff, 0xf7, 0x7b, 0xf7, 0xbb, 0x7f, 0xbe, 0xff, 0xdb, 0xfb, 0xfe,
-  0xff, 0xff, 0xb6, 0xee, 0xff, 0xdf, 0xdf, 0xff, 0xdf, 0xd7, 0xda, 0xfe,
-  0xfb, 0xff, 0xff, 0xef, 0xfd, 0xf7, 0xdf, 0xff, 0xfe, 0xeb, 0xaf, 0xf7,
-  0xfe, 0xba, 0xbd, 0x55, 0x55, 0x52, 0xdb, 0x75, 0xd5, 0x5f, 0xb5, 0x7b,
-  0xfe, 0xbb, 0xdb, 0xfd, 0xee, 0xff, 0x7a, 0xff, 0xfd, 0xff, 0xdb, 0x6f,
-  0xef, 0xff, 0xff, 0xfd, 0xbf, 0xff, 0xfd, 0xf6, 0xdb, 0xdf, 0x6e, 0xff,
-  0xdf, 0x7b, 0xff, 0xff, 0x6f, 0xbf, 0xfe, 0xfe, 0xef, 0x6f, 0xff, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xf7, 0xff, 0xff, 0xbf, 0xff, 0xb7, 0xff, 0x7f,
-  0xae, 0xfb, 0xf7, 0xad, 0xf6, 0xfe, 0xff, 0xdb, 0xbf, 0x7b, 0x6d, 0x7d,
-  0xbf, 0x5f, 0x76, 0xb7, 0x6f, 0xbf, 0xfb, 0x7d, 0x6b, 0xff, 0xea, 0xaa,
-  0xaa, 0xad, 0xb6, 0xdb, 0x7f, 0xea, 0xef, 0xde, 0xb7, 0xff, 0xfe, 0xdf,
-  0x7f, 0xef, 0xff, 0xad, 0xf7, 0x5b, 0xff, 0xff, 0xff, 0xbb, 0xb7, 0xf7,
-  0xfe, 0xff, 0xdf, 0x7f, 0xff, 0xff, 0xff, 0xfb, 0xf7, 0xef, 0x7b, 0xb7,
-  0xfe, 0xfe, 0xdf, 0xdf, 0xff, 0xfd, 0xff, 0xff, 0x7b, 0xff, 0xdb, 0xff,
-  0xbe, 0xfd, 0xbd, 0xf7, 0x6b, 0xfd, 0xf7, 0xed, 0xf7, 0xff, 0x7d, 0xff,
-  0x7f, 0xef, 0x6e, 0xff, 0xd7, 0xff, 0x7f, 0xef, 0xf7, 0xf7, 0xff, 0xfb,
-  0xfb, 0xfb, 0x7f, 0xdf, 0xff, 0xdb, 0x6d, 0xaa, 0xaa, 0xad, 0xb6, 0xdb,
-  0xd5, 0x7f, 0x7d, 0x77, 0xbe, 0xda, 0xb7, 0xf7, 0xf7, 0x7b, 0x6d, 0xff,
-  0x7f, 0xfe, 0xdf, 0xfb, 0x7b, 0xff, 0xfe, 0xff, 0xef, 0xdd, 0xff, 0xbf,
-  0x7d, 0xfb, 0xf7, 0xde, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xf7, 0xff, 0xff,
-  0xf7, 0xff, 0xbb, 0xdf, 0xff, 0xef, 0xff, 0xb7, 0xff, 0xff, 0xff, 0xff,
-  0xfd, 0xbf, 0xbf, 0xff, 0xfe, 0xb7, 0xdf, 0xdb, 0xdb, 0x7f, 0xff, 0xdd,
-  0xff, 0xbd, 0xdb, 0xbd, 0xbd, 0xff, 0xb6, 0xff, 0x6f, 0xbf, 0xdd, 0xf7,
-  0xba, 0xf7, 0xb5, 0x55, 0x2a, 0xd6, 0xdb, 0x76, 0xbf, 0xad, 0xd7, 0xdd,
-  0xeb, 0xff, 0xfe, 0xfd, 0xbf, 0xff, 0xff, 0x6f, 0xfa, 0xdb, 0xf6, 0xdf,
-  0xff, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf7, 0xf7, 0xdf, 0x6f, 0x7d, 0xff,
-  0xff, 0xfb, 0xbd, 0xff, 0x6f, 0xbf, 0x6f, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xfd, 0xff, 0xff, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xbf, 0xee, 0xfb, 0x6e,
-  0xdf, 0xfd, 0xf6, 0xff, 0xff, 0xf6, 0xed, 0xef, 0xbb, 0xdf, 0xfd, 0xff,
-  0xde, 0xdb, 0xff, 0xb7, 0xfd, 0xed, 0xff, 0x7d, 0xff, 0xba, 0xd5, 0x55,
-  0x55, 0x76, 0xdb, 0xb7, 0xd5, 0xee, 0xfe, 0xef, 0x7f, 0x5b, 0xb7, 0xdf,
-  0xfb, 0xff, 0xef, 0xf7, 0x5e, 0xfd, 0xff, 0xff, 0xbd, 0xfd, 0xb7, 0xbb,
-  0x7d, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xee, 0xdd, 0xbf, 0xdf, 0x6f,
-  0xfb, 0xff, 0xfd, 0xf6, 0xfd, 0xdf, 0xfd, 0xf7, 0xbe, 0xfd, 0xf7, 0xff,
-  0xef, 0xff, 0xdd, 0xbb, 0xdd, 0xff, 0xdf, 0xff, 0xf7, 0xb7, 0x7f, 0xdb,
-  0x76, 0xdf, 0xbf, 0xfd, 0xef, 0xfa, 0xdf, 0xb6, 0xff, 0xff, 0xb6, 0xfd,
-  0xef, 0xff, 0xb7, 0xff, 0xde, 0xff, 0x6d, 0xaa, 0xb6, 0xad, 0xb6, 0xdd,
-  0xff, 0x7b, 0xab, 0xbb, 0xdb, 0xfe, 0xfe, 0xf6, 0xdf, 0x7f, 0xfe, 0xfd,
-  0xff, 0x5e, 0xdb, 0xf7, 0xff, 0xef, 0xff, 0xff, 0xef, 0xbf, 0xfb, 0x76,
-  0xef, 0xfb, 0xbf, 0xff, 0xff, 0xfd, 0xff, 0xff, 0xff, 0xb6, 0xdf, 0xff,
-  0xff, 0xf6, 0xdf, 0xbd, 0xef, 0xef, 0x7d, 0xb5, 0x7a, 0xd5, 0x7f, 0xff,
-  0xff, 0x77, 0xfb, 0xb7, 0x7d, 0xff, 0xdd, 0xff, 0xbf, 0xfb, 0xfd, 0xbf,
-  0xff, 0xfe, 0xf7, 0xff, 0xeb, 0x6f, 0xff, 0xdf, 0x7b, 0x6d, 0xfd, 0xad,
-  0xf7, 0x6b, 0xb5, 0x56, 0xdb, 0xf6, 0xf6, 0xed, 0x55, 0xdd, 0xfd, 0xde,
-  0xff, 0x6f, 0xf7, 0x7f, 0xff, 0xbb, 0xff, 0xdf, 0xaa, 0xea, 0xff, 0x7d,
-  0xee, 0xff, 0xfd, 0xdf, 0xff, 0xef, 0xbf, 0xff, 0xfd, 0xbf, 0xef, 0xf7,
-  0xef, 0xef, 0xfb, 0xfd, 0xbb, 0xff, 0xff, 0x7f, 0x5b, 0x7f, 0xed, 0xef,
-  0x77, 0xfb, 0xaf, 0xbf, 0xdf, 0x7f, 0xcf, 0xff, 0xf7, 0xfb, 0x7d, 0xff,
-  0xdf, 0xbb, 0xf7, 0xbb, 0xf7, 0x7f, 0xb7, 0xed, 0x76, 0xeb, 0xbd, 0xb6,
-  0xff, 0xfb, 0xab, 0x7b, 0xff, 0xff, 0xbf, 0xff, 0xff, 0xdd, 0x55, 0x6b,
-  0x55, 0x2d, 0xbb, 0xbb, 0xff, 0x77, 0x5f, 0x77, 0xab, 0xfb, 0x7f, 0xfb,
-  0xef, 0xff, 0xef, 0x76, 0xff, 0x57, 0xdf, 0xff, 0xbf, 0xfb, 0xbf, 0xfb,
-  0xfd, 0xff, 0xff, 0x7f, 0x77, 0xfd, 0xfd, 0xbe, 0xfd, 0xbe, 0xde, 0xdf,
-  0xff, 0xde, 0xdf, 0xff, 0xed, 0xaa, 0xb6, 0xb5, 0xad, 0xef, 0xfb, 0xed,
-  0x77, 0xdb, 0x7f, 0xb6, 0xdf, 0x7f, 0xdf, 0xdb, 0xed, 0xdf, 0x7f, 0xdd,
-  0xfb, 0xed, 0xfe, 0xff, 0xbf, 0xfd, 0xff, 0xff, 0xdd, 0xbf, 0xff, 0xde,
-  0xdb, 0x6d, 0xf6, 0xed, 0xbd, 0xed, 0xdd, 0xad, 0x7d, 0xed, 0xae, 0xee,
-  0xab, 0xbb, 0xeb, 0xfd, 0xfb, 0x5f, 0xbb, 0xde, 0xf7, 0xfe, 0xfb, 0xfe,
-  0xab, 0xba, 0xeb, 0xef, 0xff, 0xbf, 0xef, 0xfe, 0xdf, 0xfd, 0xf7, 0xb7,
-  0xff, 0xdf, 0xff, 0xff, 0x7f, 0xff, 0xff, 0xf7, 0xdd, 0xf7, 0xf7, 0xfb,
-  0x76, 0xaa, 0xda, 0xaa, 0xb7, 0xfd, 0xbd, 0x7f, 0xba, 0xff, 0xab, 0xff,
-  0xfb, 0xbb, 0xfe, 0xfe, 0xff, 0xfb, 0xed, 0xff, 0x7f, 0x7f, 0xbf, 0xb7,
-  0xff, 0x7b, 0x5b, 0x76, 0xf7, 0xed, 0xb6, 0xff, 0xff, 0xff, 0x5f, 0xbf,
-  0xef, 0x7b, 0x6a, 0xb7, 0xae, 0xbb, 0x75, 0xbb, 0xfe, 0xee, 0xfe, 0xb7,
-  0xbf, 0xf7, 0xfe, 0xff, 0xfe, 0xff, 0xff, 0x6f, 0xff, 0xef, 0xbe, 0xfd,
-  0xef, 0xfd, 0xfd, 0xbf, 0xfe, 0xdf, 0xff, 0xff, 0xbd, 0xfe, 0xdf, 0xdf,
-  0xef, 0xef, 0xef, 0xfd, 0xff, 0xfe, 0xdf, 0xff, 0xdb, 0x7f, 0xff, 0x55,
-  0xab, 0xef, 0xef, 0xd7, 0xff, 0xb7, 0xdf, 0xff, 0xbf, 0xfe, 0xef, 0xef,
-  0x6e, 0xdf, 0x7f, 0xef, 0xef, 0xbb, 0xeb, 0xfd, 0xd7, 0xfb, 0xff, 0xbf,
-  0x7e, 0xff, 0xff, 0xeb, 0x6d, 0xb7, 0xfb, 0xfd, 0xfb, 0xdd, 0xb6, 0xd9,
-  0xb6, 0xdb, 0xbd, 0xad, 0x57, 0x77, 0x57, 0xbd, 0xed, 0xbd, 0x6f, 0xf7,
-  0x7f, 0xb7, 0xdf, 0xfb, 0x55, 0xfd, 0xd7, 0x7f, 0xfd, 0xdf, 0xff, 0xf7,
-  0xff, 0xff, 0xbb, 0xfb, 0xff, 0xef, 0xed, 0xf7, 0xfe, 0xfe, 0xfd, 0xbe,
-  0xf7, 0xbf, 0xff, 0x7e, 0xfd, 0xab, 0x6b, 0xfa, 0xad, 0xed, 0x7e, 0xfd,
-  0xab, 0xfd, 0xef, 0xfb, 0xdd, 0xef, 0xf7, 0x7b, 0xfb, 0xfb, 0xed, 0x7b,
-  0x7b, 0xef, 0xbf, 0xbf, 0x7f, 0xde, 0xdb, 0xf7, 0xdf, 0xbe, 0xd6, 0xff,
-  0xff, 0xff, 0xdf, 0x6f, 0xff, 0x76, 0xd5, 0x6e, 0xd5, 0xb6, 0xd7, 0x7b,
-  0xfb, 0xdd, 0xfd, 0xef, 0x7f, 0xef, 0xfe, 0xdf, 0xef, 0xfe, 0xff, 0xff,
-  0xfe, 0xff, 0xff, 0xef, 0x7f, 0xfe, 0xdf, 0xfe, 0xdf, 0xed, 0xff, 0x7f,
-  0xde, 0xff, 0xff, 0xfe, 0xf7, 0xf7, 0xff, 0xff, 0xfd, 0xf7, 0x7b, 0xff,
-  0xd7, 0x7e, 0xde, 0xad, 0x77, 0xff, 0xd7, 0xb7, 0xfe, 0xdf, 0x5e, 0xff,
-  0xff, 0x7e, 0xff, 0xfe, 0xbf, 0xde, 0xff, 0xff, 0xff, 0xfd, 0xfd, 0xf7,
-  0xfd, 0xfb, 0xff, 0xbd, 0xf5, 0xf7, 0xfe, 0xdd, 0xb6, 0xda, 0xfb, 0xfe,
-  0xdb, 0xbb, 0x5b, 0xab, 0x7d, 0xb7, 0x7b, 0xae, 0xae, 0xef, 0xaf, 0x7b,
-  0xb5, 0x7b, 0xb7, 0xfb, 0xfb, 0xff, 0xf7, 0xff, 0xb7, 0x5d, 0xdf, 0x7f,
-  0xed, 0xef, 0xfd, 0xbf, 0xf6, 0xff, 0xff, 0xdd, 0xef, 0xf6, 0xff, 0xbf,
-  0xbf, 0xbf, 0xb7, 0xef, 0xbf, 0xff, 0xdf, 0xff, 0xfb, 0xb7, 0xfb, 0xed,
-  0xb5, 0xf5, 0xfb, 0xfd, 0xb7, 0xf7, 0xef, 0xdf, 0xf7, 0xf7, 0xbd, 0xef,
-  0xed, 0xff, 0xb7, 0x6d, 0xb6, 0xf7, 0xdf, 0xbe, 0xdf, 0xee, 0xdb, 0xff,
-  0xbf, 0xbe, 0xd7, 0xf7, 0xff, 0xff, 0xdf, 0x6f, 0xfe, 0xd6, 0xd6, 0xf6,
-  0xcb, 0x7a, 0xd6, 0xf7, 0xfb, 0xba, 0xfb, 0xdf, 0xff, 0xde, 0xfe, 0xfe,
-  0xff, 0x77, 0xff, 0x7b, 0xfd, 0xff, 0xfb, 0xf7, 0xff, 0xff, 0xef, 0xf7,
-  0xff, 0xff, 0xdd, 0xff, 0xfe, 0xff, 0xdb, 0xf7, 0xfb, 0xfb, 0xfd, 0xbd,
-  0xfe, 0xdb, 0xff, 0xed, 0xff, 0xed, 0x56, 0xfe, 0xff, 0xff, 0x7e, 0xb7,
-  0xfd, 0xdf, 0xbf, 0xfb, 0x7e, 0xdf, 0xef, 0x7d, 0xff, 0x6b, 0xff, 0xff,
-  0xff, 0xbd, 0xed, 0xf7, 0xfe, 0xfb, 0xff, 0x6d, 0xdf, 0xdf, 0xfb, 0x7e,
-  0xdb, 0x6e, 0xfb, 0xed, 0xef, 0xf5, 0x75, 0x5b, 0x7d, 0xaf, 0x7b, 0x5a,
-  0xad, 0xdf, 0xde, 0xfa, 0xd6, 0xef, 0xef, 0x6f, 0xdf, 0xff, 0x7f, 0xff,
-  0xef, 0xaf, 0xfd, 0xbb, 0x7f, 0x76, 0xff, 0xff, 0x7f, 0xbd, 0xff, 0xee,
-  0xff, 0xbf, 0xfd, 0xff, 0xfd, 0xfd, 0xff, 0xff, 0xef, 0xfd, 0xbf, 0xfe,
-  0xfb, 0x7d, 0xf7, 0x57, 0xab, 0xb7, 0xd7, 0xfd, 0xae, 0xfd, 0xcb, 0xff,
-  0xef, 0xfe, 0xff, 0xff, 0xb7, 0xfe, 0xdb, 0x76, 0xdb, 0xff, 0xff, 0xbe,
-  0xb7, 0xf6, 0xdb, 0xff, 0xf5, 0xfb, 0x7f, 0xdb, 0xff, 0xfb, 0xdf, 0x7f,
-  0xfb, 0x5b, 0x5e, 0xdd, 0xab, 0x75, 0xad, 0xed, 0xfb, 0x75, 0x77, 0xaf,
-  0xbf, 0xfb, 0x7f, 0xfe, 0xfb, 0xff, 0xdf, 0xde, 0xfd, 0xfb, 0x6f, 0xff,
-  0xdb, 0xff, 0xf6, 0xfb, 0xef, 0xff, 0xfe, 0xff, 0xdf, 0xed, 0xff, 0xbb,
-  0x7f, 0xbf, 0x6f, 0xee, 0xff, 0xff, 0xf7, 0xff, 0xde, 0xd6, 0xba, 0xfa,
-  0xd7, 0xfd, 0xfe, 0xb7, 0xff, 0xdf, 0xbf, 0xff, 0xbe, 0xef, 0xdb, 0x6e,
-  0xfd, 0xbf, 0xff, 0xbf, 0xfd, 0xdd, 0xbb, 0xf7, 0xff, 0x77, 0xfe, 0xdb,
-  0x7f, 0xbf, 0xd6, 0xff, 0x6d, 0xbe, 0xfb, 0xfb, 0x7d, 0xcd, 0xea, 0xd6,
-  0xdb, 0x5e, 0xed, 0x6d, 0x5b, 0xdf, 0xb5, 0xfd, 0xfb, 0x5f, 0xdb, 0xb7,
-  0xff, 0xbb, 0xed, 0xff, 0xde, 0xdf, 0xfd, 0x5f, 0xff, 0xbf, 0x7f, 0xbf,
-  0xfb, 0xdf, 0xef, 0xf7, 0xed, 0xfe, 0xdf, 0xff, 0xdf, 0xff, 0xfe, 0xff,
-  0xf6, 0xdf, 0xbd, 0xff, 0xf7, 0x76, 0xdb, 0x55, 0x75, 0xff, 0x77, 0xfd,
-  0xb6, 0xed, 0xef, 0xbb, 0xf7, 0xfd, 0xff, 0xf7, 0xef, 0xee, 0xed, 0xf7,
-  0x7f, 0x7f, 0xef, 0x7e, 0xff, 0xfd, 0x6f, 0xff, 0xdd, 0xfb, 0x7f, 0xdd,
-  0xff, 0xef, 0xdf, 0x5f, 0xef, 0x56, 0xae, 0xb5, 0x6e, 0xeb, 0x5a, 0xb7,
-  0x6e, 0xb5, 0xff, 0x57, 0x5e, 0xf5, 0xf6, 0xfe, 0xbb, 0xff, 0xff, 0xf7,
-  0x7f, 0xeb, 0xff, 0xf6, 0xff, 0xf7, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xfe,
-  0xdf, 0xff, 0xfb, 0xdf, 0xf7, 0xb7, 0xf7, 0xf7, 0x7f, 0xfb, 0xff, 0xfd,
-  0xbb, 0xbd, 0xfd, 0xbd, 0x5f, 0xdb, 0xde, 0xdf, 0xff, 0xff, 0x5d, 0xff,
-  0xdf, 0x6f, 0xdd, 0xff, 0x7e, 0xf7, 0x7f, 0xfb, 0xb7, 0xf6, 0xff, 0xef,
-  0xb7, 0xb7, 0xfb, 0x6d, 0xef, 0xdf, 0xda, 0xef, 0xdb, 0x7e, 0xfb, 0xfd,
-  0xfd, 0xb6, 0xb5, 0xad, 0xb6, 0xb5, 0x6b, 0x55, 0xbb, 0xdd, 0x55, 0xfb,
-  0xf7, 0xbe, 0xbf, 0xb7, 0xdd, 0xde, 0xff, 0x7f, 0xf7, 0x7d, 0xbf, 0xff,
-  0xed, 0xff, 0xbb, 0xfb, 0x7f, 0xef, 0xff, 0xbf, 0xc5, 0x6f, 0xfd, 0xf6,
-  0xfd, 0xff, 0x7f, 0x7f, 0xff, 0xfd, 0xbf, 0xff, 0xda, 0xd7, 0xad, 0xef,
-  0xa5, 0xfe, 0xf7, 0xf6, 0xd6, 0xdb, 0xef, 0xff, 0xfb, 0xfe, 0xff, 0xbb,
-  0xef, 0xff, 0xee, 0xdf, 0xff, 0x7f, 0xeb, 0x7b, 0xff, 0xee, 0xdf, 0xff,
-  0xfa, 0xfd, 0xff, 0xfd, 0x7f, 0xef, 0xdf, 0xb7, 0xb7, 0x6b, 0xad, 0x6a,
-  0xd5, 0xaa, 0x95, 0x6b, 0x6d, 0x77, 0xff, 0x5e, 0xad, 0xef, 0xee, 0xfd,
-  0xff, 0x7b, 0xdb, 0xfb, 0xbd, 0xef, 0xef, 0x7f, 0x7f, 0xbd, 0xff, 0x7f,
-  0xfb, 0xff, 0xef, 0xee, 0x89, 0xfd, 0xbf, 0xff, 0xff, 0xfb, 0xff, 0xfb,
-  0xb6, 0xff, 0xff, 0x7e, 0xff, 0x5e, 0xf7, 0x7a, 0x7f, 0xef, 0xfe, 0xdf,
-  0xff, 0xfe, 0xaf, 0xdd, 0xff, 0xb7, 0xdd, 0xff, 0xfb, 0x5d, 0xf7, 0xfd,
-  0xdb, 0xdb, 0x7f, 0xfe, 0xbd, 0xf7, 0xfd, 0xb6, 0xbf, 0xbe, 0xd7, 0x6f,
-  0xdb, 0x76, 0xfd, 0xff, 0xfb, 0xba, 0xd5, 0xae, 0xb6, 0xaa, 0xd5, 0x55,
-  0x55, 0xb5, 0x55, 0xf7, 0xff, 0x7b, 0x77, 0xaf, 0x6b, 0xff, 0xff, 0xbf,
-  0xff, 0xf6, 0xf7, 0xf7, 0xff, 0xff, 0xff, 0xbf, 0xbd, 0xfe, 0xfd, 0xff,
-  0xc4, 0x5f, 0xff, 0xbf, 0x6f, 0xbf, 0xdb, 0xbf, 0xff, 0xdf, 0xb7, 0xff,
-  0xfb, 0xf7, 0xdb, 0xdf, 0x95, 0xf6, 0xb7, 0xf6, 0xb5, 0x6f, 0xef, 0xff,
-  0xdd, 0xff, 0xef, 0xdb, 0x6f, 0xf7, 0x7e, 0xef, 0xff, 0x7f, 0xfb, 0x5f,
-  0xf7, 0xed, 0xb7, 0xff, 0xf7, 0xef, 0xfd, 0xff, 0xff, 0xff, 0xaf, 0xb7,
-  0xfe, 0xd6, 0xb6, 0xd5, 0xaa, 0xaa, 0x54, 0x92, 0xaa, 0xdb, 0x7e, 0xad,
-  0x55, 0xd7, 0xdd, 0xfb, 0xff, 0xbf, 0xff, 0xfd, 0xde, 0xfd, 0xbf, 0xff,
-  0xdd, 0xef, 0xbf, 0xff, 0xff, 0xff, 0xff, 0x77, 0x11, 0x2f, 0xb7, 0xf7,
-  0xfd, 0xfd, 0xff, 0xfd, 0xff, 0x7b, 0xff, 0xde, 0xae, 0xaf, 0x7e, 0xf5,
-  0x6f, 0xff, 0xed, 0x7f, 0xff, 0xfb, 0x5d, 0xfe, 0xf7, 0xf6, 0xfd, 0xff,
-  0xfd, 0xff, 0xef, 0x7f, 0x77, 0xdd, 0xdf, 0xf6, 0xff, 0xef, 0xfe, 0xdb,
-  0xbe, 0xfb, 0x6f, 0xb5, 0xb6, 0xdb, 0xfd, 0xfb, 0x6e, 0xda, 0xda, 0xb5,
-  0xb4, 0x82, 0x02, 0x4a, 0x2a, 0xad, 0xab, 0xef, 0xff, 0x7a, 0xef, 0x5b,
-  0x6d, 0xed, 0xbb, 0xff, 0xef, 0xdf, 0xfb, 0x7d, 0xff, 0xff, 0xf7, 0xdb,
-  0xff, 0x6f, 0xf7, 0xff, 0xc8, 0x85, 0xfe, 0xff, 0xff, 0xde, 0xff, 0xdf,
-  0xb7, 0xff, 0x7f, 0xff, 0xfb, 0x7b, 0xea, 0xbd, 0x55, 0xeb, 0x7f, 0xd6,
-  0xdb, 0x5b, 0xef, 0xef, 0xff, 0xbf, 0xfe, 0xee, 0xef, 0x77, 0x7f, 0xeb,
-  0xdf, 0xf7, 0x7b, 0xff, 0xbd, 0xfb, 0x6f, 0xfe, 0xf7, 0xfe, 0xfb, 0xff,
-  0xff, 0xfe, 0xef, 0xbf, 0xfb, 0xad, 0x55, 0x5a, 0xc9, 0x35, 0x69, 0x51,
-  0x49, 0x55, 0x6d, 0x75, 0x55, 0xaf, 0xba, 0xfd, 0xbb, 0x7f, 0xff, 0x7f,
-  0xfd, 0xfb, 0x6f, 0xff, 0xef, 0xfb, 0xff, 0xff, 0xdf, 0xfe, 0xff, 0xbb,
-  0x85, 0x2a, 0xfb, 0xdb, 0x6f, 0xff, 0xdb, 0xff, 0xff, 0xaa, 0xaf, 0xf6,
-  0xd7, 0xae, 0xb6, 0xee, 0x57, 0xff, 0xed, 0xff, 0xf6, 0xfe, 0x9f, 0x7f,
-  0x7b, 0xf7, 0x6f, 0xfb, 0x77, 0xbb, 0xf6, 0xfd, 0xfa, 0xff, 0xfd, 0xad,
-  0xff, 0x6f, 0xfb, 0x6f, 0xfb, 0x5f, 0xdf, 0x6e, 0xdb, 0x6f, 0x7d, 0xef,
-  0xbe, 0xe6, 0xd5, 0xad, 0x54, 0xaa, 0xae, 0xaa, 0x25, 0x2a, 0xb7, 0x5f,
-  0xfe, 0xfa, 0xef, 0x56, 0xdb, 0xab, 0x6f, 0xdb, 0x7e, 0xdf, 0xff, 0xfe,
-  0xff, 0x7f, 0xfb, 0xfd, 0xff, 0xff, 0xfd, 0xff, 0xd0, 0x42, 0x2f, 0xff,
-  0xfe, 0xff, 0xfe, 0xed, 0xfa, 0x92, 0xa5, 0xff, 0xf5, 0xeb, 0xdb, 0x75,
-  0x5b, 0x7b, 0x7e, 0xda, 0xbf, 0xb7, 0xef, 0xff, 0xdf, 0x7b, 0xff, 0xbf,
-  0xff, 0xff, 0x7f, 0xbf, 0xef, 0xbb, 0xbf, 0xff, 0xdf, 0xdb, 0x7f, 0xfb,
-  0x7f, 0xf6, 0xf5, 0xfb, 0xff, 0xfb, 0xef, 0xfb, 0xef, 0x5b, 0x55, 0x6a,
-  0xab, 0x57, 0x75, 0x5a, 0x91, 0x4a, 0xaa, 0xea, 0xab, 0x57, 0x5a, 0xd5,
-  0x55, 0x76, 0xfb, 0xff, 0xef, 0xfb, 0xfb, 0x6f, 0xfb, 0xfe, 0xff, 0xff,
-  0xf7, 0xbf, 0x77, 0xdd, 0xca, 0x90, 0x92, 0xbb, 0xb7, 0xdb, 0xff, 0xff,
-  0xa9, 0x49, 0x2f, 0xfe, 0xab, 0x7a, 0xb6, 0xda, 0xaf, 0xef, 0xdb, 0xff,
-  0xeb, 0xfd, 0xaf, 0xf7, 0xfb, 0xff, 0x75, 0xfb, 0xba, 0xdb, 0xdb, 0xf7,
-  0x7f, 0xfd, 0xee, 0xf6, 0xf7, 0xdf, 0xee, 0xdf, 0xd6, 0xff, 0xbf, 0xdf,
-  0xb6, 0xdf, 0x7e, 0xbf, 0xfb, 0xd5, 0x6a, 0xad, 0x4a, 0xbd, 0xdf, 0xd6,
-  0xd5, 0x55, 0x56, 0xb6, 0xfd, 0xda, 0xd5, 0x55, 0x55, 0x2a, 0xad, 0x6f,
-  0xfe, 0xdd, 0xbf, 0xfb, 0xbf, 0xdf, 0xbe, 0xdf, 0xff, 0xf7, 0xff, 0xff,
-  0xc8, 0x94, 0x48, 0x85, 0x5a, 0xfd, 0xb7, 0x7f, 0xa4, 0x54, 0xa5, 0xbf,
-  0xfb, 0xef, 0xb6, 0xae, 0xab, 0xfd, 0xde, 0xd6, 0xbe, 0xaf, 0xb7, 0xff,
-  0xbf, 0xdf, 0xff, 0xdf, 0xff, 0xff, 0x7e, 0xdd, 0xf6, 0xdf, 0xbb, 0xbf,
-  0xff, 0xeb, 0x7b, 0xfb, 0x7f, 0xbb, 0x76, 0xfa, 0xff, 0xfd, 0xef, 0xed,
-  0xde, 0xb6, 0xaa, 0xd4, 0xb5, 0xd7, 0x75, 0x7b, 0x5a, 0x52, 0xb5, 0xad,
-  0xae, 0xb7, 0x6a, 0xaa, 0x4a, 0xab, 0x55, 0xb5, 0xb7, 0xff, 0xff, 0xfd,
-  0x6f, 0xff, 0xff, 0xfd, 0xbb, 0xff, 0xfd, 0xef, 0xd2, 0x40, 0x12, 0x52,
-  0x45, 0x06, 0xef, 0xea, 0x12, 0xaa, 0x93, 0xf6, 0x96, 0xba, 0xdd, 0xd9,
-  0x57, 0xef, 0x77, 0xbf, 0xeb, 0xf5, 0xde, 0xfb, 0xed, 0xf7, 0x7d, 0xfb,
-  0xb7, 0xbb, 0xef, 0xff, 0xbf, 0xef, 0xff, 0xfb, 0x7e, 0xff, 0xbf, 0xdf,
-  0xfb, 0xff, 0xbf, 0xdf, 0xdb, 0x6f, 0xf6, 0xff, 0xf7, 0xab, 0x55, 0x6a,
-  0xad, 0x75, 0xb7, 0xdb, 0x6b, 0x5a, 0xad, 0x76, 0xeb, 0xb5, 0x5a, 0xa9,
-  0x52, 0x4a, 0xaa, 0x9d, 0xff, 0x6f, 0xff, 0xef, 0x2a, 0xf7, 0xef, 0xff,
-  0xff, 0x7f, 0xbe, 0xfd, 0xc2, 0x55, 0x09, 0x29, 0x52, 0xb2, 0x29, 0x68,
-  0x92, 0x4a, 0xab, 0xff, 0xeb, 0xde, 0xef, 0x6e, 0xb5, 0xeb, 0xfd, 0xfb,
-  0x7e, 0xbe, 0xaf, 0x7f, 0xff, 0x7b, 0xef, 0x7f, 0xfd, 0xef, 0xbd, 0xde,
-  0xf7, 0x7b, 0xbd, 0xbf, 0xef, 0xab, 0xed, 0x7b, 0x6e, 0xdb, 0xeb, 0x7d,
-  0xff, 0xfd, 0x7f, 0xb6, 0xfd, 0xad, 0x56, 0xaa, 0xb7, 0xbe, 0xda, 0x55,
-  0xad, 0xad, 0xb6, 0xdd, 0xbe, 0xee, 0xea, 0xaa, 0x4a, 0xb5, 0xb5, 0x6b,
-  0x77, 0xfb, 0x6d, 0xba, 0x92, 0xbf, 0xff, 0x7f, 0xff, 0xed, 0xf7, 0xff,
-  0xa8, 0x80, 0x02, 0x4a, 0x54, 0x89, 0x44, 0x92, 0x4a, 0xaa, 0xa7, 0xfd,
-  0x56, 0xf7, 0xbb, 0xdb, 0xaf, 0xfe, 0xb7, 0xae, 0xd7, 0xd7, 0xdf, 0xfd,
-  0xef, 0xff, 0x7f, 0xdb, 0xdf, 0xfd, 0xfe, 0xf7, 0xfb, 0xfd, 0xef, 0xed,
-  0xf7, 0xfe, 0xff, 0xdf, 0xff, 0xff, 0x7f, 0xee, 0xdb, 0x6f, 0xdb, 0xff,
-  0x6d, 0xd5, 0x55, 0xb5, 0x5a, 0xab, 0x5b, 0x76, 0xaa, 0xd6, 0xaa, 0xad,
-  0xd7, 0xb6, 0xb6, 0xab, 0x6d, 0xde, 0xdf, 0x5b, 0xbb, 0x5f, 0xff, 0xfd,
-  0x48, 0x95, 0x77, 0xf7, 0x77, 0xff, 0xff, 0xb7, 0xc4, 0x52, 0x50, 0x09,
-  0x12, 0xaa, 0x52, 0x12, 0x52, 0xaa, 0x95, 0xbf, 0xeb, 0x5a, 0xed, 0x5d,
-  0xeb, 0xf7, 0xbd, 0xf7, 0xfa, 0xfd, 0x6f, 0xbf, 0x7d, 0xdf, 0xfd, 0xfe,
-  0xf6, 0xf7, 0xb7, 0xfe, 0xdf, 0xbf, 0xfd, 0xbf, 0x7f, 0xaf, 0xb7, 0xfb,
-  0x6d, 0xeb, 0xdb, 0x7f, 0xff, 0xff, 0x7e, 0xdf, 0xff, 0x6e, 0xb6, 0xad,
-  0xad, 0xd5, 0xad, 0x5a, 0xd5, 0x6b, 0x6f, 0x77, 0x7a, 0xed, 0xad, 0xb5,
-  0x5b, 0x77, 0xb5, 0xed, 0x7f, 0xf6, 0xff, 0xe8, 0xa4, 0x23, 0xff, 0xbf,
-  0xfe, 0xff, 0xfb, 0xfe, 0x92, 0x88, 0x82, 0x55, 0x49, 0x48, 0x88, 0x84,
-  0x89, 0x55, 0x4f, 0xfd, 0x76, 0xd7, 0x5b, 0xeb, 0x5e, 0xff, 0xef, 0x7d,
-  0x5f, 0xaf, 0x9f, 0xff, 0xef, 0xf7, 0x5f, 0xef, 0x7f, 0xbf, 0xff, 0xb7,
-  0xfd, 0xf7, 0x6f, 0xfb, 0xfd, 0xf5, 0xfe, 0xdf, 0xff, 0x7e, 0xff, 0xed,
-  0xb6, 0xdb, 0xef, 0xf7, 0xdb, 0xd5, 0xaa, 0xd6, 0xf5, 0x5a, 0xa1, 0x05,
-  0x6d, 0x55, 0xb5, 0x5b, 0xdf, 0x6d, 0xb6, 0xdf, 0xdb, 0xb5, 0xff, 0x77,
-  0xaa, 0xff, 0xb7, 0x7e, 0x05, 0x10, 0x1b, 0xff, 0xbf, 0xdd, 0xbd, 0xbf,
-  0xc8, 0x44, 0x10, 0x41, 0x55, 0x24, 0x04, 0x20, 0xaa, 0x55, 0x27, 0xdf,
-  0x5a, 0xba, 0xda, 0xad, 0x67, 0xf5, 0x7b, 0xd7, 0xd5, 0xf5, 0xd7, 0xf7,
-  0xf7, 0x7f, 0xf7, 0x7b, 0xdb, 0xf6, 0xdb, 0xfe, 0xef, 0xbd, 0xfd, 0xaf,
-  0xdf, 0xbf, 0xb7, 0xf6, 0xdb, 0xfb, 0xab, 0x7f, 0xff, 0xff, 0x7b, 0x7e,
-  0xfe, 0xb6, 0xab, 0x6a, 0xad, 0x55, 0x54, 0xd4, 0x95, 0x5a, 0xab, 0xed,
-  0x77, 0xdb, 0x6b, 0x68, 0xad, 0x7e, 0xab, 0xdd, 0x7f, 0xb6, 0xff, 0xf4,
-  0x20, 0x04, 0xaf, 0xef, 0xf7, 0xff, 0xff, 0xef, 0x42, 0x91, 0x45, 0x2a,
-  0x48, 0x91, 0x41, 0x14, 0x12, 0x94, 0xaf, 0xff, 0xff, 0xef, 0xff, 0xff,
-  0xdf, 0xbf, 0xd6, 0xfa, 0xff, 0x6e, 0xdf, 0xfe, 0xfd, 0xf7, 0xfd, 0xfe,
-  0xfd, 0xbf, 0xff, 0x6f, 0x7f, 0xdf, 0x6f, 0xfd, 0xff, 0xdd, 0xfb, 0x7f,
-  0xff, 0xdf, 0xff, 0xb6, 0xb6, 0xdb, 0xbf, 0xef, 0xb7, 0xd5, 0x5b, 0x5b,
-  0xaa, 0xa4, 0xaa, 0xf5, 0x7d, 0x56, 0xda, 0x6f, 0xba, 0xfb, 0x5b, 0x57,
-  0xb5, 0xab, 0xfd, 0x77, 0xd5, 0xff, 0xbb, 0xbd, 0x01, 0x20, 0x01, 0x7d,
-  0xfe, 0xef, 0xef, 0xfb, 0xc8, 0x94, 0x11, 0x15, 0x55, 0x48, 0x10, 0x81,
-  0x50, 0xaa, 0x5b, 0xfd, 0xdf, 0xff, 0xdd, 0xf7, 0xff, 0xfd, 0xfe, 0xde,
-  0xdb, 0xf6, 0xfb, 0x7f, 0xbf, 0xbe, 0xdf, 0xdf, 0xdf, 0xf6, 0xdb, 0xff,
-  0xeb, 0xff, 0xfd, 0xef, 0xed, 0xb7, 0xbf, 0xdb, 0x6d, 0xf5, 0xb7, 0xff,
-  0xff, 0xff, 0xed, 0xbf, 0xfd, 0x7b, 0x55, 0xb5, 0x6a, 0x95, 0xaa, 0x0a,
-  0xab, 0x55, 0xad, 0xbb, 0xef, 0x5d, 0xd6, 0xda, 0xda, 0xdd, 0x57, 0xdd,
-  0x7f, 0x75, 0xef, 0xec, 0x00, 0x04, 0x40, 0xb7, 0xbf, 0xfd, 0xfb, 0x7e,
-  0x02, 0x22, 0xa4, 0xa4, 0x94, 0x12, 0x84, 0x2a, 0x08, 0x55, 0x3f, 0xdf,
-  0xff, 0xfd, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xf7, 0xf7, 0xfe, 0xfb, 0xfd, 0xbf, 0xfd, 0xb6, 0xfd, 0xb5, 0xdf, 0x76,
-  0xff, 0xbd, 0xee, 0xff, 0xfe, 0xfd, 0xfa, 0xdb, 0xb5, 0xb6, 0xff, 0xf7,
-  0x6f, 0xad, 0xde, 0xdd, 0xaa, 0xaa, 0xab, 0x55, 0x7b, 0x7a, 0xb6, 0xdd,
-  0x7f, 0xed, 0x7a, 0xd5, 0x4a, 0x4a, 0xb5, 0x77, 0xab, 0xff, 0x7e, 0xee,
-  0x10, 0x00, 0x00, 0x17, 0xf7, 0xff, 0x7f, 0xba, 0x92, 0x88, 0x12, 0x2a,
-  0xa5, 0x40, 0x51, 0x02, 0xa5, 0x02, 0x8d, 0xff, 0x6a, 0xaf, 0x77, 0x5d,
-  0x6b, 0xef, 0x6f, 0xef, 0xf6, 0xbf, 0x5f, 0xdb, 0xfe, 0xff, 0x77, 0xff,
-  0xdf, 0xf6, 0xef, 0xff, 0xbf, 0xff, 0x7b, 0xff, 0xff, 0xef, 0xfb, 0xdb,
-  0x6f, 0xdf, 0x6f, 0xfe, 0xff, 0xff, 0xb6, 0xff, 0xfb, 0x75, 0x2a, 0xaa,
-  0xd5, 0x55, 0xd4, 0xad, 0xad, 0xad, 0xdb, 0x77, 0xed, 0xbb, 0xad, 0x5f,
-  0x55, 0x55, 0x6e, 0xda, 0xee, 0xbb, 0xdb, 0xf4, 0x00, 0x80, 0x24, 0x85,
-  0x7e, 0xdf, 0xfb, 0xf4, 0x24, 0x52, 0x89, 0x4a, 0x48, 0x2a, 0x08, 0x48,
-  0x54, 0xb5, 0x7f, 0xf5, 0xdf, 0xfb, 0xdd, 0xf7, 0xff, 0xfb, 0xfb, 0x7a,
-  0xbb, 0xd5, 0xdf, 0xff, 0x77, 0xbb, 0xff, 0x6f, 0xfb, 0xbf, 0x7d, 0xdb,
-  0xf7, 0x6f, 0xff, 0xdb, 0xb6, 0xbe, 0xbe, 0xff, 0xfd, 0xfb, 0xfe, 0xd7,
-  0xee, 0xdb, 0xff, 0xdd, 0xdf, 0xad, 0xb6, 0xef, 0x6d, 0x55, 0x57, 0xb6,
-  0xd5, 0x56, 0xad, 0xbf, 0x7f, 0xdd, 0xb5, 0xab, 0x6f, 0x55, 0xab, 0x5e,
-  0xbb, 0xde, 0xff, 0x7c, 0x88, 0x12, 0x00, 0x41, 0x2f, 0xf7, 0xdf, 0xfa,
-  0x21, 0x10, 0x44, 0x49, 0x4a, 0x81, 0x45, 0x25, 0x04, 0x91, 0x3f, 0xfe,
-  0xff, 0xde, 0xff, 0xff, 0xdb, 0xdf, 0xbf, 0xbf, 0xde, 0xfe, 0xed, 0xff,
-  0xbf, 0xdf, 0xbb, 0xfd, 0xde, 0xf7, 0xf7, 0x7f, 0x7d, 0xfb, 0xb6, 0xfe,
-  0xff, 0xeb, 0xef, 0xb5, 0xaf, 0xde, 0xb7, 0xfe, 0xbb, 0xfe, 0xdb, 0x7f,
-  0x76, 0xf2, 0xdb, 0x59, 0x5b, 0x6d, 0xb5, 0x55, 0x6d, 0xb5, 0xb6, 0xeb,
-  0xef, 0xf6, 0xee, 0xae, 0xa8, 0xaa, 0xf5, 0xd7, 0xd6, 0xfb, 0xbb, 0xd4,
-  0x00, 0x00, 0x00, 0x00, 0x2b, 0xfe, 0xfd, 0xa0, 0x8a, 0x4a, 0x11, 0x24,
-  0x21, 0x28, 0x20, 0x48, 0x51, 0x09, 0x7e, 0xfb, 0x6b, 0x7b, 0xdd, 0xba,
-  0xff, 0xfb, 0xef, 0xed, 0xf7, 0xb7, 0x9f, 0xf7, 0xf7, 0xfd, 0xff, 0x77,
-  0xef, 0xff, 0xbf, 0xfb, 0xdf, 0xbd, 0xff, 0xb7, 0xff, 0x7f, 0xfb, 0xff,
-  0xf6, 0xf7, 0xfb, 0x77, 0xff, 0xb7, 0xff, 0xef, 0xff, 0x5a, 0x6d, 0xee,
-  0xed, 0xb6, 0xdb, 0x77, 0x6d, 0xad, 0xaa, 0xbe, 0xfb, 0xf7, 0xba, 0xeb,
-  0x56, 0xab, 0x5e, 0xb5, 0x77, 0xdf, 0xde, 0xea, 0x00, 0x00, 0x44, 0x20,
-  0x00, 0x5f, 0xef, 0xc4, 0x41, 0x22, 0x89, 0x25, 0x08, 0x05, 0x15, 0x05,
-  0x04, 0x49, 0xef, 0xfb, 0x7f, 0xfe, 0xef, 0xdf, 0xdb, 0xee, 0xfa, 0xff,
-  0xbd, 0xfd, 0xef, 0x7f, 0xfe, 0xef, 0xef, 0xff, 0xfd, 0xb6, 0xfb, 0xbf,
-  0xf7, 0xff, 0xb6, 0xff, 0xb6, 0xda, 0xfe, 0xdb, 0x7f, 0xfd, 0xbf, 0xde,
-  0xda, 0xfe, 0xdb, 0x7f, 0x6d, 0xab, 0xb6, 0xb5, 0xb6, 0xda, 0xb6, 0xda,
-  0xb6, 0xf6, 0xdf, 0xef, 0xbf, 0x7d, 0x6f, 0x55, 0xb5, 0x56, 0xeb, 0x57,
-  0xbd, 0x7b, 0x7f, 0xb2, 0x80, 0x04, 0x00, 0x00, 0x00, 0xb7, 0xfc, 0x01,
-  0x14, 0x88, 0x00, 0x10, 0x81, 0x20, 0xa0, 0xa0, 0xa9, 0x05, 0x7f, 0xbd,
-  0xdb, 0xaf, 0xba, 0xf6, 0xff, 0xfb, 0xef, 0xb5, 0xef, 0x6f, 0x5f, 0xfd,
-  0xb7, 0xfd, 0xbb, 0x7b, 0x6f, 0xff, 0xbd, 0xed, 0x7b, 0x6d, 0xff, 0xdb,
-  0xff, 0x7f, 0xaf, 0xff, 0xdb, 0x6d, 0xd6, 0xf7, 0xff, 0xb7, 0xff, 0xf7,
-  0xff, 0xaa, 0xb6, 0xdd, 0x5b, 0x6b, 0xdb, 0x5b, 0xdb, 0x5a, 0xd5, 0x75,
-  0xef, 0xff, 0x6b, 0x76, 0xd6, 0xdb, 0x55, 0x6a, 0xd7, 0xff, 0xed, 0xca,
-  0x08, 0x80, 0x22, 0x08, 0x00, 0x0f, 0x7f, 0x28, 0x01, 0x40, 0x44, 0x94,
-  0x00, 0x14, 0x14, 0x2a, 0x40, 0x23, 0xfb, 0xfe, 0xff, 0xf5, 0xff, 0xbf,
-  0x6b, 0xdf, 0x7f, 0xff, 0x7b, 0xf7, 0xd7, 0xff, 0xff, 0xbf, 0xff, 0xdf,
-  0xfd, 0xb7, 0xff, 0xbf, 0xff, 0xff, 0xb7, 0x7f, 0xff, 0xdd, 0xfb, 0x6d,
-  0xff, 0xff, 0x7f, 0xfd, 0xb7, 0xfd, 0xb6, 0xbe, 0xd5, 0x55, 0xdb, 0x6b,
-  0xb5, 0xbd, 0x6d, 0xed, 0x6d, 0x6d, 0x6b, 0xbf, 0xbd, 0xdd, 0xfd, 0xdb,
-  0x7b, 0x6d, 0x77, 0x5b, 0xbd, 0x5b, 0x7f, 0x40, 0x00, 0x00, 0x00, 0x40,
-  0x00, 0x0b, 0xe8, 0x02, 0x42, 0xae, 0x80, 0x24, 0x80, 0x02, 0x82, 0x81,
-  0x2a, 0x8a, 0xff, 0xf5, 0x6d, 0xff, 0x6e, 0xef, 0xff, 0xfb, 0xeb, 0xbd,
-  0xde, 0xfd, 0xbf, 0x7f, 0xb6, 0xf7, 0xdf, 0xfb, 0xef, 0xfd, 0xb7, 0xf7,
-  0xdb, 0x6d, 0xfb, 0xed, 0xb6, 0xef, 0xbf, 0xff, 0x6d, 0xdb, 0xfb, 0x5f,
-  0xfd, 0x6f, 0xff, 0xff, 0xfe, 0xd5, 0x5b, 0x6e, 0xdd, 0xad, 0xb6, 0xb7,
-  0x6b, 0x57, 0x5d, 0xad, 0xff, 0xff, 0xae, 0xdd, 0xab, 0x6b, 0xb5, 0xfa,
-  0xef, 0xff, 0xdb, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x40, 0x05, 0x7c, 0x90,
-  0x01, 0x4b, 0x51, 0x24, 0x22, 0x50, 0x28, 0x29, 0x12, 0x4b, 0x5f, 0xff,
-  0x7f, 0xb7, 0xf7, 0xfb, 0x6f, 0xfd, 0xfd, 0xef, 0xf7, 0xdf, 0xaf, 0xdb,
-  0xff, 0xfe, 0xed, 0xbe, 0xbd, 0xdf, 0xfd, 0xdd, 0x7f, 0xff, 0xbf, 0x7f,
-  0xfe, 0xfb, 0xed, 0xb7, 0xff, 0xf6, 0xaf, 0xf6, 0xdf, 0xfd, 0xb7, 0x5d,
-  0xb7, 0x56, 0xed, 0xb5, 0xb6, 0xdb, 0x6d, 0xda, 0xdd, 0xea, 0xeb, 0x77,
-  0x5d, 0xee, 0xf7, 0xb6, 0xdd, 0xdd, 0x7f, 0x5f, 0x5b, 0xbd, 0xfe, 0x90,
-  0x00, 0x02, 0x00, 0x04, 0x00, 0x01, 0xa8, 0x02, 0x01, 0x55, 0xa4, 0x11,
-  0x00, 0xaa, 0xd5, 0x00, 0x44, 0x92, 0xfb, 0x7a, 0xed, 0xfd, 0xbe, 0xdf,
-  0xfb, 0xdf, 0x7f, 0xbd, 0xbd, 0xf7, 0xdf, 0xff, 0xbb, 0x77, 0xff, 0xfb,
-  0xfe, 0xfd, 0xde, 0xff, 0xfb, 0x6d, 0xef, 0xb7, 0xff, 0x5e, 0xff, 0xfb,
-  0x6d, 0xbf, 0xfd, 0xbf, 0xf7, 0x6f, 0xfb, 0xff, 0xfd, 0xb6, 0xb6, 0xdd,
-  0xb6, 0xdb, 0xbd, 0x6f, 0x76, 0xb6, 0xad, 0xbb, 0xef, 0xff, 0x5a, 0xf6,
-  0xed, 0x6f, 0xab, 0xfb, 0xfd, 0xef, 0xd7, 0x84, 0x00, 0x40, 0x10, 0x00,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x5a, 0xa0, 0x88, 0x14, 0xab, 0x76, 0xa0,
-  0x50, 0x4b, 0xff, 0xfb, 0x7f, 0xdf, 0xf7, 0xf6, 0xdf, 0xfb, 0xed, 0xef,
-  0xef, 0x7a, 0xd7, 0xff, 0xff, 0xbf, 0xfd, 0xdf, 0x6f, 0xdf, 0x7f, 0xef,
-  0x6f, 0xff, 0xfb, 0xfd, 0xb6, 0xfb, 0xb6, 0xdf, 0xff, 0xed, 0xb7, 0xeb,
-  0x7d, 0xfa, 0xdf, 0xbd, 0xb6, 0xad, 0xad, 0xb7, 0x6f, 0xbd, 0xd7, 0xb5,
-  0xad, 0x5b, 0x77, 0x6e, 0xfa, 0xef, 0xf7, 0xbd, 0xbb, 0xda, 0xfd, 0xbe,
-  0xdf, 0xbd, 0xfd, 0x60, 0x00, 0x00, 0x01, 0x00, 0x10, 0x00, 0x00, 0x90,
-  0x00, 0x04, 0x04, 0x52, 0x43, 0x69, 0x59, 0x04, 0x0a, 0xaa, 0xff, 0xfd,
-  0xdd, 0xf6, 0xde, 0xdf, 0xfb, 0xdf, 0x7f, 0xfb, 0x7b, 0xdf, 0xbf, 0xfb,
-  0xbf, 0xf6, 0xb7, 0xfd, 0xfb, 0xf7, 0xf7, 0x7b, 0xfb, 0xb6, 0xbf, 0x6f,
-  0xff, 0xdf, 0xff, 0xfd, 0xad, 0xfd, 0xfb, 0x7f, 0xaf, 0xdf, 0xfd, 0xdf,
-  0xfb, 0x76, 0xed, 0xdb, 0x7a, 0xed, 0x7a, 0xde, 0xfb, 0xd5, 0x5b, 0x77,
-  0x5f, 0x7b, 0xbd, 0xaf, 0xde, 0xff, 0x6f, 0xef, 0xed, 0xff, 0x77, 0xa8,
-  0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x04, 0x01, 0x20, 0x22, 0xa2, 0x12,
-  0x58, 0xba, 0xe8, 0x02, 0x48, 0x25, 0xb7, 0x7e, 0xfe, 0xff, 0xf7, 0xf6,
-  0xdf, 0xf7, 0xbd, 0xbf, 0xde, 0xfd, 0xdd, 0xbf, 0xf5, 0xff, 0xff, 0x6f,
-  0x7e, 0xde, 0xdd, 0xff, 0x7e, 0xff, 0xed, 0xff, 0xfa, 0xfb, 0x6b, 0x6f,
-  0xff, 0x6f, 0x5f, 0xed, 0xfd, 0x7d, 0xb7, 0xfd, 0xad, 0xad, 0xb6, 0xb6,
-  0xd7, 0xb7, 0xdf, 0xb5, 0xad, 0x7b, 0xad, 0xbd, 0xf7, 0xdf, 0xef, 0xf5,
-  0x77, 0xb7, 0xfe, 0xff, 0xff, 0xdf, 0xdd, 0xc0, 0x10, 0x01, 0x00, 0x09,
-  0x00, 0x00, 0x00, 0x10, 0x04, 0x00, 0x00, 0x88, 0x25, 0x4d, 0x00, 0x00,
-  0x12, 0x95, 0xff, 0xfb, 0xb7, 0xf7, 0x7e, 0xff, 0xff, 0xfd, 0xef, 0xed,
-  0xf7, 0xdf, 0x5f, 0xff, 0xbf, 0x77, 0xbb, 0xfd, 0xef, 0xf7, 0xff, 0xdb,
-  0xef, 0xdd, 0xff, 0x6d, 0xbe, 0xdf, 0xff, 0xfb, 0x77, 0xfb, 0xfb, 0x7f,
-  0xef, 0xef, 0xfe, 0xdf, 0xfd, 0xb6, 0xdb, 0xbb, 0xbd, 0xba, 0xd5, 0xdf,
-  0x6d, 0xaa, 0xed, 0xad, 0xba, 0xf6, 0xfa, 0xbf, 0xfd, 0xff, 0xff, 0xf6,
-  0xfd, 0xf5, 0xee, 0xf0, 0x00, 0x40, 0x00, 0x00, 0x02, 0x00, 0x00, 0x84,
-  0xa2, 0x94, 0x94, 0x45, 0x12, 0x00, 0x04, 0x52, 0x92, 0x4a, 0xff, 0xfd,
-  0xff, 0xbf, 0xf7, 0xb6, 0xd7, 0xdf, 0xfd, 0x7e, 0xba, 0xeb, 0xef, 0xfb,
-  0xff, 0xfb, 0xff, 0xbf, 0xfb, 0x7e, 0xdd, 0xff, 0x7f, 0x77, 0x6f, 0xff,
-  0xfd, 0xf6, 0xdb, 0x6f, 0xdf, 0x5e, 0xdf, 0xda, 0xfd, 0xbb, 0x6f, 0xfd,
-  0xb6, 0xdb, 0x6d, 0x6e, 0xeb, 0x6f, 0x7b, 0x6a, 0xd6, 0xdd, 0x56, 0xef,
-  0x6f, 0x5f, 0xff, 0xd5, 0x5f, 0xb5, 0xb7, 0x7f, 0xdf, 0xdf, 0xfb, 0xb0,
-  0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x10, 0x08, 0x21, 0x02, 0x92,
-  0x44, 0x81, 0x21, 0x04, 0x04, 0x95, 0xdf, 0xfb, 0x7d, 0xf7, 0xbe, 0xff,
-  0xff, 0xf6, 0xb7, 0xd7, 0xff, 0xfe, 0x9f, 0xff, 0xad, 0xbf, 0xbb, 0xef,
-  0xbf, 0xdf, 0xee, 0xdb, 0xdb, 0xff, 0xfd, 0xb7, 0xde, 0xbf, 0xff, 0xfe,
-  0xf7, 0xf6, 0xf6, 0xff, 0x6f, 0xff, 0xfb, 0x7f, 0xf7, 0x6a, 0xb7, 0xb6,
-  0xbb, 0xf5, 0xdb, 0x77, 0x76, 0xd6, 0xdb, 0x6b, 0x75, 0xeb, 0x6e, 0xff,
-  0xf5, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xde, 0xf0, 0x00, 0x00, 0x08, 0x00,
-  0x40, 0x00, 0x00, 0x02, 0x42, 0x88, 0xa8, 0x92, 0x00, 0x08, 0x00, 0x20,
-  0xa0, 0xa6, 0xf7, 0xfb, 0xaf, 0xfd, 0xf7, 0x6a, 0xdb, 0xff, 0xff, 0xfe,
-  0xd6, 0xb7, 0xee, 0xdf, 0xff, 0xfd, 0xde, 0xf6, 0xef, 0xf6, 0xff, 0xff,
-  0x7f, 0xbb, 0x6f, 0xfd, 0xfb, 0xf6, 0xda, 0xd7, 0xff, 0xbf, 0xbf, 0xb7,
-  0xfd, 0xb6, 0xdf, 0xdd, 0xba, 0xdd, 0xda, 0xdb, 0xdd, 0x5e, 0xbd, 0xba,
-  0xdb, 0x75, 0x6d, 0xbd, 0xde, 0xbd, 0xff, 0xaa, 0xbf, 0x7b, 0x7b, 0xdd,
-  0xef, 0xef, 0xf5, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x08, 0x10,
-  0x14, 0x52, 0x0a, 0xa4, 0xa4, 0x80, 0x24, 0x8a, 0x14, 0x17, 0xff, 0x7d,
-  0xfe, 0xdf, 0xbf, 0xff, 0xff, 0xd6, 0xda, 0xef, 0xff, 0xfd, 0xbf, 0xfb,
-  0xef, 0x6f, 0xff, 0xff, 0xfd, 0x7f, 0x7b, 0xb7, 0xed, 0xdf, 0xfb, 0x5f,
-  0xfd, 0xbf, 0xff, 0xfb, 0x5b, 0xd5, 0xed, 0xfb, 0x6f, 0xff, 0xfd, 0xff,
-  0xdb, 0x6d, 0x56, 0xda, 0xd7, 0xf7, 0xad, 0xd7, 0x5b, 0x5b, 0x2a, 0xd7,
-  0x6b, 0xae, 0xab, 0xef, 0xeb, 0xdf, 0xdf, 0xff, 0xff, 0xf5, 0xbd, 0xf8,
-  0x00, 0x00, 0x00, 0x40, 0x00, 0x40, 0x00, 0x04, 0x85, 0x09, 0x42, 0x54,
-  0x90, 0x09, 0x04, 0x40, 0x82, 0x9b, 0xff, 0xfe, 0xb7, 0xed, 0xed, 0xde,
-  0xd7, 0xff, 0xff, 0x7a, 0xdb, 0x6f, 0xaf, 0xfe, 0xfb, 0xff, 0xf6, 0xde,
-  0xb7, 0xdf, 0xde, 0xfd, 0xff, 0xfb, 0x6f, 0xfe, 0xff, 0xed, 0xb6, 0xff,
-  0xff, 0xff, 0x7f, 0x7f, 0xfb, 0x6b, 0x6f, 0x76, 0xed, 0xab, 0xbb, 0x6e,
-  0xed, 0x5a, 0xf6, 0xba, 0xd5, 0xa8, 0x85, 0x6d, 0xb6, 0xd5, 0xfe, 0xf5,
-  0x5e, 0xf6, 0xfb, 0x7e, 0xed, 0xbf, 0xea, 0xa0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x01, 0x01, 0x22, 0xa4, 0x29, 0x22, 0x4a, 0x40, 0x41, 0x14,
-  0x50, 0x5e, 0xff, 0xf5, 0xff, 0xff, 0xbf, 0x77, 0xff, 0xd6, 0xdf, 0xef,
-  0xf7, 0xfa, 0xdf, 0xff, 0xff, 0xed, 0x7f, 0xf7, 0xff, 0xed, 0xef, 0xdf,
-  0xb6, 0xdf, 0xfb, 0x6f, 0xb5, 0x7f, 0xff, 0xb6, 0xdb, 0x5b, 0xdb, 0xdb,
-  0x5f, 0xff, 0xf7, 0xff, 0x56, 0xba, 0xad, 0xb6, 0xb7, 0x6e, 0xb6, 0xef,
-  0x76, 0xae, 0xaa, 0xaa, 0xda, 0x45, 0x57, 0xbd, 0xf6, 0xbf, 0xdf, 0xef,
-  0xff, 0xfe, 0xfe, 0xf0, 0x10, 0x10, 0x00, 0x08, 0x10, 0x00, 0x00, 0x20,
-  0x10, 0x92, 0x88, 0x92, 0x49, 0x0a, 0x28, 0x02, 0x05, 0x2f, 0xb7, 0xfe,
-  0xb6, 0xed, 0xf7, 0xfe, 0xdb, 0xff, 0xed, 0xfe, 0xbb, 0x5f, 0xd7, 0x7f,
-  0x6f, 0x7f, 0xb7, 0x7f, 0xb6, 0xff, 0xfe, 0xfb, 0xff, 0xfb, 0x7f, 0xff,
-  0xff, 0xdb, 0x6d, 0xff, 0xff, 0xf6, 0xff, 0x7f, 0xf5, 0xb6, 0xdd, 0xbf,
-  0xd5, 0xd6, 0xd6, 0xdb, 0xda, 0xdb, 0xbd, 0xb5, 0xab, 0x69, 0x6d, 0xb6,
-  0xb6, 0xb5, 0x7a, 0xeb, 0x5f, 0xd5, 0x7b, 0xbe, 0xee, 0xdb, 0xb5, 0xa0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xa5, 0x24, 0x22, 0x25,
-  0x24, 0xa1, 0x02, 0x90, 0x91, 0x7f, 0xff, 0xf5, 0xff, 0xff, 0xbd, 0xb7,
-  0xbf, 0xdb, 0x7f, 0x6f, 0xff, 0xfb, 0x7f, 0xff, 0xfb, 0xf7, 0xff, 0xed,
-  0xff, 0xbb, 0x77, 0xfd, 0xb6, 0xdf, 0xed, 0xb6, 0xfa, 0xff, 0xff, 0x6d,
-  0xb7, 0xbe, 0xdb, 0xeb, 0x7f, 0xff, 0xff, 0xed, 0x6d, 0x5a, 0xdb, 0x6d,
-  0x6f, 0x6d, 0xad, 0xb6, 0xb5, 0x56, 0xaa, 0xdb, 0xdb, 0xaa, 0xaf, 0xde,
-  0xea, 0xff, 0xdd, 0xf7, 0x7f, 0xff, 0xfa, 0xf0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x08, 0x91, 0x00, 0x00, 0x81, 0x29, 0x10, 0xa4, 0x95, 0x50, 0x84,
-  0x09, 0xf6, 0xfe, 0xfd, 0xab, 0x6d, 0xef, 0xbd, 0xf7, 0xdf, 0xf7, 0xf6,
-  0xda, 0xdf, 0xaf, 0xf7, 0x7f, 0x7f, 0xfd, 0xff, 0xb7, 0xef, 0xde, 0xbf,
-  0xff, 0xfb, 0x7f, 0xff, 0xb7, 0xdb, 0x6f, 0xff, 0xfd, 0xef, 0xfe, 0xff,
-  0xdb, 0x6b, 0x6d, 0xff, 0xab, 0x6d, 0x6a, 0xb6, 0xda, 0xd5, 0x6e, 0xdb,
-  0x5a, 0xaa, 0xaa, 0xad, 0x6a, 0xdd, 0xda, 0xb5, 0xbf, 0x56, 0xf7, 0x7f,
-  0xee, 0xdb, 0x7d, 0xa0, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x24, 0x40, 0x4a, 0x52, 0x50, 0x04, 0x20, 0x87, 0xff, 0xff, 0xfb,
-  0xfe, 0xfb, 0x7b, 0xef, 0x5f, 0xf5, 0x5d, 0xbf, 0xff, 0xf6, 0xdf, 0x7f,
-  0xef, 0xf6, 0xdf, 0x76, 0xfe, 0xfd, 0xff, 0xed, 0xb6, 0xdf, 0xed, 0x5f,
-  0xfa, 0xff, 0xfd, 0xb6, 0xdf, 0x75, 0x57, 0xb6, 0xff, 0xff, 0xff, 0x7a,
-  0xb5, 0xab, 0x56, 0xd6, 0xd6, 0xdd, 0xab, 0x6d, 0xad, 0xbb, 0xbb, 0x6b,
-  0x5b, 0x6d, 0x6d, 0xdf, 0xd5, 0xfb, 0xbf, 0xd6, 0xf7, 0xff, 0xdd, 0xe0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x24, 0x02, 0x4a, 0x05,
-  0x12, 0x8a, 0xa1, 0x04, 0xaf, 0xbf, 0x6f, 0xfd, 0x57, 0xdf, 0xde, 0xfb,
-  0xfb, 0xff, 0xff, 0xf6, 0xad, 0xbf, 0x6f, 0xff, 0xfb, 0xbf, 0xf7, 0xff,
-  0xb7, 0xdf, 0x6f, 0x7f, 0xff, 0xfb, 0x7f, 0xf7, 0xff, 0xb6, 0xd7, 0xef,
-  0xff, 0xdf, 0xfd, 0xff, 0xb5, 0xbb, 0x6f, 0xfd, 0xaa, 0xda, 0xb5, 0xb5,
-  0xbb, 0x56, 0xb5, 0xb6, 0xd6, 0xd5, 0x6d, 0xbd, 0xed, 0xab, 0xb7, 0x75,
-  0x7e, 0xae, 0xea, 0xff, 0xbe, 0xed, 0xf7, 0x40, 0x04, 0x04, 0x00, 0x00,
-  0x08, 0x00, 0x08, 0x09, 0x00, 0x40, 0x11, 0x50, 0xa4, 0x51, 0x08, 0x52,
-  0x7b, 0xf7, 0xff, 0xb5, 0xfd, 0x7b, 0xfb, 0xbe, 0xdf, 0xae, 0xdb, 0x7f,
-  0xff, 0xeb, 0xbf, 0xfb, 0x7f, 0xfb, 0xdf, 0x7b, 0xfe, 0xf7, 0xfb, 0xed,
-  0xb6, 0xdf, 0xf7, 0x7d, 0xb5, 0xff, 0xff, 0x76, 0xb6, 0xf6, 0xdf, 0xb5,
-  0xff, 0xdf, 0xfb, 0x6e, 0xad, 0x56, 0xd6, 0xb6, 0xd5, 0x55, 0xae, 0xdb,
-  0x75, 0x6d, 0xad, 0xad, 0x6e, 0xfd, 0xbd, 0xdf, 0xab, 0xfb, 0xbf, 0xb5,
-  0xf7, 0x7f, 0xbf, 0xa8, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
-  0x00, 0x02, 0x88, 0x04, 0x12, 0x08, 0xa2, 0x03, 0x7f, 0xff, 0xff, 0xfd,
-  0x6f, 0xde, 0xdf, 0xd7, 0xef, 0xf7, 0xff, 0xed, 0xb5, 0x7d, 0xdb, 0xbf,
-  0xdd, 0xfe, 0xfb, 0xdd, 0xb7, 0xfd, 0xbf, 0x7f, 0xff, 0xfb, 0x7d, 0xff,
-  0xff, 0x6d, 0xeb, 0xff, 0xff, 0xbf, 0xf6, 0xff, 0xb6, 0xf5, 0xbf, 0xfb,
-  0x6a, 0xdb, 0x5b, 0x5b, 0x55, 0xaa, 0xd5, 0x55, 0x5b, 0x5b, 0x76, 0xd7,
-  0x75, 0xaf, 0xf7, 0x6a, 0xf6, 0xae, 0xea, 0xef, 0x7f, 0xed, 0xf6, 0xa0,
-  0x00, 0x00, 0x00, 0x08, 0x00, 0x04, 0x02, 0x00, 0x22, 0x00, 0x05, 0x52,
-  0xa4, 0x80, 0x08, 0xad, 0xfd, 0xbb, 0x77, 0xfb, 0xda, 0xf7, 0xb5, 0xfd,
-  0xfb, 0xfe, 0xdb, 0x7f, 0xff, 0xef, 0x5f, 0xff, 0xff, 0x7f, 0xff, 0xff,
-  0xff, 0x5f, 0xdb, 0xf7, 0x76, 0xdf, 0xdf, 0x6f, 0xeb, 0xff, 0x7d, 0xb6,
-  0xdd, 0xea, 0xbf, 0x6d, 0xff, 0x7f, 0xed, 0xbd, 0x5b, 0x6a, 0xd5, 0x6d,
-  0x6d, 0x6d, 0x77, 0x7e, 0xdb, 0x6d, 0x5b, 0x7b, 0x5d, 0xf6, 0xff, 0xff,
-  0x5a, 0xb6, 0xbf, 0x7b, 0xdb, 0x7f, 0xbf, 0x81, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x00, 0x22, 0x00, 0x40, 0x01, 0x08, 0x80, 0x44, 0x04, 0x2f,
-  0xdf, 0xff, 0xff, 0xfd, 0x6d, 0x5a, 0xde, 0xad, 0x5f, 0xd7, 0xff, 0xb6,
-  0xdb, 0x7b, 0xdf, 0xff, 0xef, 0xb7, 0xbb, 0x7d, 0xb7, 0xfb, 0xff, 0x7d,
-  0xdf, 0xf6, 0xf7, 0xfd, 0xfe, 0xb7, 0xff, 0xff, 0xff, 0x7f, 0xed, 0xff,
-  0x5b, 0xdd, 0xbf, 0xeb, 0x6d, 0x55, 0x6d, 0xab, 0x55, 0x56, 0xda, 0xcb,
-  0x55, 0xb7, 0x6d, 0xaa, 0xee, 0xbf, 0xbb, 0x55, 0xd6, 0xdb, 0xab, 0xae,
-  0xbe, 0xda, 0xf6, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80,
-  0x00, 0x00, 0x40, 0x22, 0x10, 0x11, 0x01, 0x5f, 0xff, 0xdf, 0x7d, 0xef,
-  0xff, 0xff, 0xf7, 0xff, 0xef, 0xfa, 0xaa, 0xdd, 0xbd, 0xd6, 0xbd, 0xed,
-  0xbf, 0xfd, 0xff, 0xdf, 0xfd, 0xde, 0xdb, 0xdf, 0xf7, 0x7f, 0xbd, 0xbe,
-  0xd7, 0xfd, 0xb6, 0xd6, 0xb7, 0xd6, 0xff, 0xdb, 0xff, 0xef, 0xf5, 0xfb,
-  0x55, 0x5b, 0x56, 0xda, 0xb5, 0xaa, 0xab, 0x75, 0xb6, 0xd5, 0x55, 0x6f,
-  0x6b, 0xdb, 0xff, 0xfd, 0x7a, 0xaa, 0xfa, 0xfb, 0xd7, 0xff, 0xbf, 0x48,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x21, 0x76, 0xed, 0xfb, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfb,
-  0xff, 0xff, 0xff, 0xff, 0xdf, 0xff, 0xdf, 0xff, 0xfb, 0xbf, 0xdd, 0xfb,
-  0xbf, 0xff, 0xff, 0x7d, 0xfd, 0xdb, 0xf7, 0xef, 0xfb, 0x6f, 0xff, 0xff,
-  0xfd, 0x7f, 0xad, 0x7e, 0xda, 0xfb, 0x7f, 0xfd, 0xb7, 0xb5, 0x6b, 0x6d,
-  0xaa, 0xb6, 0xdd, 0x55, 0x5a, 0xab, 0x6d, 0xb5, 0x7d, 0x7f, 0x6d, 0xb7,
-  0x95, 0x56, 0xaf, 0x5e, 0xfd, 0x6f, 0xef, 0xa8, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x40, 0x10, 0x00, 0x10, 0x00, 0x00, 0x04, 0x08, 0x8b, 0xff,
-  0xff, 0xff, 0xdf, 0xff, 0x7f, 0xdf, 0xfd, 0xdf, 0xff, 0xff, 0xff, 0xff,
-  0xfe, 0xff, 0xff, 0xff, 0xdf, 0xfe, 0xff, 0xdf, 0xf6, 0xdb, 0x77, 0xee,
-  0xdf, 0xfd, 0xbe, 0xff, 0xef, 0xfb, 0x6d, 0xb6, 0xdf, 0xb5, 0xff, 0xb7,
-  0xff, 0xdf, 0xad, 0x6e, 0xaa, 0xdd, 0xb5, 0x55, 0x55, 0x55, 0x65, 0x55,
-  0x55, 0x6d, 0x56, 0xdb, 0x57, 0x6b, 0xff, 0xba, 0xd5, 0x55, 0xb5, 0xeb,
-  0xaf, 0x7d, 0x7b, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x02,
-  0x04, 0x00, 0x00, 0x00, 0x00, 0x80, 0x2b, 0xbf, 0x7e, 0xdd, 0xff, 0xf7,
-  0xfb, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xfd, 0xff, 0x7f,
-  0xfb, 0xb7, 0xee, 0xfe, 0x7f, 0xff, 0xde, 0xff, 0xf6, 0xdf, 0xf7, 0xbb,
-  0xf5, 0xbf, 0xff, 0xff, 0xfe, 0xef, 0x6f, 0xfd, 0x5b, 0x76, 0xff, 0xfa,
-  0xd5, 0x6b, 0x5b, 0x6d, 0x6b, 0x55, 0x5a, 0xaa, 0xad, 0x55, 0xaa, 0xad,
-  0xbb, 0xbd, 0x5b, 0xef, 0x6a, 0xb6, 0xdb, 0x5d, 0x77, 0xd7, 0xee, 0xc0,
-  0x00, 0x00, 0x00, 0x02, 0x02, 0x00, 0x00, 0x80, 0x20, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0xbf, 0xf7, 0xef, 0xff, 0xfb, 0xff, 0xdf, 0xf7, 0xff, 0xfe,
-  0xef, 0xff, 0xff, 0x7f, 0xff, 0xdf, 0xef, 0xed, 0xff, 0xff, 0x7f, 0xd7,
-  0xdb, 0x6d, 0xff, 0xbb, 0x7f, 0xed, 0xbd, 0xfd, 0xbf, 0xed, 0xad, 0x6b,
-  0x6f, 0x7b, 0xfb, 0x6f, 0xff, 0xff, 0xfb, 0xdb, 0x5d, 0xad, 0xda, 0xb7,
-  0x5a, 0xab, 0x55, 0x55, 0xab, 0x6d, 0x76, 0xea, 0xaa, 0xd7, 0xdd, 0x6b,
-  0x6e, 0xda, 0xad, 0x77, 0xb5, 0x7b, 0xff, 0xe0, 0x04, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x88, 0x01, 0x00, 0x01, 0x5d, 0xff,
-  0xff, 0xfe, 0xde, 0xbd, 0xfe, 0xff, 0xdf, 0xff, 0xff, 0xef, 0x77, 0xfb,
-  0xdf, 0xff, 0xff, 0xfe, 0xdd, 0xf7, 0xfb, 0xfb, 0xff, 0xff, 0xb7, 0xef,
-  0xdb, 0x7f, 0xf7, 0xff, 0xea, 0xff, 0xff, 0xff, 0xff, 0xde, 0xdf, 0xfd,
-  0xab, 0x5b, 0x5e, 0xf5, 0x6b, 0x76, 0xad, 0xaa, 0xab, 0x55, 0x55, 0x5a,
-  0xad, 0xb7, 0xad, 0xbd, 0xdf, 0x6d, 0x6b, 0x5a, 0xd5, 0x6d, 0x57, 0x5a,
-  0xdf, 0xde, 0xdb, 0x28, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x10,
-  0x00, 0x10, 0x00, 0x00, 0x01, 0x4b, 0xff, 0xbb, 0x76, 0xdf, 0xff, 0xff,
-  0xef, 0xbd, 0xf5, 0xaf, 0x76, 0xfb, 0xff, 0xbf, 0xfb, 0xfd, 0xfb, 0xff,
-  0xff, 0x7f, 0x6e, 0xff, 0xdb, 0x6d, 0xfe, 0xfd, 0xff, 0xfd, 0xbd, 0x5f,
-  0xff, 0x5a, 0xdb, 0x6d, 0xba, 0xf7, 0xf5, 0xaf, 0xfb, 0xff, 0xf7, 0xfd,
-  0xad, 0x5b, 0xf6, 0xda, 0xda, 0xaa, 0x95, 0x45, 0x55, 0x54, 0xb6, 0xd7,
-  0x75, 0xbb, 0x6d, 0x6e, 0xb5, 0xab, 0xb3, 0x6e, 0xf5, 0x6f, 0xff, 0xa0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x88, 0x02, 0x00, 0x00, 0x00, 0x40,
-  0x00, 0x7e, 0xff, 0xff, 0xff, 0xf6, 0xf7, 0xee, 0xff, 0xfe, 0xff, 0xf7,
-  0xff, 0x7f, 0xdd, 0xfb, 0x7d, 0xaf, 0x5f, 0x6f, 0xef, 0xfb, 0xff, 0xdf,
-  0xff, 0xff, 0xb7, 0xbf, 0x6d, 0xaf, 0xff, 0xfb, 0x57, 0xff, 0xff, 0xff,
-  0xff, 0xbd, 0x7f, 0xfb, 0x7e, 0xd5, 0xbd, 0xaa, 0xdb, 0xb5, 0x5a, 0xb6,
-  0xad, 0x50, 0x52, 0xb5, 0x55, 0x57, 0x5b, 0x7a, 0xdb, 0x6d, 0xb7, 0xaa,
-  0xdb, 0x6d, 0x55, 0xb5, 0xaf, 0xfb, 0x6f, 0xd2, 0x00, 0x00, 0x20, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x01, 0xdf, 0xdb, 0xdf,
-  0xbf, 0xff, 0xde, 0xff, 0xf7, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0xff, 0xdf,
-  0xff, 0xff, 0xfb, 0xfb, 0x7f, 0x7f, 0xf7, 0x77, 0xdd, 0xdd, 0xfd, 0xf7,
-  0xff, 0xfe, 0xed, 0xff, 0xfd, 0xb7, 0x6d, 0xaa, 0xdd, 0xef, 0xb6, 0xdf,
-  0xb7, 0xff, 0xef, 0xfd, 0x6d, 0xaf, 0x6f, 0xb5, 0xb5, 0x52, 0xaa, 0x95,
-  0x55, 0x69, 0x55, 0x96, 0xad, 0x55, 0x59, 0x6a, 0xaa, 0xb5, 0x56, 0xde,
-  0xfb, 0x5f, 0xfb, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x04, 0x00, 0x00, 0x00, 0x77, 0xff, 0xfb, 0xed, 0xbf, 0xff, 0xff,
-  0xfb, 0xff, 0xbb, 0xfd, 0xdf, 0xdf, 0xff, 0xff, 0xdf, 0xfb, 0xff, 0xff,
-  0xfb, 0xdd, 0xbf, 0xfb, 0xf7, 0xf7, 0xb7, 0xbd, 0xb6, 0xd7, 0xbf, 0x7f,
-  0xaf, 0xfd, 0xfb, 0xff, 0xff, 0x5b, 0xff, 0xf6, 0xfd, 0x6d, 0xbd, 0xd6,
-  0xb5, 0x75, 0xb5, 0x6e, 0xd6, 0x8a, 0xaa, 0xaa, 0xad, 0xaf, 0x6a, 0xeb,
-  0x56, 0xdb, 0xad, 0x55, 0x5b, 0x5a, 0xdb, 0x6f, 0xb7, 0xed, 0xbf, 0x80,
-  0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x04, 0x00, 0x02, 0x00, 0x44, 0x02,
-  0x11, 0xfd, 0xfb, 0xff, 0xff, 0xf7, 0xff, 0x6d, 0xbf, 0xef, 0xff, 0x7f,
-  0xfb, 0xfe, 0xdd, 0xfb, 0xfb, 0xdf, 0xbd, 0xbf, 0xbf, 0xff, 0xfb, 0xff,
-  0xbf, 0x7f, 0xff, 0xef, 0xff, 0xfb, 0xeb, 0xdb, 0xfb, 0x6e, 0xdf, 0x7b,
-  0x6d, 0xfe, 0xda, 0xbf, 0xef, 0xff, 0xef, 0xfb, 0x5b, 0x5a, 0xdb, 0x6a,
-  0xaa, 0xaa, 0xaa, 0xd5, 0xb5, 0x6b, 0x5d, 0x5d, 0xf6, 0xda, 0xeb, 0x55,
-  0x55, 0x5b, 0x55, 0xb5, 0xfd, 0x7f, 0xed, 0xc0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf, 0xbe, 0xde,
-  0xff, 0xfd, 0xb7, 0xff, 0xfe, 0xfd, 0xff, 0xdf, 0xff, 0xff, 0xff, 0xbe,
-  0xfd, 0xff, 0xff, 0xfb, 0xde, 0xef, 0xbe, 0xdf, 0xd4, 0xab, 0x75, 0xbd,
-  0xb6, 0xff, 0x7e, 0xff, 0xaf, 0xff, 0xf6, 0xdf, 0xff, 0x6d, 0xf7, 0xeb,
-  0x7d, 0xb5, 0xbb, 0x6d, 0xaa, 0xd6, 0xb6, 0xdd, 0xb5, 0x6b, 0x6a, 0xad,
-  0x56, 0xb5, 0xeb, 0xb6, 0xad, 0xb7, 0x5d, 0xaa, 0xaa, 0xb5, 0x6e, 0xdf,
-  0x6f, 0xdb, 0xff, 0x40, 0x00, 0x40, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02,
-  0x00, 0x00, 0x00, 0x00, 0x05, 0xfe, 0xff, 0xff, 0xdb, 0x7f, 0xff, 0xff,
-  0xff, 0xff, 0xbb, 0xfb, 0x7d, 0xdf, 0xff, 0xff, 0xdf, 0xf7, 0xdf, 0xdf,
-  0xff, 0xfb, 0xff, 0xf7, 0x6a, 0x8b, 0xbf, 0xff, 0xff, 0xdb, 0xf7, 0xff,
-  0xba, 0xad, 0xbf, 0xfb, 0x7b, 0xef, 0xbe, 0xff, 0xaf, 0xff, 0xff, 0xfa,
-  0xad, 0x5b, 0xb6, 0xd6, 0xaa, 0xad, 0x55, 0x55, 0xb5, 0xad, 0x5e, 0xdb,
-  0x77, 0xbd, 0xf6, 0xed, 0x52, 0x5b, 0x6a, 0xeb, 0xf6, 0xde, 0xbb, 0xf0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x01, 0x6f, 0xf7, 0xf7, 0xff, 0xdf, 0xfe, 0xdb, 0xb7, 0xef, 0xff, 0xff,
-  0xff, 0xfb, 0xdb, 0xff, 0xff, 0x7e, 0xfd, 0xfd, 0xf7, 0x7f, 0xb6, 0xfb,
-  0xb6, 0xa8, 0xed, 0xad, 0xb6, 0xff, 0x7d, 0xb7, 0xdf, 0xff, 0xed, 0xaf,
-  0xde, 0xba, 0xeb, 0x51, 0x50, 0x88, 0x82, 0x4d, 0xaa, 0xed, 0x6d, 0xb5,
-  0xdb, 0x6b, 0x6a, 0xaa, 0xad, 0x76, 0xeb, 0x6e, 0xda, 0xeb, 0x5b, 0x56,
-  0xaa, 0xad, 0x5f, 0x5d, 0xbf, 0xf7, 0xee, 0x80, 0x00, 0x00, 0x00, 0x00,
-  0x10, 0x00, 0x00, 0x00, 0x00, 0x80, 0x00, 0x80, 0x0b, 0xff, 0xbe, 0xde,
-  0xff, 0xfb, 0x6f, 0xff, 0xfe, 0xff, 0xdf, 0xff, 0xbf, 0xff, 0x7f, 0x6e,
-  0xff, 0xfb, 0xef, 0xff, 0xbf, 0xfb, 0xff, 0xdf, 0x55, 0x4a, 0x17, 0xff,
-  0xff, 0xb7, 0xaf, 0xfd, 0xd6, 0xed, 0x7f, 0xf6, 0xf7, 0xdb, 0x54, 0x4a,
-  0x56, 0x55, 0x59, 0x55, 0x55, 0x57, 0x56, 0xda, 0xaa, 0xb5, 0x5b, 0x6d,
-  0x56, 0xab, 0x5b, 0x76, 0xdf, 0xbd, 0xdb, 0x7a, 0xaa, 0xad, 0xd5, 0xee,
-  0xea, 0xbe, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x05, 0xbb, 0xff, 0xff, 0xfb, 0xff, 0xff, 0xfd,
-  0xff, 0xfd, 0xfd, 0xb7, 0xee, 0xdf, 0xff, 0xff, 0xf7, 0xbf, 0xff, 0x6f,
-  0xff, 0xbd, 0xff, 0xff, 0xaa, 0x15, 0x52, 0xad, 0xb7, 0xfd, 0xfb, 0xff,
-  0xbf, 0xbf, 0xd6, 0xff, 0xfa, 0xa4, 0x02, 0x95, 0x29, 0x4a, 0xa5, 0x55,
-  0xaa, 0xb5, 0xaa, 0xad, 0x55, 0xaf, 0x6d, 0x55, 0xab, 0x5a, 0xd5, 0xab,
-  0x6a, 0xd6, 0xb5, 0x97, 0x75, 0x56, 0xb6, 0xbb, 0xbf, 0xeb, 0xb7, 0xa0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x17, 0xff, 0xdf, 0xff, 0x6f, 0x7f, 0xf7, 0x7f, 0xbf, 0x6f, 0xff, 0xff,
-  0xff, 0xff, 0xfb, 0xf7, 0xbf, 0xfe, 0xf7, 0xfd, 0xed, 0xff, 0xad, 0xed,
-  0x90, 0x84, 0x94, 0x25, 0xfe, 0xdf, 0xdd, 0xb7, 0xed, 0xed, 0xff, 0xb5,
-  0x54, 0x92, 0xa8, 0x24, 0x8a, 0x52, 0x55, 0x2a, 0xed, 0xaa, 0xb5, 0x55,
-  0x55, 0x6b, 0x55, 0x5a, 0xb5, 0x6a, 0xb6, 0xbb, 0x5a, 0xb5, 0xde, 0xf5,
-  0xad, 0x56, 0xdb, 0xdf, 0xd5, 0x7b, 0xfd, 0xe0, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x17, 0xdd, 0xf7, 0x77,
-  0xff, 0xf7, 0x7f, 0xdf, 0xf7, 0xff, 0xef, 0xfd, 0xff, 0xfb, 0xbf, 0xff,
-  0xfd, 0xef, 0xff, 0xff, 0xff, 0xdf, 0xff, 0x7f, 0x00, 0x52, 0x41, 0x48,
-  0x57, 0xf6, 0xf7, 0xfe, 0xbf, 0xbf, 0x6b, 0x7d, 0x12, 0x21, 0x05, 0x92,
-  0xa2, 0xa9, 0x24, 0x95, 0x56, 0xb5, 0xaa, 0xd6, 0xd6, 0xda, 0xdb, 0x6a,
-  0xdb, 0xbd, 0xab, 0x5d, 0xb6, 0xde, 0xab, 0x5b, 0x6a, 0xb5, 0xb6, 0xeb,
-  0x7b, 0xde, 0xdf, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00,
-  0x80, 0x00, 0x00, 0x00, 0x09, 0x6a, 0xaa, 0xdf, 0xff, 0xdf, 0xff, 0xfd,
-  0xff, 0xfb, 0x7e, 0xff, 0xb7, 0xbf, 0xfe, 0xfd, 0xff, 0xff, 0x7b, 0x6e,
-  0xff, 0xfb, 0xf7, 0xfe, 0x02, 0x09, 0x28, 0x4a, 0x95, 0xbf, 0x7d, 0xdf,
-  0xd5, 0xfb, 0xff, 0x49, 0x52, 0x94, 0xa4, 0x52, 0x29, 0x14, 0x92, 0xa5,
-  0x6a, 0xaa, 0xab, 0x6b, 0x5b, 0x6f, 0x6a, 0xab, 0x55, 0x46, 0xb5, 0xd6,
-  0xdb, 0x55, 0xed, 0xad, 0xbb, 0x56, 0xd7, 0x7b, 0xad, 0x77, 0xed, 0xf0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x2a, 0x56, 0xaa, 0x52, 0xbb, 0xff, 0xbb, 0xff, 0xbf, 0x7f, 0xff, 0xdf,
-  0xff, 0xff, 0xdf, 0xdf, 0xef, 0x77, 0xbf, 0xff, 0xb6, 0xff, 0x7f, 0xb7,
-  0x00, 0x00, 0x01, 0x24, 0x4f, 0xf7, 0xd7, 0xf7, 0x7f, 0x5e, 0xd4, 0xa4,
-  0x88, 0x22, 0x49, 0x24, 0x92, 0xa5, 0x54, 0x95, 0x55, 0x5a, 0xaa, 0xaa,
-  0xd5, 0xb2, 0x9a, 0xaa, 0xad, 0x79, 0x5a, 0xad, 0x56, 0xee, 0xb6, 0xdb,
-  0x6d, 0x55, 0xbd, 0xbe, 0xfb, 0xdd, 0xff, 0x26, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x2a, 0xaa, 0xd5, 0xad,
-  0x57, 0xfb, 0xff, 0x7f, 0xf7, 0xff, 0xef, 0xfb, 0xfb, 0xee, 0xff, 0xfe,
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xdf, 0xfb, 0xfe, 0x21, 0x00, 0x00, 0x95,
-  0x20, 0xbd, 0xfb, 0x7f, 0xdb, 0xee, 0xd5, 0x24, 0xa2, 0x92, 0x4a, 0x92,
-  0x49, 0x24, 0x92, 0x52, 0xaa, 0xaa, 0xaa, 0xad, 0x6d, 0x5a, 0xed, 0x6d,
-  0xb5, 0x4f, 0xad, 0x6a, 0xdb, 0x6a, 0xdb, 0x5b, 0x6d, 0x55, 0xad, 0xd7,
-  0xae, 0xee, 0xbf, 0xea, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x81, 0x28, 0x92, 0xaa, 0xb5, 0x55, 0x54, 0xbf, 0xff, 0xdb,
-  0xff, 0xde, 0xfd, 0xff, 0xff, 0xff, 0xf6, 0xff, 0x7b, 0xff, 0xdb, 0x6d,
-  0xff, 0xfb, 0xbd, 0xdf, 0x08, 0x00, 0x05, 0x42, 0x8a, 0xaf, 0x7f, 0xed,
-  0x77, 0xf5, 0x22, 0x4a, 0x14, 0xa0, 0x90, 0x44, 0xa4, 0x92, 0x4a, 0x89,
-  0x55, 0x55, 0x52, 0xaa, 0xab, 0x6d, 0x2b, 0xb5, 0x56, 0xf2, 0xdb, 0xbe,
-  0xaa, 0xb6, 0xb6, 0xd5, 0xb7, 0x5d, 0x6b, 0x7a, 0xfb, 0xbf, 0xed, 0xa0,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x45,
-  0x2a, 0xaa, 0xaa, 0xaa, 0xab, 0x5f, 0xbf, 0xff, 0xfb, 0xff, 0xff, 0xfe,
-  0xde, 0xff, 0xff, 0xdf, 0xff, 0x6d, 0xff, 0xff, 0xb6, 0xff, 0xff, 0xf7,
-  0x00, 0x00, 0x04, 0xa8, 0xa9, 0x22, 0xab, 0x7f, 0xbe, 0x94, 0xa9, 0x22,
-  0x92, 0x14, 0x4a, 0x22, 0x14, 0xa9, 0x28, 0xa4, 0x55, 0xaa, 0xaa, 0xaa,
-  0xb5, 0x55, 0x55, 0x56, 0xdb, 0x5e, 0xed, 0xab, 0xef, 0xda, 0xd5, 0x7d,
-  0xda, 0xab, 0x6d, 0xaf, 0x5d, 0xed, 0xfe, 0xa0, 0x02, 0x04, 0x20, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x55, 0x29, 0x24, 0xb5, 0x55, 0x56,
-  0xaa, 0xa1, 0xfb, 0xfd, 0xbf, 0xf7, 0xdf, 0x6f, 0xff, 0xf7, 0x7f, 0xef,
-  0xdf, 0xff, 0xff, 0xff, 0xff, 0xdd, 0xde, 0xff, 0x00, 0x20, 0x09, 0x25,
-  0x04, 0x95, 0x2d, 0xf6, 0xd1, 0x45, 0x12, 0x48, 0xa4, 0x82, 0x90, 0x88,
-  0xa5, 0x14, 0x8a, 0x49, 0x2a, 0x55, 0x52, 0xd5, 0x55, 0xab, 0xda, 0xdb,
-  0x6d, 0x6b, 0x5b, 0x7e, 0xba, 0xae, 0xbf, 0x56, 0xb7, 0x55, 0xbb, 0x75,
-  0xee, 0xbf, 0x6e, 0x00, 0x00, 0x00, 0x02, 0x00, 0x21, 0x24, 0x49, 0x55,
-  0x42, 0x55, 0x12, 0x44, 0x95, 0x55, 0xaa, 0xaa, 0xaa, 0xad, 0x5f, 0xff,
-  0xfd, 0xff, 0xff, 0xff, 0xf7, 0xbf, 0xef, 0xff, 0xfb, 0xfe, 0xdb, 0x6e,
-  0xff, 0xff, 0xff, 0xf6, 0x00, 0x02, 0x01, 0x28, 0xa4, 0x90, 0xa2, 0xbf,
-  0x55, 0x24, 0x92, 0x4a, 0x24, 0x28, 0x84, 0x45, 0x24, 0xa2, 0xa2, 0x49,
-  0x2b, 0x55, 0x55, 0x55, 0x55, 0x55, 0x6e, 0xd5, 0x57, 0xbd, 0xfb, 0xab,
-  0xee, 0xeb, 0xa5, 0xdb, 0xb5, 0xd6, 0xdb, 0x5d, 0xb7, 0xf7, 0x7f, 0x00,
-  0x00, 0x80, 0x00, 0x95, 0x08, 0x22, 0x08, 0x00, 0x52, 0x49, 0x52, 0x52,
-  0xaa, 0xaa, 0xaa, 0xd5, 0x55, 0x55, 0x56, 0xdf, 0xff, 0x7d, 0xf7, 0xfd,
-  0xff, 0xff, 0xfd, 0xf6, 0xff, 0x6f, 0xff, 0xff, 0xb6, 0xef, 0xdb, 0xbf,
-  0xd5, 0x54, 0xaa, 0x85, 0x29, 0x0a, 0x9a, 0x54, 0xa8, 0xa9, 0x49, 0x24,
-  0x88, 0x84, 0x21, 0x10, 0x92, 0x49, 0x09, 0x00, 0x8a, 0xa9, 0x25, 0x55,
-  0x55, 0x55, 0x55, 0x6f, 0xed, 0x6b, 0x5d, 0xf6, 0xb7, 0xbe, 0xfa, 0xb5,
-  0x6d, 0x55, 0x6d, 0xab, 0x5b, 0x5f, 0xea, 0x00, 0x00, 0x22, 0x48, 0x20,
-  0xa5, 0x49, 0x45, 0xb5, 0x29, 0x24, 0x95, 0x24, 0x49, 0x55, 0x6a, 0xaa,
-  0xaa, 0xaa, 0xab, 0xff, 0x7f, 0xff, 0xff, 0xff, 0xbf, 0xf7, 0xff, 0xff,
-  0xdf, 0xff, 0xff, 0xf7, 0xff, 0xfb, 0x7f, 0xfe, 0xaa, 0xa5, 0x49, 0x74,
-  0x84, 0x42, 0x42, 0xaa, 0x8a, 0xa4, 0x48, 0x92, 0x42, 0x52, 0x88, 0x15,
-  0x49, 0x14, 0x48, 0x54, 0x05, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x69,
-  0x6d, 0xdb, 0x6e, 0xbb, 0xba, 0xeb, 0x5f, 0xad, 0xf6, 0xb5, 0x55, 0x5a,
-  0xdd, 0xdb, 0x7c, 0x02, 0x52, 0x12, 0x05, 0x0a, 0x22, 0x24, 0xa4, 0x84,
-  0x89, 0x54, 0x90, 0x95, 0x2a, 0xaa, 0xad, 0x55, 0x55, 0x55, 0x54, 0xb7,
-  0xdf, 0xdf, 0x7e, 0xdf, 0xfb, 0x7e, 0xef, 0x7f, 0xff, 0xfd, 0xdb, 0x7f,
-  0xff, 0x7f, 0xfe, 0xf7, 0xaa, 0xa9, 0x2a, 0x8a, 0x50, 0x10, 0xaa, 0x44,
-  0x51, 0x12, 0x12, 0x25, 0x10, 0x84, 0x22, 0x84, 0x24, 0xa2, 0x85, 0x00,
-  0x92, 0xaa, 0xa5, 0x2a, 0xa9, 0x5b, 0x7b, 0x5e, 0xb6, 0xb6, 0xdb, 0x6e,
-  0xef, 0xbe, 0xea, 0xea, 0xad, 0x4a, 0xad, 0xb7, 0x6e, 0xff, 0xc0, 0x90,
-  0x00, 0x80, 0xa1, 0x51, 0x14, 0x92, 0x52, 0x52, 0x54, 0x92, 0x4d, 0x4a,
-  0xaa, 0xab, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5f, 0xfb, 0xff, 0xef, 0xff,
-  0xff, 0xff, 0xff, 0xee, 0xf6, 0xdf, 0xff, 0xfb, 0x6f, 0xff, 0xdb, 0xbf,
-  0xb5, 0x40, 0x00, 0x41, 0x14, 0x01, 0x2a, 0x52, 0x94, 0x90, 0x8a, 0x88,
-  0x84, 0x50, 0x88, 0x52, 0x92, 0x48, 0xa0, 0x24, 0x01, 0xb5, 0x52, 0x95,
-  0x55, 0x4a, 0xad, 0xeb, 0xb5, 0xde, 0xdb, 0x77, 0x75, 0xb7, 0x7f, 0xb6,
-  0xf5, 0x55, 0x55, 0x5b, 0x6b, 0xad, 0x78, 0x02, 0x94, 0x2a, 0x29, 0x09,
-  0x52, 0xa9, 0x09, 0x55, 0x42, 0x4a, 0xa4, 0xa1, 0x24, 0xb5, 0x55, 0x55,
-  0x55, 0x55, 0x55, 0x42, 0xff, 0xf7, 0xff, 0xfb, 0xbf, 0xf7, 0xfb, 0xff,
-  0xff, 0xfe, 0xff, 0xbf, 0xfb, 0xed, 0xff, 0xfb, 0xaa, 0x80, 0x3f, 0xbd,
-  0xd5, 0x2c, 0x92, 0x94, 0xa5, 0x05, 0x21, 0x24, 0x29, 0x0a, 0x22, 0x94,
-  0xa9, 0x12, 0x14, 0x80, 0x85, 0x55, 0x55, 0x55, 0x4a, 0xb5, 0x5b, 0x5a,
-  0xde, 0xeb, 0x77, 0xbd, 0xdf, 0xef, 0xd5, 0x6b, 0x5d, 0x54, 0xaa, 0xaa,
-  0xde, 0xf7, 0x80, 0x10, 0x20, 0x80, 0x84, 0xa4, 0x89, 0x14, 0xa4, 0x22,
-  0x35, 0x51, 0x2a, 0x55, 0x55, 0x55, 0x55, 0x55, 0x55, 0x5a, 0xaa, 0xba,
-  0xbe, 0xff, 0xfb, 0xdf, 0xff, 0x7e, 0xff, 0xf7, 0xbf, 0xef, 0xdb, 0xff,
-  0xff, 0x7f, 0xff, 0xdf, 0xb5, 0x00, 0x2d, 0xee, 0xfe, 0xaa, 0xaa, 0x92,
-  0x10, 0xa0, 0x94, 0xa1, 0x04, 0x40, 0x88, 0x42, 0x09, 0x41, 0x44, 0x08,
-  0x01, 0x55, 0x55, 0x55, 0x2a, 0x96, 0xdd, 0xef, 0x6b, 0x6d, 0xbd, 0xee,
-  0xed, 0x7a, 0xff, 0xbb, 0x6d, 0x55, 0x55, 0xb7, 0x77, 0xbd, 0x81, 0x05,
-  0x04, 0x54, 0x52, 0x12, 0x49, 0x45, 0x2a, 0x92, 0x89, 0x15, 0x49, 0x49,
-  0x2a, 0xaa, 0xd5, 0x55, 0x55, 0x55, 0x55, 0x4a, 0xaf, 0xff, 0x7f, 0xff,
-  0xf7, 0xff, 0xdf, 0x7f, 0xee, 0xff, 0xff, 0xf6, 0xdf, 0xff, 0xb6, 0xfd,
-  0xad, 0x08, 0x1f, 0x7b, 0xaa, 0x89, 0x48, 0xaa, 0xca, 0x15, 0x29, 0x08,
-  0x52, 0x94, 0x25, 0x29, 0x50, 0x14, 0x10, 0x40, 0x40, 0xaa, 0xa9, 0x2a,
-  0xa5, 0x69, 0x6b, 0x59, 0xb6, 0xdb, 0x6b, 0x5b, 0xbb, 0xdf, 0xaa, 0xd5,
-  0xaa, 0xaa, 0xad, 0x55, 0xad, 0x6f, 0x00, 0x10, 0x41, 0x02, 0x09, 0x49,
-  0x24, 0xa8, 0x92, 0x54, 0x52, 0xa4, 0x94, 0x2a, 0x95, 0x56, 0xaa, 0xaa,
-  0xaa, 0xaa, 0xaa, 0xb5, 0x57, 0xbb, 0xfe, 0xfd, 0xdf, 0xdf, 0xfb, 0xfd,
-  0xff, 0xf6, 0xfd, 0xbf, 0xfb, 0xb6, 0xff, 0xff, 0x00, 0x40, 0x2b, 0xdf,
-  0xa0, 0x01, 0x2a, 0x88, 0x20, 0x81, 0x44, 0x45, 0x10, 0x02, 0x91, 0x4a,
-  0x45, 0x41, 0x40, 0x22, 0x00, 0xb6, 0xaa, 0xa8, 0x92, 0x95, 0xbd, 0xee,
-  0xb6, 0xdb, 0xbd, 0xfd, 0xde, 0xf6, 0xff, 0x6d, 0xb6, 0x95, 0x55, 0xae,
-  0xb7, 0xbb, 0x48, 0x02, 0x28, 0x51, 0x48, 0xa5, 0x52, 0x0a, 0x92, 0x41,
-  0x48, 0x94, 0x92, 0xa9, 0x4a, 0xaa, 0xb5, 0xaa, 0xaa, 0xad, 0xb5, 0x4a,
-  0xa9, 0xff, 0xdf, 0xff, 0xff, 0xfe, 0xff, 0xdf, 0xff, 0x7f, 0xdf, 0xff,
-  0xff, 0xff, 0xff, 0x6f, 0x24, 0x14, 0x5e, 0xf5, 0x40, 0x00, 0x49, 0x55,
-  0x48, 0x54, 0x51, 0x00, 0x8a, 0xa4, 0x24, 0x21, 0x10, 0x2a, 0x14, 0x00,
-  0x20, 0x2b, 0x5a, 0x96, 0xa9, 0x6a, 0xd6, 0xb5, 0xdb, 0x6e, 0xee, 0xaf,
-  0x77, 0xbf, 0xab, 0xb6, 0xd9, 0x52, 0xaa, 0xb5, 0xda, 0xee, 0x00, 0x88,
-  0x05, 0x0a, 0x45, 0x10, 0x89, 0x50, 0xa5, 0x2a, 0x2a, 0x45, 0x4a, 0x4a,
-  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xb5, 0x56, 0xbf, 0xff, 0xbf,
-  0xfb, 0xef, 0xff, 0xff, 0x6f, 0xff, 0xff, 0xdb, 0x7d, 0xff, 0x6f, 0xfb,
-  0x24, 0x82, 0x37, 0xbf, 0x00, 0x00, 0x0a, 0x42, 0x05, 0x2a, 0x08, 0x14,
-  0x40, 0x21, 0x12, 0x94, 0x95, 0x00, 0x84, 0x88, 0x08, 0x2a, 0xd6, 0xd2,
-  0xa4, 0xad, 0x5b, 0xbe, 0xdd, 0xbb, 0x6b, 0xf5, 0xfb, 0xd5, 0xbf, 0xd5,
-  0x6d, 0x55, 0x55, 0x55, 0x6f, 0x76, 0x00, 0x00, 0x20, 0x40, 0x51, 0x4a,
-  0x2a, 0x4a, 0x24, 0x4a, 0xa2, 0x52, 0x29, 0x24, 0xaa, 0xaa, 0xaa, 0xaa,
-  0xaa, 0xad, 0x5a, 0x95, 0x55, 0x57, 0xef, 0xee, 0xfe, 0xff, 0xb6, 0xf7,
-  0xf7, 0xb6, 0xed, 0xff, 0xef, 0xb7, 0xfd, 0xff, 0x01, 0x10, 0x5d, 0xee,
-  0x80, 0x00, 0x01, 0x29, 0x48, 0x82, 0xa2, 0xa2, 0x92, 0x08, 0x44, 0x42,
-  0x20, 0xa8, 0x00, 0x02, 0x00, 0x15, 0x55, 0x55, 0x55, 0x55, 0xee, 0xeb,
-  0x6b, 0x6e, 0xdd, 0x5f, 0x5e, 0xff, 0xd5, 0x75, 0x5b, 0x55, 0x6a, 0xde,
-  0xb5, 0xdd, 0x10, 0x01, 0x02, 0x15, 0x08, 0x92, 0x84, 0x92, 0x92, 0x91,
-  0x15, 0x29, 0x45, 0x52, 0x4a, 0xaa, 0xaa, 0xaa, 0xab, 0x55, 0x56, 0xd5,
-  0x55, 0x5d, 0xff, 0xff, 0xdf, 0xf7, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
-  0xbf, 0xff, 0xdf, 0x7b, 0xa8, 0x8a, 0x5f, 0x76, 0x80, 0x00, 0x00, 0xa4,
-  0x24, 0xa9, 0x10, 0x10, 0x00, 0x41, 0x12, 0x51, 0x14, 0x09, 0x20, 0x81,
-  0x04, 0x15, 0x55, 0x55, 0x29, 0x2a, 0xab, 0x5b, 0x7f, 0x76, 0xf7, 0xfb,
-  0xf7, 0xb6, 0xff, 0xde, 0xaa, 0xaa, 0xab, 0x53, 0xbe, 0xfb, 0xa8, 0x00,
-  0x20, 0x80, 0x4a, 0x48, 0x52, 0x48, 0x88, 0x94, 0x90, 0x85, 0x29, 0x2a,
-  0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0xd5, 0x55, 0x55, 0x55, 0x55, 0xfb, 0xff,
-  0xff, 0xfd, 0xff, 0xbe, 0xfd, 0xff, 0xfe, 0xdb, 0xfd, 0xbd, 0xef, 0xdd,
-  0x04, 0x20, 0x6d, 0xff, 0x01, 0x00, 0x00, 0x29, 0x4a, 0x44, 0x45, 0x24,
-  0x92, 0x14, 0x49, 0x04, 0x02, 0x80, 0x08, 0x20, 0x00, 0x05, 0xb6, 0xda,
-  0xa6, 0xab, 0x76, 0xf7, 0xab, 0xaf, 0x5a, 0xae, 0xbb, 0x7f, 0x55, 0x53,
-  0x54, 0xab, 0x55, 0x6d, 0x6b, 0xaa, 0xd6, 0x00, 0x00, 0x14, 0x80, 0x92,
-  0x88, 0x92, 0x52, 0x49, 0x4a, 0x51, 0x54, 0x92, 0x4a, 0xb5, 0x55, 0x55,
-  0x6a, 0xab, 0x6a, 0xaa, 0xaa, 0xad, 0x7f, 0xef, 0xfd, 0xff, 0xdf, 0xf7,
-  0xdf, 0xb6, 0xdf, 0xff, 0xef, 0xf7, 0xff, 0xff, 0xa2, 0x8a, 0x3e, 0xdb,
-  0xa0, 0x20, 0x00, 0x02, 0x51, 0x25, 0x20, 0x84, 0x00, 0x81, 0x49, 0x22,
-  0x50, 0x24, 0x80, 0x00, 0x40, 0x05, 0x55, 0x6a, 0xa8, 0x95, 0x5b, 0x5a,
-  0xfd, 0xfb, 0x6f, 0xfb, 0xdb, 0xb5, 0xf7, 0xdd, 0x6a, 0xaa, 0xb5, 0x6f,
-  0xbd, 0xf5, 0x5b, 0xa0, 0x00, 0x00, 0x54, 0x04, 0x42, 0x12, 0x49, 0x4a,
-  0x25, 0x54, 0x45, 0x4a, 0xaa, 0x95, 0x55, 0x6a, 0xad, 0x6a, 0xab, 0x55,
-  0x55, 0x55, 0x5e, 0xfd, 0xdf, 0xbf, 0xed, 0xff, 0xff, 0xff, 0xf7, 0xfe,
-  0xff, 0xfe, 0xfb, 0x7f, 0x10, 0x40, 0xaf, 0xbe, 0x80, 0x00, 0x00, 0x29,
-  0x14, 0x90, 0x4a, 0x21, 0x22, 0x14, 0x20, 0x00, 0x04, 0x80, 0x01, 0x00,
-  0x00, 0x01, 0x55, 0x56, 0xab, 0x55, 0xad, 0x77, 0x56, 0xad, 0xda, 0xae,
-  0xf7, 0xee, 0xba, 0xaa, 0xaa, 0xb5, 0x5f, 0xba, 0xd7, 0x4a, 0x55, 0xd8,
-  0x00, 0x02, 0x01, 0x51, 0x28, 0xa4, 0x94, 0x21, 0x48, 0x12, 0x92, 0x55,
-  0x25, 0x55, 0x56, 0xad, 0x55, 0x55, 0xaa, 0xd6, 0xaa, 0xab, 0x57, 0xff,
-  0xff, 0xf7, 0xff, 0xfd, 0xef, 0xff, 0xfe, 0xdb, 0xfb, 0x7f, 0xdf, 0xdb,
-  0x4a, 0x54, 0x6d, 0xf7, 0xc0, 0x00, 0x00, 0x09, 0x4a, 0x4a, 0x21, 0x10,
-  0x10, 0x82, 0x8a, 0xa9, 0x20, 0x24, 0x90, 0x10, 0x00, 0x00, 0xad, 0x5a,
-  0xaa, 0xaa, 0xb7, 0x55, 0xd6, 0xef, 0x77, 0xbb, 0xbd, 0x7b, 0xaf, 0xd5,
-  0x52, 0x55, 0xaa, 0xee, 0xfb, 0xd1, 0x25, 0x6f, 0x91, 0x00, 0x48, 0x08,
-  0x04, 0x00, 0x85, 0x29, 0x25, 0x4a, 0x49, 0x49, 0x55, 0x55, 0x52, 0xaa,
-  0xd5, 0x5a, 0xda, 0xaa, 0xaa, 0xaa, 0xd5, 0xff, 0xfb, 0xfd, 0xfe, 0xdf,
-  0xfb, 0x6d, 0xbf, 0xff, 0xbf, 0xf7, 0xff, 0xfe, 0x24, 0x82, 0xbf, 0x5d,
-  0x00, 0x08, 0x00, 0x02, 0x52, 0x90, 0x88, 0x44, 0x80, 0x28, 0x40, 0x00,
-  0x44, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0xaa, 0xaa, 0xab, 0xbb,
-  0x6d, 0xba, 0xdd, 0xde, 0xdf, 0xd6, 0xb4, 0xaa, 0xaa, 0xad, 0x77, 0x5b,
-  0xae, 0x82, 0x8a, 0xb5, 0x48, 0x20, 0x00, 0x02, 0x91, 0x54, 0x51, 0x12,
-  0x49, 0x21, 0x24, 0xa5, 0x52, 0xaa, 0xad, 0x55, 0x5b, 0x6a, 0xaa, 0xb5,
-  0x55, 0x55, 0x5a, 0xdd, 0xff, 0xff, 0xef, 0xfe, 0xff, 0xff, 0xf7, 0xff,
-  0xff, 0xbe, 0xed, 0xef, 0x22, 0x28, 0x0b, 0xff, 0xa0, 0x00, 0x00, 0x01,
-  0x24, 0x44, 0x42, 0x00, 0x04, 0x8a, 0x2a, 0x12, 0x00, 0x92, 0x00, 0x04,
-  0x10, 0x00, 0x2a, 0xaa, 0xda, 0xaa, 0xac, 0xda, 0xad, 0xae, 0xda, 0xeb,
-  0xd5, 0x7a, 0xd5, 0xaa, 0xaa, 0xb5, 0xdb, 0xdd, 0x7f, 0x40, 0x8a, 0xaa,
-  0xed, 0x14, 0x00, 0x40, 0x00, 0x02, 0x08, 0x90, 0x44, 0x94, 0x92, 0x29,
-  0x2a, 0xa4, 0xa5, 0x56, 0xaa, 0xad, 0x56, 0xd5, 0xaa, 0xb5, 0x55, 0x7f,
-  0xbd, 0xbe, 0xff, 0xef, 0xdf, 0xff, 0xff, 0x6d, 0xdb, 0xff, 0xfe, 0xf7,
-  0x89, 0x45, 0x69, 0x56, 0x00, 0x00, 0x00, 0x00, 0x52, 0x90, 0x14, 0x92,
-  0x41, 0x21, 0x00, 0x80, 0x4a, 0x00, 0x40, 0x00, 0x00, 0x00, 0xab, 0x5a,
-  0xaa, 0xb5, 0x55, 0x55, 0x76, 0xdb, 0xb7, 0x7d, 0x7f, 0xd7, 0x6a, 0xaa,
-  0xaa, 0xde, 0xbd, 0x77, 0xab, 0x44, 0x05, 0xbd, 0xb6, 0xa2, 0x48, 0x00,
-  0x08, 0x90, 0xa2, 0x0a, 0x29, 0x25, 0x29, 0x55, 0x54, 0x55, 0x54, 0xa9,
-  0x55, 0x6a, 0xda, 0xaa, 0xb5, 0x55, 0x56, 0xbf, 0xff, 0xff, 0xfb, 0xff,
-  0xfb, 0x6d, 0xbb, 0xff, 0xff, 0xde, 0xff, 0xfe, 0x48, 0x24, 0x7d, 0x57,
-  0x80, 0x00, 0x00, 0x00, 0x14, 0x8a, 0x40, 0x00, 0x28, 0x08, 0x90, 0x04,
-  0x00, 0x90, 0x04, 0x00, 0x00, 0x04, 0x95, 0x55, 0x55, 0x56, 0xaa, 0xad,
-  0xab, 0x5a, 0xdd, 0xaf, 0xaa, 0xb5, 0x54, 0xaa, 0xae, 0xeb, 0xd7, 0xda,
-  0xff, 0x50, 0x05, 0x55, 0x5b, 0xbd, 0x55, 0x00, 0x00, 0x04, 0x01, 0x41,
-  0x00, 0x10, 0x84, 0x89, 0x4a, 0x92, 0xaa, 0xad, 0x56, 0xaa, 0xab, 0x55,
-  0x55, 0x55, 0x55, 0x4b, 0xdf, 0xf7, 0xbf, 0x76, 0xff, 0xff, 0xff, 0xfe,
-  0xfe, 0xf7, 0xb7, 0x7f, 0xa2, 0x82, 0xdf, 0xd4, 0x00, 0x02, 0x00, 0x00,
-  0x01, 0x21, 0x12, 0x48, 0x02, 0xa2, 0x04, 0x40, 0x40, 0x00, 0x00, 0x00,
-  0x00, 0x12, 0x4a, 0xab, 0x6a, 0xaa, 0xaa, 0xb5, 0x55, 0x57, 0x6a, 0xaa,
-  0xdb, 0x55, 0x4b, 0x56, 0xf7, 0x5d, 0x7a, 0xb7, 0x5b, 0xa0, 0x0a, 0x95,
-  0x55, 0xd5, 0x55, 0x58, 0x80, 0x00, 0x20, 0x04, 0x4a, 0x8a, 0x54, 0x54,
-  0xa5, 0x54, 0x95, 0x25, 0x55, 0x6d, 0xad, 0x6a, 0xab, 0x55, 0x6a, 0xb7,
-  0xfd, 0xdf, 0xff, 0xff, 0xbf, 0xff, 0xdd, 0xb7, 0xdb, 0xff, 0xff, 0xdb,
-  0x28, 0x2a, 0xf6, 0xfe, 0x88, 0x00, 0x00, 0x00, 0x00, 0x09, 0x00, 0x01,
-  0x10, 0x20, 0x40, 0x20, 0x04, 0x04, 0x00, 0x00, 0x05, 0x4a, 0x4a, 0xaa,
-  0xad, 0xaa, 0xab, 0x55, 0x6a, 0xb5, 0x6d, 0xb6, 0xad, 0x6a, 0xb5, 0x76,
-  0xb5, 0xef, 0xaf, 0xb5, 0xde, 0xa0, 0x0a, 0xf7, 0x6d, 0x6d, 0xaa, 0xad,
-  0x20, 0x20, 0x04, 0x20, 0x40, 0xa0, 0x42, 0x92, 0x54, 0x95, 0x52, 0xaa,
-  0xaa, 0xaa, 0xd5, 0xad, 0x55, 0xaa, 0xaa, 0xa8, 0xff, 0xfd, 0xed, 0xff,
-  0xdb, 0x6d, 0xff, 0xff, 0xff, 0xbd, 0xbb, 0xff, 0x97, 0x5f, 0xbf, 0xb6,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x08, 0x45, 0x09, 0x02, 0x02,
-  0x10, 0x00, 0x00, 0x04, 0xa9, 0x22, 0x25, 0x6a, 0xb5, 0x5b, 0x6a, 0xad,
-  0x5b, 0x55, 0xb6, 0xda, 0xaa, 0xdb, 0x57, 0xbb, 0x6f, 0x75, 0xf5, 0x6e,
-  0xbf, 0x40, 0x05, 0x2a, 0xab, 0xba, 0xda, 0xd5, 0xaf, 0x04, 0x00, 0x82,
-  0x12, 0x0a, 0x14, 0x4a, 0x92, 0x52, 0x49, 0x52, 0xaa, 0xaa, 0xad, 0x56,
-  0xaa, 0xad, 0x6a, 0xab, 0x6f, 0xff, 0xff, 0x6d, 0xff, 0xff, 0xde, 0xfb,
-  0x7f, 0xf7, 0xfe, 0xfb, 0x0b, 0x4d, 0xfb, 0xff, 0x40, 0x00, 0x40, 0x00,
-  0x20, 0x00, 0x20, 0x84, 0x20, 0x80, 0x20, 0x00, 0x00, 0x00, 0x00, 0xa2,
-  0x08, 0xa9, 0x05, 0x55, 0x56, 0xd5, 0x5a, 0xd5, 0x55, 0xaa, 0xb5, 0x55,
-  0xb6, 0xad, 0xba, 0xdb, 0xbb, 0x5e, 0xbb, 0x7b, 0xfb, 0x30, 0x17, 0xb6,
-  0xd4, 0xaf, 0x56, 0xaa, 0xb5, 0xea, 0x90, 0x00, 0x00, 0x02, 0x82, 0x44,
-  0x55, 0x49, 0x55, 0x2a, 0xaa, 0xb5, 0x55, 0x6b, 0x6a, 0xaa, 0xad, 0x55,
-  0x3b, 0x6f, 0x6f, 0xff, 0xf7, 0x76, 0xf7, 0xdf, 0xdb, 0x7f, 0xef, 0xdd,
-  0xb5, 0x76, 0x96, 0xaa, 0xa9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
-  0x08, 0x10, 0x00, 0x00, 0x00, 0x00, 0x8a, 0x08, 0x82, 0x12, 0x82, 0xaa,
-  0xaa, 0xaa, 0xab, 0x5b, 0x56, 0xdb, 0x5b, 0xee, 0xdb, 0xdb, 0x6d, 0xbd,
-  0xd6, 0xeb, 0xdd, 0xd6, 0xbc, 0x80, 0x09, 0xab, 0x6f, 0xda, 0xda, 0xda,
-  0xca, 0xb6, 0xaa, 0x91, 0x11, 0x20, 0x21, 0x29, 0x24, 0xaa, 0x29, 0x49,
-  0x55, 0x55, 0xaa, 0xaa, 0xad, 0x55, 0x55, 0x55, 0xbf, 0xfd, 0xff, 0x7d,
-  0xbf, 0xdf, 0xfe, 0xf7, 0x7f, 0xda, 0xbd, 0xff, 0xdb, 0x55, 0xb5, 0x5f,
-  0x24, 0x40, 0x00, 0x00, 0x00, 0x00, 0x04, 0x20, 0x42, 0x08, 0x00, 0x00,
-  0x01, 0x00, 0x29, 0x44, 0x15, 0x48, 0x45, 0x5a, 0xaa, 0xb6, 0xd5, 0x55,
-  0x6b, 0x6d, 0xed, 0x6b, 0x5a, 0xdb, 0x6d, 0xee, 0xf7, 0x7d, 0x6e, 0xbb,
-  0xea, 0x50, 0x16, 0xdd, 0x6a, 0xdb, 0x56, 0x56, 0xbb, 0x5a, 0xda, 0xda,
-  0x88, 0x09, 0x09, 0x02, 0x95, 0x25, 0x25, 0x54, 0xaa, 0xaa, 0xb5, 0x5a,
-  0xd6, 0xdb, 0x55, 0x55, 0x47, 0xff, 0xf7, 0xdf, 0xfb, 0xff, 0xdf, 0xff,
-  0xed, 0xff, 0xef, 0x6d, 0x55, 0xb6, 0xd6, 0xda, 0x92, 0xa8, 0x00, 0x00,
-  0x80, 0x04, 0x00, 0x09, 0x10, 0x81, 0x00, 0x02, 0x00, 0x2a, 0x92, 0x10,
-  0x85, 0x25, 0x02, 0xd5, 0x56, 0xd5, 0x6a, 0xd6, 0xb5, 0xb5, 0x36, 0xdd,
-  0xd6, 0xee, 0xfb, 0x5b, 0x5d, 0xae, 0xd7, 0xd7, 0xa9, 0x48, 0x0b, 0x53,
-  0x5f, 0x6e, 0xdb, 0xab, 0x55, 0x56, 0xad, 0x56, 0xea, 0xa0, 0x00, 0x54,
-  0xa2, 0x52, 0xaa, 0x4a, 0x55, 0x55, 0x56, 0xab, 0x55, 0x55, 0x6b, 0x6a,
-  0xb5, 0xff, 0xff, 0xff, 0xff, 0xf6, 0xfb, 0x7b, 0xff, 0xff, 0xff, 0xff,
-  0x6d, 0x5a, 0xaa, 0xaf, 0x92, 0x0a, 0x08, 0x00, 0x00, 0x01, 0x20, 0x88,
-  0x00, 0x00, 0x22, 0x20, 0x00, 0x84, 0x90, 0x40, 0x94, 0x94, 0x02, 0xab,
-  0x6a, 0xab, 0x5b, 0x56, 0xda, 0xd7, 0xb7, 0x6d, 0x76, 0xb7, 0x5d, 0xed,
-  0xed, 0xf7, 0x75, 0x7d, 0xc9, 0x20, 0x2a, 0xdd, 0xa5, 0x76, 0xd5, 0x75,
-  0xad, 0xd6, 0xf6, 0xdb, 0x5b, 0x5b, 0x55, 0x04, 0x29, 0x09, 0x29, 0x25,
-  0x55, 0x55, 0x55, 0xaa, 0xb6, 0xaa, 0xb5, 0x5a, 0x94, 0xdf, 0x7f, 0xee,
-  0xdf, 0x7f, 0xff, 0xbf, 0x7f, 0xb7, 0x7b, 0x7f, 0xaa, 0xaa, 0xd6, 0xbd,
-  0x49, 0x50, 0x00, 0x01, 0x00, 0x00, 0x04, 0x02, 0x2a, 0xb5, 0x94, 0x89,
-  0x55, 0x29, 0x0a, 0x04, 0x22, 0xa2, 0x01, 0x6a, 0xaa, 0xb5, 0x6d, 0x6b,
-  0x56, 0xba, 0xda, 0xdb, 0xbb, 0xed, 0xd7, 0x7b, 0x7f, 0x5b, 0xbe, 0xd6,
-  0x24, 0x90, 0x1b, 0x56, 0xdb, 0xad, 0xb5, 0xae, 0xb5, 0x55, 0x2b, 0x6d,
-  0xee, 0xd5, 0xd4, 0x51, 0x04, 0xaa, 0x95, 0x55, 0x25, 0x55, 0x55, 0x6d,
-  0x59, 0x55, 0x55, 0x55, 0x6a, 0xfb, 0xf7, 0xff, 0xfb, 0xff, 0x7f, 0xff,
-  0xed, 0xff, 0xff, 0xed, 0xaa, 0xaa, 0xb5, 0xaf, 0x49, 0x0a, 0x80, 0x00,
-  0x00, 0x80, 0x00, 0x92, 0x88, 0x84, 0x52, 0x49, 0x10, 0x89, 0x40, 0xa0,
-  0x55, 0x28, 0x01, 0x5a, 0xaa, 0xad, 0x55, 0xb5, 0x7d, 0xdb, 0x6f, 0x6d,
-  0xae, 0xb6, 0xfb, 0x5f, 0x55, 0xed, 0xab, 0x7e, 0xa4, 0xa8, 0xad, 0x6a,
-  0xad, 0xb5, 0xac, 0xaa, 0xdb, 0x6d, 0xed, 0xb6, 0x6b, 0x7e, 0xef, 0x54,
-  0xa0, 0x20, 0xa4, 0x90, 0x95, 0x55, 0x55, 0x55, 0xab, 0x55, 0x55, 0x55,
-  0x55, 0x1f, 0xfe, 0xff, 0xff, 0xf7, 0xf7, 0xdb, 0xff, 0xfb, 0xef, 0xff,
-  0xaa, 0xdb, 0x55, 0x5d, 0x92, 0x50, 0x00, 0x00, 0x00, 0x00, 0x40, 0x49,
-  0x52, 0x55, 0x15, 0x54, 0xa5, 0x24, 0x08, 0x02, 0x92, 0x90, 0x01, 0x55,
-  0x56, 0xb5, 0x5a, 0xaf, 0xab, 0x6d, 0xda, 0xdb, 0x75, 0xed, 0xae, 0xeb,
-  0xfe, 0xb6, 0xee, 0xf4, 0x92, 0x49, 0x6a, 0xb6, 0xd5, 0x6e, 0xd7, 0x6d,
-  0x55, 0x55, 0x36, 0xbb, 0xb6, 0xaa, 0xb5, 0xf7, 0x15, 0x0a, 0x52, 0x4d,
-  0x49, 0x2a, 0x55, 0x55, 0x5a, 0xdb, 0x6d, 0xaa, 0xaa, 0xd7, 0xff, 0xef,
-  0x7f, 0x7f, 0xbf, 0xff, 0x7e, 0xff, 0x7d, 0xff, 0x55, 0x6d, 0xb7, 0xef,
-  0x91, 0x55, 0x00, 0x04, 0x00, 0x00, 0x0a, 0xaa, 0x4a, 0x41, 0x42, 0x45,
-  0x28, 0x90, 0x80, 0x12, 0x52, 0x48, 0x00, 0xab, 0x6a, 0xab, 0x6b, 0xb4,
-  0xda, 0xad, 0x77, 0xdb, 0xbe, 0xbe, 0xf7, 0x7e, 0xab, 0xbb, 0x6b, 0xb4,
-  0x95, 0x21, 0x6f, 0x55, 0x77, 0xb5, 0x72, 0xad, 0xdb, 0x5a, 0xd5, 0x94,
-  0xad, 0xbb, 0xdd, 0x35, 0xd4, 0xa9, 0x09, 0x21, 0x2a, 0x92, 0xaa, 0xb6,
-  0xd5, 0x55, 0x55, 0x6a, 0xaa, 0x51, 0xbf, 0xff, 0xf7, 0xff, 0xfd, 0xff,
-  0xef, 0xdf, 0xfe, 0xdb, 0xad, 0x55, 0x7d, 0xfb, 0x4a, 0x08, 0x00, 0x00,
-  0x00, 0x08, 0x29, 0x08, 0x91, 0x2a, 0x55, 0x28, 0x92, 0x44, 0x00, 0x01,
-  0x29, 0x22, 0x00, 0xb5, 0x55, 0x55, 0x5a, 0xd7, 0x6f, 0xf7, 0xad, 0x76,
-  0xd7, 0xd7, 0xbd, 0xd5, 0xfd, 0x6d, 0xbd, 0xe9, 0x24, 0xae, 0xa9, 0xba,
-  0xad, 0x5b, 0x55, 0x55, 0x55, 0xed, 0xba, 0xf7, 0xda, 0xd5, 0x6f, 0xdf,
-  0x7d, 0xa2, 0x52, 0x4a, 0x49, 0x4a, 0xaa, 0xaa, 0xaa, 0xd5, 0x55, 0x55,
-  0x55, 0x2d, 0xf7, 0xfb, 0xff, 0xb7, 0xff, 0xbb, 0xff, 0xfb, 0xdf, 0xff,
-  0xb7, 0x7e, 0xdf, 0xbf, 0xa1, 0x4a, 0x80, 0x00, 0x40, 0x01, 0x54, 0xca,
-  0x49, 0x11, 0x11, 0x4a, 0x4a, 0x20, 0x00, 0x0a, 0x8a, 0x90, 0x00, 0x2d,
-  0xab, 0x5a, 0xaa, 0xb5, 0x6a, 0xba, 0xf7, 0xde, 0xf5, 0x7d, 0xd7, 0x7f,
-  0x57, 0x6e, 0xd7, 0x64, 0x92, 0x93, 0xbd, 0x4e, 0xd5, 0xed, 0x5d, 0xd5,
-  0x5a, 0x55, 0x4d, 0x5a, 0x77, 0x6e, 0xb4, 0xd5, 0xad, 0xb5, 0x09, 0x21,
-  0x24, 0xa9, 0x2a, 0xaa, 0xad, 0x55, 0x5a, 0xaa, 0xaa, 0xa5, 0x7e, 0xff,
-  0xff, 0xfd, 0xef, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xfc, 0xee, 0xb6, 0xed,
-  0xaa, 0xa0, 0x00, 0x00, 0x01, 0x0a, 0x45, 0x11, 0x24, 0x8a, 0xaa, 0x52,
-  0x91, 0x08, 0x00, 0x22, 0x52, 0x54, 0x00, 0x2a, 0xb5, 0x6b, 0x5d, 0xaf,
-  0x5d, 0xd7, 0x5a, 0xb7, 0x5f, 0xd7, 0x7d, 0xaa, 0xfb, 0xb5, 0xbd, 0x92,
-  0x48, 0xbc, 0xcb, 0x55, 0xb6, 0xbb, 0x52, 0xb6, 0xed, 0xb6, 0xb6, 0xa5,
-  0x99, 0xab, 0x6f, 0x6e, 0xf6, 0xed, 0x50, 0x15, 0x49, 0x24, 0xa5, 0x55,
-  0xaa, 0xad, 0xab, 0x6a, 0xaa, 0x94, 0xbf, 0xff, 0x7f, 0xff, 0xff, 0xfe,
-  0xef, 0xfe, 0xfb, 0xbb, 0x6f, 0x77, 0xbf, 0xef, 0xd2, 0x2a, 0xaa, 0xaa,
-  0x54, 0xa9, 0x50, 0x89, 0x12, 0xa8, 0x42, 0x4a, 0x44, 0xa2, 0x00, 0x09,
-  0x49, 0x40, 0x00, 0x0a, 0xd5, 0x55, 0x66, 0xd5, 0xd6, 0xbb, 0x6f, 0xf5,
-  0xf5, 0x7b, 0xad, 0xef, 0x5a, 0xdf, 0xae, 0x92, 0x55, 0x57, 0x55, 0xfa,
-  0xb6, 0xad, 0xdd, 0x55, 0x2a, 0xb5, 0xd5, 0xbe, 0xee, 0xb5, 0x53, 0xba,
-  0xb6, 0xb7, 0xd5, 0x40, 0x49, 0x25, 0x14, 0xaa, 0xab, 0x55, 0x55, 0x55,
-  0x55, 0x52, 0xaf, 0xff, 0xf7, 0xfe, 0xfb, 0xdf, 0xff, 0xef, 0xff, 0xff,
-  0xfa, 0xfe, 0xdb, 0x7a, 0x89, 0x48, 0x49, 0x22, 0x92, 0x94, 0x2a, 0x52,
-  0x48, 0x8a, 0xaa, 0xa1, 0x52, 0x10, 0x00, 0x2a, 0x54, 0x28, 0x00, 0x02,
-  0xb6, 0xab, 0x5a, 0xaa, 0xed, 0xd5, 0xb5, 0x5e, 0xaf, 0xad, 0xf6, 0xba,
-  0xdf, 0x6a, 0xf9, 0x01, 0x0a, 0xaa, 0xea, 0x96, 0xad, 0xaa, 0x56, 0xdb,
-  0x55, 0xad, 0x5a, 0xd3, 0x55, 0xad, 0xdd, 0x6f, 0x5b, 0x6d, 0x7e, 0x92,
-  0x12, 0x10, 0x02, 0xaa, 0xd5, 0x6a, 0xaa, 0xaa, 0xaa, 0x94, 0x97, 0xff,
-  0xff, 0xff, 0xff, 0xff, 0xfb, 0x7f, 0xbf, 0xff, 0xbd, 0x77, 0xdb, 0xda,
-  0x2a, 0x4a, 0x49, 0x28, 0x95, 0x52, 0x80, 0x89, 0x24, 0xa2, 0x29, 0x15,
-  0x2a, 0x94, 0x00, 0x09, 0x45, 0x4a, 0x00, 0x00, 0xaa, 0xaa, 0xaa, 0xef,
-  0x6d, 0x6e, 0xdb, 0x6b, 0xea, 0xee, 0xb7, 0xee, 0xd5, 0xba, 0xa8, 0xa0,
-  0xab, 0x6b, 0x5a, 0xab, 0xb5, 0xbb, 0x52, 0xaa, 0xfe, 0xea, 0xad, 0x59,
-  0x55, 0x6d, 0x6b, 0x51, 0xdb, 0x75, 0xab, 0xf8, 0x80, 0x80, 0x11, 0x2a,
-  0x55, 0x55, 0x55, 0x5a, 0xaa, 0xaa, 0x55, 0xbf, 0xfe, 0xff, 0xff, 0xff,
-  0x7f, 0xff, 0xfe, 0xed, 0xea, 0xdd, 0x5e, 0x09, 0x40, 0x11, 0x02, 0x44,
-  0x48, 0x09, 0x2a, 0x22, 0x4a, 0x2a, 0x8a, 0xa8, 0x91, 0x21, 0x00, 0x54,
-  0x52, 0x91, 0x00, 0x00, 0x15, 0xb5, 0xad, 0x55, 0x5b, 0x5b, 0x6e, 0xdd,
-  0x7d, 0xbb, 0xda, 0xb5, 0xb6, 0xd7, 0x42, 0x0a, 0xad, 0xb5, 0x6e, 0xd5,
-  0x6a, 0xd6, 0xdd, 0x55, 0x05, 0x36, 0xda, 0xd6, 0xab, 0x56, 0xb6, 0xee,
-  0xb6, 0xde, 0xdd, 0x5e, 0x2a, 0x20, 0x84, 0xab, 0x55, 0x5a, 0xaa, 0xaa,
-  0xa9, 0x4a, 0xa5, 0xff, 0xff, 0xff, 0xfd, 0xef, 0xff, 0xf7, 0xef, 0xff,
-  0x7d, 0x6f, 0xd2, 0xa4, 0x55, 0x48, 0x52, 0x15, 0x25, 0xa4, 0x88, 0x89,
-  0x22, 0x92, 0x62, 0x4a, 0x49, 0x14, 0x00, 0x12, 0x94, 0x49, 0x00, 0x00,
-  0x02, 0xaa, 0xb6, 0xb5, 0x6d, 0xd5, 0xb6, 0xd7, 0x57, 0xdd, 0x7b, 0x5d,
-  0xb6, 0xda, 0x00, 0x02, 0xaa, 0xdd, 0x2b, 0xdd, 0xb6, 0xb5, 0x56, 0xdd,
-  0xf5, 0x4a, 0xab, 0x5b, 0x6d, 0x55, 0x5a, 0xbd, 0xb6, 0xd7, 0x77, 0xd7,
-  0x41, 0x10, 0x05, 0x49, 0x56, 0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0x2a, 0xff,
-  0xff, 0xbf, 0xbf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xaa, 0xda, 0x90, 0xa1,
-  0x00, 0x05, 0x08, 0xa2, 0xaa, 0x49, 0x25, 0x22, 0x11, 0x25, 0x14, 0xaa,
-  0xaa, 0x81, 0x00, 0x4a, 0x4a, 0x92, 0x40, 0x00, 0x00, 0xad, 0x55, 0xaf,
-  0xb6, 0xfa, 0xd7, 0x7a, 0xed, 0x6f, 0xad, 0xd6, 0xdb, 0x50, 0x80, 0xb5,
-  0x69, 0x56, 0xca, 0xb5, 0x6a, 0xdb, 0x49, 0x56, 0xad, 0x6a, 0xaa, 0xa5,
-  0x55, 0xb7, 0xad, 0xa6, 0xdb, 0x6a, 0xda, 0xed, 0xa0, 0x00, 0x21, 0x2a,
-  0xa9, 0x55, 0x56, 0xaa, 0xaa, 0xa5, 0x52, 0x5b, 0xff, 0xff, 0xff, 0xff,
-  0xdf, 0x7d, 0xff, 0x7e, 0xe9, 0x6a, 0x54, 0x94, 0x55, 0x50, 0xa5, 0x28,
-  0x92, 0x48, 0x10, 0x92, 0x94, 0x94, 0x92, 0x48, 0x80, 0x54, 0x00, 0x52,
-  0xa2, 0x49, 0x20, 0x00, 0x00, 0x05, 0xaa, 0xb2, 0xaa, 0xaf, 0x75, 0xaf,
-  0x77, 0x75, 0xb6, 0xdb, 0x6d, 0x40, 0x12, 0x95, 0xba, 0xab, 0x6a, 0xdd,
-  0xb5, 0x55, 0x6d, 0x52, 0xab, 0x5b, 0x6a, 0xb5, 0x55, 0x54, 0xed, 0x6b,
-  0x6b, 0x5b, 0x56, 0xb6, 0xf4, 0x00, 0x09, 0x55, 0x56, 0xd5, 0x55, 0x5a,
-  0xaa, 0x54, 0x95, 0x5d, 0xb7, 0xed, 0xfe, 0xed, 0xf7, 0xff, 0xff, 0xff,
-  0xb5, 0xa9, 0x45, 0x22, 0x84, 0x0a, 0x08, 0x95, 0x48, 0x85, 0x44, 0x20,
-  0x8a, 0x52, 0xaa, 0x95, 0x5a, 0x82, 0x80, 0x29, 0x29, 0x24, 0x48, 0x00,
-  0x00, 0x00, 0xad, 0xad, 0xbd, 0xb5, 0xae, 0xda, 0xda, 0xdb, 0x6d, 0x6d,
-  0x50, 0x10, 0x49, 0x6a, 0x56, 0xad, 0xb5, 0x2a, 0xad, 0x2b, 0x5b, 0x55,
-  0x55, 0x55, 0x5b, 0x55, 0x55, 0x55, 0x2b, 0xb5, 0xad, 0xed, 0xdd, 0xbd,
-  0xb0, 0x88, 0x02, 0x2a, 0xaa, 0xb6, 0xaa, 0xaa, 0xaa, 0xaa, 0xa4, 0xaf,
-  0xff, 0xff, 0xb7, 0xff, 0xff, 0xde, 0xdb, 0xdf, 0xaa, 0xa9, 0x24, 0x94,
-  0x52, 0xa1, 0x4a, 0xa4, 0x24, 0xa4, 0x22, 0x94, 0xa2, 0x88, 0x88, 0x52,
-  0x42, 0x50, 0x20, 0x94, 0x94, 0x92, 0x22, 0x00, 0x00, 0x00, 0x2a, 0xaa,
-  0xa6, 0xd5, 0x6b, 0x6b, 0x6f, 0x6b, 0x6b, 0x55, 0x40, 0x05, 0x55, 0x5b,
-  0x5a, 0xa2, 0xdd, 0xae, 0xd5, 0xa9, 0x2a, 0xed, 0x55, 0x55, 0x55, 0x55,
-  0xb7, 0x6d, 0xd4, 0xae, 0xea, 0x36, 0xd6, 0xd6, 0xbe, 0x00, 0x22, 0xa2,
-  0xaa, 0x95, 0x6a, 0xaa, 0xaa, 0xaa, 0x52, 0x93, 0x6d, 0x6f, 0xff, 0x7f,
-  0x7d, 0xff, 0xff, 0xfb, 0x72, 0x44, 0xaa, 0x25, 0x24, 0x94, 0x52, 0x52,
-  0x92, 0x49, 0x15, 0x25, 0x10, 0x55, 0x26, 0x8a, 0xa9, 0x24, 0x00, 0x4a,
-  0xa5, 0x29, 0x48, 0x80, 0x00, 0x00, 0x01, 0x56, 0xda, 0xbb, 0xbd, 0xbd,
-  0xb5, 0xb5, 0xb5, 0x50, 0x01, 0x28, 0xad, 0x55, 0x26, 0xda, 0x56, 0xd5,
-  0x56, 0xb6, 0xaa, 0xb6, 0xda, 0xaa, 0xaa, 0xaa, 0xa9, 0x56, 0xab, 0x6a,
-  0xbb, 0xd5, 0x7a, 0xbb, 0xd5, 0x00, 0x00, 0x2a, 0x55, 0x6a, 0xaa, 0xaa,
-  0xaa, 0xa9, 0x2a, 0x4a, 0xaa, 0xa8, 0x92, 0xa5, 0xd7, 0x6d, 0xdd, 0xdf,
-  0x59, 0x25, 0x22, 0x91, 0x22, 0x45, 0x4a, 0x8a, 0x92, 0x41, 0x40, 0x21,
-  0x4a, 0x90, 0x92, 0xa9, 0x14, 0x81, 0x00, 0x24, 0x91, 0x44, 0x4a, 0x20,
-  0x00, 0x00, 0x00, 0x15, 0x55, 0xad, 0x56, 0xd6, 0xd5, 0x5a, 0xaa, 0x00,
-  0x05, 0x42, 0xaa, 0xad, 0xd5, 0x5a, 0xab, 0x55, 0x69, 0x5b, 0x54, 0x95,
-  0x6b, 0x6d, 0xaa, 0xd5, 0x55, 0x55, 0x6d, 0xaa, 0xad, 0x6d, 0x8b, 0xda,
-  0xdf, 0xc8, 0x4a, 0x92, 0x95, 0x55, 0xaa, 0xaa, 0xaa, 0xaa, 0x92, 0xaa,
-  0xab, 0x55, 0x54, 0x94, 0x11, 0x24, 0x4a, 0x6a, 0xa4, 0xa9, 0x14, 0x49,
-  0x49, 0x28, 0x24, 0x50, 0x20, 0x94, 0x2a, 0x94, 0x2a, 0x45, 0x49, 0x4a,
-  0x49, 0x28, 0x41, 0x49, 0x2a, 0x29, 0x21, 0x48, 0x00, 0x00, 0x00, 0x00,
-  0xaa, 0xaa, 0xd5, 0x55, 0x5a, 0xaa, 0x00, 0x00, 0x28, 0x1a, 0xd6, 0x95,
-  0x52, 0xd6, 0xaa, 0xd6, 0xb7, 0x55, 0xb5, 0x54, 0x95, 0x55, 0x6e, 0xba,
-  0xd5, 0x53, 0x55, 0x76, 0xd7, 0x5a, 0xfa, 0xb7, 0x6a, 0xa0, 0x00, 0x4a,
-  0x55, 0x56, 0xb5, 0xb5, 0x55, 0x2a, 0xa9, 0x25, 0x6a, 0xaa, 0x82, 0x4a,
-  0xca, 0x4a, 0x91, 0x12, 0xd2, 0x25, 0x52, 0xa4, 0x29, 0x4a, 0x92, 0x0a,
-  0x8a, 0x25, 0x20, 0x85, 0x22, 0x14, 0x4a, 0x22, 0xa4, 0x84, 0x00, 0x24,
-  0x89, 0x25, 0x2a, 0x4a, 0x00, 0x00, 0x00, 0x00, 0x01, 0x55, 0x55, 0x55,
-  0x55, 0x00, 0x00, 0x00, 0x00, 0xaa, 0x55, 0xa5, 0x5a, 0x56, 0xaa, 0xb5,
-  0xb5, 0xd4, 0xd7, 0x55, 0x6a, 0xaa, 0xaa, 0xab, 0x6d, 0x54, 0xaa, 0xaa,
-  0xb5, 0x6e, 0xae, 0xdb, 0xbb, 0xe8, 0x01, 0x29, 0x54, 0xaa, 0xaa, 0xaa,
-  0xaa, 0xaa, 0x94, 0xa9, 0x2d, 0xad, 0x6a, 0xa2, 0x52, 0x50, 0x95, 0x49,
-  0x94, 0x91, 0x24, 0x95, 0x44, 0x95, 0x25, 0x51, 0x24, 0x91, 0x14, 0x21,
-  0x11, 0x49, 0x51, 0x54, 0x49, 0x20, 0x54, 0x92, 0x52, 0x92, 0x49, 0x22,
-  0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x0b, 0x5b, 0x2a, 0xd5, 0x6b, 0x55, 0xaa, 0xc9, 0x5a, 0xba, 0x2a, 0xdb,
-  0x5a, 0xa9, 0x55, 0x55, 0x5b, 0x6d, 0x52, 0x57, 0x6a, 0xab, 0x55, 0xad,
-  0xdd, 0x58, 0x10, 0x45, 0x25, 0x55, 0x55, 0x5a, 0xaa, 0xa4, 0xaa, 0x95,
-  0x55, 0x6a, 0x90, 0x54, 0x95, 0x15, 0x22, 0x55, 0x42, 0x94, 0x92, 0xa2,
-  0x52, 0x40, 0x91, 0x09, 0x20, 0x08, 0x42, 0x94, 0x94, 0xa5, 0x15, 0x45,
-  0x49, 0x12, 0x04, 0x8a, 0x94, 0x4a, 0x49, 0x28, 0x8a, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x6a, 0xaa, 0xaa, 0xaa,
-  0xad, 0x55, 0x6a, 0x64, 0x56, 0xcb, 0xd5, 0x2d, 0x56, 0xaa, 0xaa, 0xa9,
-  0x45, 0x55, 0xab, 0x51, 0x5e, 0xaa, 0xd6, 0xf6, 0xd6, 0xee, 0x84, 0x24,
-  0x95, 0x55, 0x55, 0xaa, 0xaa, 0xaa, 0x92, 0x49, 0x56, 0xaa, 0xd5, 0x12,
-  0x44, 0xa4, 0x92, 0x45, 0x28, 0x4a, 0xa9, 0x29, 0x09, 0x2a, 0x48, 0x40,
-  0x4b, 0x52, 0xaa, 0x4a, 0xa5, 0x10, 0xa4, 0x2a, 0x52, 0x40, 0x00, 0x51,
-  0x4a, 0xa2, 0x92, 0x45, 0x24, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x16, 0xaa, 0x55, 0x4a, 0xd5, 0x55, 0x55, 0xaa, 0x95,
-  0x55, 0x7d, 0x6a, 0xd2, 0xaa, 0xdb, 0x5a, 0xaa, 0xb5, 0x56, 0xb5, 0x5d,
-  0x55, 0xf7, 0x75, 0x5a, 0xbb, 0x5b, 0x00, 0x49, 0x55, 0x55, 0xaa, 0xad,
-  0x55, 0x55, 0x4a, 0xa4, 0x93, 0x55, 0x24, 0xa5, 0x52, 0x92, 0xa9, 0x29,
-  0x92, 0x24, 0x94, 0xa4, 0xaa, 0x89, 0x25, 0x15, 0x28, 0x4a, 0x29, 0x20,
-  0x90, 0x4a, 0x92, 0xa9, 0x12, 0x54, 0x55, 0x09, 0x21, 0x28, 0x4a, 0x54,
-  0x52, 0x48, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xaa,
-  0xaa, 0x95, 0x55, 0x59, 0x55, 0xaa, 0xaa, 0xaa, 0x4a, 0xa6, 0xbe, 0xd5,
-  0x52, 0x55, 0x55, 0x5a, 0x8a, 0xa2, 0xad, 0x55, 0x55, 0x55, 0x5e, 0xd7,
-  0xdb, 0xdd, 0xa0, 0x04, 0x92, 0xaa, 0xad, 0x55, 0x55, 0x25, 0x54, 0x95,
-  0x49, 0x75, 0xa5, 0x29, 0x2a, 0x54, 0x89, 0x25, 0x88, 0x92, 0x4a, 0x4a,
-  0x90, 0x44, 0x92, 0x48, 0x95, 0x25, 0x44, 0x8a, 0x4a, 0xa9, 0x4a, 0x45,
-  0x49, 0x09, 0x00, 0xa4, 0x95, 0x55, 0x51, 0x22, 0x94, 0xa5, 0x00, 0x00,
-  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x15, 0x6a, 0xaa, 0xab, 0x52, 0xad,
-  0x55, 0x54, 0xa9, 0x55, 0xa2, 0x55, 0xa5, 0xb7, 0x5a, 0x92, 0x96, 0xab,
-  0x75, 0x59, 0x55, 0x6a, 0xaa, 0xad, 0xd3, 0xba, 0xb6, 0xb6, 0xc1, 0x52,
-  0x4a, 0xaa, 0xaa, 0xd5, 0x55, 0x54, 0xa2, 0x52, 0x54, 0xad, 0x50, 0x8a,
-  0x92, 0x92, 0x54, 0x95, 0x42, 0x4a, 0xa5, 0x28, 0x8b, 0x52, 0x92, 0x4a,
-  0x41, 0x28, 0x24, 0xa9, 0x29, 0x24, 0x29, 0x54, 0xa9, 0x48, 0x2a, 0x24,
-  0x94, 0x85, 0x14, 0x92, 0x45, 0x15, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00,
-  0x00, 0x01, 0x55, 0x54, 0xaa, 0x89, 0x5a, 0xaa, 0x95, 0x52, 0x95, 0x54,
-  0xbd, 0x14, 0xb5, 0x5a, 0xd5, 0x55, 0x50, 0xaa, 0x95, 0x55, 0x4a, 0x95,
-  0xb5, 0x56, 0x55, 0xad, 0xdd, 0xb6, 0xe8, 0x02, 0x54, 0xaa, 0xaa, 0xad,
-  0x55, 0x55, 0x2a, 0xa9, 0x52, 0xaa, 0xaa, 0x48, 0x4a, 0x52, 0x44, 0x92,
-  0xa9, 0x25, 0x55, 0x45, 0x54, 0xa8, 0x49, 0x20, 0x94, 0x85, 0x4a, 0x44,
-  0x84, 0x4a, 0x84, 0x85, 0x24, 0x21, 0x04, 0x92, 0x4a, 0x52, 0xa5, 0x49,
-  0x28, 0xa1, 0x24, 0xa2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x55, 0x52,
-  0x94, 0xaa, 0xd5, 0x55, 0x55, 0x54, 0xaa, 0xaa, 0xa6, 0xd2, 0x4a, 0xab,
-  0x5a, 0xea, 0xae, 0x25, 0x6a, 0xaa, 0xa8, 0xaa, 0xae, 0xeb, 0xda, 0xdb,
-  0x6a, 0xef, 0xb4, 0x28, 0x92, 0xaa, 0xd5, 0x55, 0x55, 0x54, 0xa9, 0x15,
-  0x2a, 0x56, 0xa4, 0xa6, 0xa2, 0x89, 0x29, 0x2a, 0x09, 0x24, 0x49, 0x24,
-  0x92, 0x0a, 0x49, 0x0a, 0x12, 0xaa, 0x52, 0x52, 0x25, 0x52, 0xaa, 0x54,
-  0x92, 0x88, 0x52, 0x49, 0x22, 0x54, 0x92, 0x24, 0xa4, 0x94, 0x92, 0x29,
-  0x50, 0x00, 0x00, 0x01, 0x15, 0x55, 0x52, 0x54, 0xa5, 0x55, 0x6a, 0x55,
-  0x52, 0xaa, 0xa5, 0x55, 0x55, 0x5b, 0x52, 0x49, 0x56, 0xb6, 0xd3, 0x55,
-  0x15, 0x55, 0x4d, 0x52, 0xab, 0x35, 0x6b, 0x6b, 0x6e, 0xaa, 0xbd, 0x02,
-  0x4a, 0x55, 0x56, 0xab, 0x55, 0x55, 0x4a, 0xa4, 0x8a, 0x93, 0x52, 0x91,
-  0x2a, 0x54, 0x84, 0x85, 0xa0, 0x13, 0x24, 0x92, 0x49, 0x52, 0x92, 0x51,
-  0x48, 0x92, 0x08, 0x04, 0x92, 0x09, 0x45, 0x45, 0x4a, 0x42, 0x09, 0x24,
-  0x94, 0x8a, 0x49, 0x52, 0x12, 0x52, 0x4a, 0x95, 0x55, 0x55, 0x55, 0x54,
-  0xca, 0x55, 0x25, 0x2a, 0xaa, 0xa5, 0x35, 0x2a, 0x95, 0x15, 0x54, 0xaa,
-  0xaa, 0xa5, 0x6d, 0x52, 0x25, 0x5a, 0xbd, 0x55, 0x51, 0x55, 0x6a, 0x55,
-  0x2a, 0xdb, 0x5d, 0x5d, 0xbb, 0xdd, 0xd6, 0x04, 0xa5, 0x55, 0x55, 0x55,
-  0x55, 0x24, 0xa4, 0x95, 0x52, 0x54, 0xd4, 0x55, 0x51, 0x4a, 0x51, 0x2b,
-  0x0a, 0x8a, 0xa5, 0x55, 0x54, 0x88, 0x88, 0x84, 0x4a, 0x91, 0x42, 0xa5,
-  0x52, 0xa4, 0x24, 0x52, 0x52, 0x50, 0x44, 0x92, 0x44, 0xa1, 0x25, 0x15,
-  0x52, 0x92, 0x22, 0x49, 0x15, 0x55, 0x55, 0x52, 0x65, 0x12, 0x94, 0x8a,
-  0x9b, 0x52, 0x95, 0x95, 0x54, 0xa5, 0x56, 0x8a, 0xaa, 0xb5, 0x2b, 0x5d,
-  0x54, 0x0a, 0xcb, 0x75, 0x55, 0x15, 0x2b, 0xa9, 0x4a, 0x55, 0x6d, 0xed,
-  0xda, 0xd7, 0x77, 0xe0, 0x29, 0x2a, 0xaa, 0xb5, 0xaa, 0xaa, 0x55, 0x52,
-  0x55, 0x52, 0xa5, 0x24, 0x95, 0x22, 0x94, 0x49, 0xa0, 0x51, 0x29, 0x22,
-  0x4a, 0xa4, 0x52, 0x52, 0x20, 0x44, 0x94, 0x90, 0x88, 0x92, 0xa9, 0x49,
-  0x25, 0x04, 0x12, 0x49, 0x22, 0x1a, 0x52, 0xa2, 0x88, 0x49, 0x51, 0x24,
-  0xa2, 0x92, 0x29, 0x2a, 0x95, 0x49, 0x52, 0xb5, 0x4a, 0xa9, 0x54, 0x52,
-  0x49, 0x55, 0xa5, 0x6a, 0x25, 0x55, 0x48, 0xa5, 0xab, 0xa4, 0xaa, 0x96,
-  0xaa, 0xa2, 0xaa, 0x56, 0xa9, 0xaa, 0xaa, 0x37, 0x6e, 0xf5, 0xad, 0x45,
-  0x4a, 0xaa, 0xaa, 0xad, 0x55, 0x55, 0x52, 0x49, 0x24, 0x94, 0xb4, 0x92,
-  0x49, 0x54, 0x42, 0x95, 0x92, 0x0a, 0xa5, 0x29, 0x22, 0x25, 0x12, 0x12,
-  0x95, 0x14, 0xa4, 0x8a, 0x4a, 0x49, 0x25, 0x2a, 0x94, 0xa2, 0x91, 0x25,
-  0x51, 0x42, 0x88, 0x94, 0xa5, 0x25, 0x14, 0x92, 0x14, 0x52, 0xa5, 0x24,
-  0xa9, 0x55, 0x4a, 0x95, 0x55, 0x54, 0xab, 0x55, 0x25, 0x15, 0x54, 0xaa,
-  0xb4, 0x95, 0x6e, 0xb4, 0xaa, 0xaa, 0x22, 0xdb, 0xb5, 0x5a, 0x89, 0x52,
-  0xac, 0xaf, 0xaf, 0xd9, 0x6b, 0x5a, 0xf7, 0x70, 0x22, 0x4a, 0xaa, 0xaa,
-  0xb5, 0x55, 0x4a, 0xaa, 0x92, 0x4a, 0x8a, 0xaa, 0xa4, 0x82, 0x10, 0x45,
-  0x20, 0x54, 0x94, 0x95, 0x54, 0x80, 0x44, 0xa4, 0x49, 0x44, 0x12, 0x44,
-  0x84, 0xa4, 0x92, 0x91, 0x42, 0x90, 0x04, 0x92, 0x2a, 0x28, 0x55, 0x2a,
-  0x4a, 0x91, 0x49, 0x49, 0x49, 0x09, 0x14, 0x92, 0x45, 0x48, 0xa9, 0x55,
-  0x4a, 0xaa, 0xa8, 0x92, 0xa8, 0xa5, 0x55, 0x55, 0x55, 0x6a, 0x93, 0x5b,
-  0x52, 0xda, 0xc8, 0x24, 0xd6, 0xa4, 0xa4, 0x5a, 0xaa, 0x91, 0x55, 0x6e,
-  0xbd, 0x6d, 0x5a, 0xd4, 0x89, 0x55, 0x55, 0x55, 0xaa, 0xaa, 0xa9, 0x25,
-  0x55, 0x52, 0x6a, 0x49, 0x2a, 0x54, 0xa5, 0x2a, 0x08, 0x12, 0xa5, 0x50,
-  0x02, 0x55, 0x22, 0x25, 0x49, 0x25, 0x49, 0x24, 0x52, 0x25, 0x52, 0x55,
-  0x34, 0x92, 0x20, 0x92, 0x82, 0xa5, 0x24, 0xa2, 0x51, 0x54, 0x4a, 0x2a,
-  0x4a, 0xa4, 0xa5, 0x55, 0x29, 0x2a, 0x55, 0x55, 0x55, 0x4a, 0x96, 0x54,
-  0x26, 0xa9, 0x55, 0x55, 0x2e, 0xaa, 0xd9, 0x55, 0x5a, 0x2b, 0x6e, 0x92,
-  0x5a, 0xb6, 0xb5, 0x42, 0xab, 0x6a, 0xaa, 0xb7, 0xa7, 0xd7, 0xaf, 0x74,
-  0x49, 0x52, 0x4a, 0xaa, 0xaa, 0xaa, 0x55, 0x54, 0x49, 0x29, 0x25, 0x24,
-  0x91, 0x25, 0x11, 0x13, 0x42, 0x54, 0x95, 0x25, 0x54, 0x90, 0x94, 0x88,
-  0x24, 0xa8, 0x92, 0x49, 0x04, 0x90, 0x94, 0x91, 0x49, 0x48, 0x85, 0x29,
-  0x54, 0x4a, 0x92, 0x2a, 0x8a, 0x4a, 0xa5, 0x49, 0x52, 0x92, 0x91, 0x25,
-  0x54, 0xa5, 0x49, 0x24, 0xa5, 0x51, 0x49, 0x42, 0xa9, 0x4a, 0xaa, 0xaa,
-  0xab, 0x6d, 0x6e, 0xaa, 0xab, 0xa5, 0x55, 0x49, 0x0b, 0x55, 0xd4, 0xa8,
-  0x55, 0x95, 0x6a, 0xab, 0x7a, 0xa9, 0x6a, 0xdd, 0x04, 0x29, 0x55, 0x55,
-  0x6a, 0xa5, 0x4a, 0x4a, 0xa5, 0x4a, 0x95, 0x55, 0x4a, 0x90, 0xa4, 0x4a,
-  0x50, 0x4a, 0xa8, 0x94, 0xa5, 0x4a, 0x42, 0xa5, 0x24, 0x8a, 0x49, 0x21,
-  0x52, 0x4a, 0x42, 0x55, 0x25, 0x22, 0x01, 0x44, 0x12, 0x52, 0x4a, 0x92,
-  0x55, 0x49, 0x51, 0x24, 0x88, 0x94, 0xaa, 0x94, 0x92, 0x95, 0x25, 0x55,
-  0x29, 0x55, 0x2a, 0x54, 0x95, 0x2a, 0xa9, 0x5b, 0x55, 0xab, 0x52, 0xea,
-  0xaa, 0xba, 0x55, 0x6c, 0xa1, 0x5a, 0xad, 0x56, 0x8a, 0xd5, 0x5b, 0xd5,
-  0xae, 0xfd, 0xb7, 0x6d, 0xa2, 0x8a, 0xaa, 0xb6, 0xb5, 0x55, 0x52, 0xa9,
-  0x29, 0x24, 0xa4, 0xa4, 0xaa, 0x4a, 0x22, 0x4b, 0x85, 0x24, 0x85, 0x22,
-  0x52, 0x52, 0x28, 0x52, 0x92, 0x51, 0x22, 0x48, 0x89, 0x24, 0xaa, 0x88,
-  0xa8, 0x94, 0x88, 0x2a, 0xaa, 0x89, 0x22, 0x49, 0x22, 0x24, 0xaa, 0xaa,
-  0x55, 0x52, 0x95, 0x52, 0xaa, 0x52, 0xa9, 0x2a, 0x94, 0x94, 0x81, 0x25,
-  0x5a, 0xd6, 0xd6, 0xb5, 0x5a, 0xaa, 0xed, 0x56, 0xa4, 0xab, 0x95, 0x57,
-  0x54, 0x25, 0x56, 0xa9, 0x55, 0x59, 0x56, 0x5e, 0xbb, 0x2a, 0xda, 0xdb,
-  0x49, 0x55, 0x2a, 0xaa, 0xaa, 0xaa, 0x55, 0x24, 0xa4, 0xaa, 0x52, 0xaa,
-  0x42, 0xa4, 0x91, 0x12, 0x20, 0xaa, 0xa4, 0xaa, 0x8a, 0x4a, 0x95, 0x08,
-  0x49, 0x09, 0x29, 0x2a, 0x48, 0x84, 0x92, 0x55, 0x25, 0x44, 0x42, 0x81,
-  0x20, 0xa4, 0xa9, 0x24, 0xaa, 0xaa, 0x24, 0x95, 0x45, 0x4a, 0x52, 0x49,
-  0x29, 0x49, 0x55, 0x49, 0x4a, 0x45, 0x55, 0x52, 0x4a, 0x53, 0x52, 0xd5,
-  0xab, 0x6d, 0x2b, 0x73, 0x76, 0x94, 0xd5, 0x29, 0x55, 0x90, 0x5a, 0xae,
-  0xa1, 0x4e, 0xaa, 0xd5, 0xd5, 0xae, 0xab, 0x6b, 0x64, 0x51, 0x55, 0x55,
-  0x6a, 0xa5, 0x54, 0x95, 0x2a, 0x91, 0x49, 0x25, 0x2a, 0x24, 0x88, 0x4b,
-  0x8a, 0x92, 0x52, 0x44, 0xa2, 0x91, 0x49, 0x52, 0x92, 0x54, 0x92, 0x44,
-  0x82, 0x52, 0x49, 0x4a, 0x94, 0xa9, 0x14, 0x5a, 0x95, 0x2a, 0x12, 0x49,
-  0x11, 0x12, 0xa9, 0x4a, 0x29, 0x32, 0x95, 0x55, 0x4a, 0xaa, 0x49, 0x2a,
-  0xa5, 0x52, 0x92, 0x55, 0x5d, 0xa9, 0x6d, 0x5a, 0x5d, 0x55, 0xd4, 0x9d,
-  0xba, 0xaa, 0xaa, 0x95, 0x6a, 0x55, 0x05, 0x6a, 0xaa, 0x53, 0x55, 0xae,
-  0xb7, 0xd5, 0xae, 0xbd, 0xa9, 0x2a, 0x95, 0x56, 0xb5, 0x55, 0x2a, 0xa4,
-  0x91, 0x2a, 0x2a, 0xa9, 0x51, 0x49, 0x22, 0x25, 0x0a, 0x51, 0x09, 0x54,
-  0xa8, 0x55, 0x24, 0x48, 0x89, 0x42, 0x49, 0x22, 0x51, 0x12, 0x25, 0x22,
-  0x52, 0x08, 0x40, 0x44, 0x54, 0x89, 0x49, 0x54, 0x95, 0x49, 0x4a, 0x52,
-  0xa5, 0x4a, 0xa9, 0x49, 0x55, 0x2a, 0xaa, 0xa4, 0x29, 0x2a, 0x49, 0x54,
-  0xaa, 0xad, 0x6a, 0xdb, 0xa6, 0xd4, 0xaa, 0xd5, 0x55, 0x6a, 0x55, 0xa9,
-  0x55, 0xa4, 0xa1, 0x2a, 0xea, 0x8a, 0xd5, 0x75, 0x5a, 0x55, 0x6a, 0xcd,
-  0x6c, 0x8a, 0x55, 0x55, 0x5a, 0xaa, 0x92, 0x95, 0x49, 0x4a, 0xa4, 0x94,
-  0x95, 0x24, 0x11, 0x25, 0x52, 0x84, 0xb4, 0x42, 0x4a, 0x88, 0x92, 0x92,
-  0x24, 0x29, 0x24, 0x94, 0x8a, 0x49, 0x52, 0x55, 0x4a, 0xd2, 0x95, 0x29,
-  0x02, 0x52, 0x2a, 0x25, 0x48, 0x94, 0xa4, 0x95, 0x29, 0x24, 0x94, 0xaa,
-  0x49, 0x44, 0x92, 0x12, 0x92, 0x89, 0x55, 0x55, 0x55, 0x55, 0xaa, 0xaa,
-  0x5a, 0xab, 0x6a, 0xaa, 0xaa, 0xb5, 0xa4, 0xae, 0x2a, 0x5a, 0xaa, 0x05,
-  0x35, 0x52, 0xba, 0xae, 0xb7, 0xb5, 0xb7, 0x77, 0xb5, 0x25, 0x4a, 0xaa,
-  0xaa, 0xaa, 0xa9, 0x48, 0xaa, 0x22, 0x52, 0xaa, 0xa0, 0x91, 0x44, 0x12,
-  0x8a, 0x54, 0x82, 0x59, 0x22, 0x4a, 0x94, 0x89, 0x25, 0x49, 0x22, 0x42,
-  0x22, 0x44, 0x89, 0x12, 0x52, 0x4a, 0x40, 0x05, 0x6a, 0x95, 0x49, 0x24,
-  0x4a, 0x44, 0x92, 0x49, 0x25, 0x55, 0x4a, 0x49, 0x54, 0xb2, 0xa9, 0x4a,
-  0x94, 0xa4, 0xa5, 0x56, 0xab, 0x55, 0x55, 0x55, 0xd6, 0xaa, 0xaa, 0xa9,
-  0x5e, 0xaa, 0xaa, 0xa5, 0xd2, 0xaa, 0xa9, 0x50, 0xaa, 0xa9, 0x4d, 0x53,
-  0xea, 0xd5, 0x52, 0xb5, 0xb7, 0x54, 0xaa, 0xd5, 0xad, 0x55, 0x54, 0xa5,
-  0x12, 0xa9, 0x15, 0x25, 0x2a, 0x4a, 0x21, 0x4a, 0x51, 0x22, 0x5a, 0x84,
-  0x94, 0xa0, 0xa2, 0x52, 0x90, 0x24, 0x94, 0xa9, 0x54, 0x92, 0x52, 0xa5,
-  0x29, 0x29, 0x2a, 0xb2, 0x11, 0x24, 0xa4, 0xaa, 0xaa, 0xaa, 0x4a, 0x92,
-  0x51, 0x24, 0xa5, 0x2a, 0x0a, 0x48, 0x95, 0x28, 0xa5, 0x2a, 0xaa, 0xb5,
-  0x5a, 0xaa, 0xb5, 0x6d, 0x29, 0xaa, 0xa9, 0x6a, 0xaa, 0xad, 0x5a, 0x4a,
-  0x55, 0x15, 0x55, 0x4a, 0x15, 0xaa, 0x76, 0xac, 0xb6, 0xad, 0x5d, 0xad,
-  0xda, 0xa2, 0xaa, 0xad, 0x6a, 0xaa, 0xaa, 0xaa, 0xa9, 0x2a, 0xa4, 0x95,
-  0x55, 0x20, 0x88, 0x25, 0x95, 0x2a, 0x89, 0x54, 0xa4, 0x2a, 0x28, 0x88,
-  0x96, 0xa4, 0xa2, 0x24, 0x04, 0x92, 0x48, 0x92, 0x8a, 0xa5, 0x40, 0x09,
-  0x94, 0xa4, 0x92, 0x89, 0x22, 0x49, 0x52, 0x49, 0x15, 0x25, 0x11, 0x49,
-  0xa9, 0x54, 0xa4, 0xa5, 0x14, 0x95, 0x55, 0x56, 0xab, 0xb5, 0x55, 0x52,
-  0xae, 0xaa, 0xee, 0xaa, 0xa9, 0x55, 0x4b, 0x52, 0x55, 0xa4, 0xaa, 0xaa,
-  0x85, 0x5b, 0x12, 0xd7, 0x5d, 0xa6, 0xa5, 0xb6, 0xdf, 0xaa, 0x4a, 0xaa,
-  0xaa, 0xaa, 0xa5, 0x29, 0x24, 0x92, 0x55, 0x54, 0x91, 0x2a, 0x41, 0x15,
-  0x48, 0x91, 0x24, 0xa2, 0x4a, 0x89, 0x4a, 0x52, 0x41, 0x12, 0x14, 0x92,
-  0xa8, 0x44, 0x95, 0x49, 0x52, 0x52, 0x2a, 0x92, 0x4a, 0x2a, 0x54, 0xa5,
-  0x54, 0xa4, 0x94, 0xaa, 0x49, 0x28, 0xaa, 0x44, 0x44, 0x95, 0x29, 0x28,
-  0xa5, 0x55, 0xaa, 0xda, 0xaa, 0x4d, 0xaa, 0xac, 0xaa, 0xaa, 0xa9, 0x54,
-  0xd6, 0x55, 0xb5, 0x55, 0x29, 0x55, 0x15, 0x54, 0xa0, 0xaa, 0xab, 0x6a,
-  0xaa, 0xa9, 0x55, 0x57, 0x6a, 0xa9, 0x52, 0xaa, 0xb5, 0x54, 0xaa, 0x92,
-  0x95, 0x49, 0x24, 0x92, 0xaa, 0x00, 0x28, 0xa5, 0x2a, 0x95, 0x52, 0x29,
-  0x20, 0x4a, 0x22, 0x49, 0x29, 0x49, 0x52, 0x48, 0x8a, 0x24, 0xa0, 0x24,
-  0x49, 0x2a, 0x92, 0x89, 0x22, 0x85, 0x25, 0x29, 0x12, 0x94, 0x92, 0x92,
-  0xa4, 0xa5, 0x12, 0x55, 0x2a, 0xa4, 0x94, 0xa5, 0x2a, 0xa5, 0x55, 0x55,
-  0x5b, 0x76, 0xb5, 0x55, 0x25, 0x4a, 0xad, 0x6a, 0x52, 0x96, 0xaa, 0xab,
-  0x84, 0x55, 0x44, 0xa6, 0xaa, 0x2a, 0xd1, 0x5a, 0xed, 0xaa, 0xda, 0xdb,
-  0x6d, 0x6a, 0x55, 0x55, 0x56, 0xaa, 0xa9, 0x54, 0xa9, 0x2a, 0x95, 0x54,
-  0xa9, 0x55, 0x04, 0x03, 0xa4, 0xa0, 0x95, 0x4a, 0x4a, 0x91, 0x49, 0x25,
-  0x54, 0x92, 0x09, 0x12, 0x45, 0x42, 0x16, 0x95, 0x54, 0x92, 0xa9, 0x24,
-  0xa9, 0x52, 0x92, 0x94, 0xa9, 0x55, 0x48, 0x49, 0x2a, 0x4a, 0xaa, 0x92,
-  0xa4, 0x52, 0x4a, 0x54, 0xaa, 0xaa, 0xaa, 0xaa, 0xd5, 0x49, 0x4a, 0xaa,
-  0xaa, 0xaa, 0xd2, 0x95, 0x6d, 0x55, 0x56, 0xaa, 0x75, 0x2a, 0xb2, 0x11,
-  0x54, 0x8a, 0xac, 0x55, 0x56, 0xd5, 0x6a, 0xb5, 0xb7, 0xb5, 0x2a, 0xaa,
-  0xda, 0xaa, 0x55, 0x55, 0x4a, 0xa5, 0x49, 0x25, 0x14, 0x80, 0x00, 0xaa,
-  0x2a, 0x2a, 0x91, 0x21, 0x52, 0x45, 0x24, 0x91, 0x02, 0x4a, 0xaa, 0x92,
-  0x50, 0x29, 0x52, 0x52, 0x42, 0xaa, 0x44, 0x24, 0x94, 0xaa, 0xaa, 0x45,
-  0x24, 0x49, 0x2b, 0x54, 0x93, 0x28, 0x8a, 0x54, 0x95, 0x4a, 0xa5, 0x4a,
-  0x95, 0x55, 0x6a, 0xaa, 0x55, 0x2b, 0x6a, 0xa9, 0x5a, 0xaa, 0x54, 0xd5,
-  0x55, 0x55, 0x2b, 0xab, 0x55, 0x42, 0x9a, 0x94, 0xaa, 0x42, 0x57, 0x5b,
-  0x7a, 0x55, 0x15, 0x55, 0x5a, 0xd5, 0x49, 0x55, 0x55, 0x55, 0x55, 0x25,
-  0x24, 0x94, 0xa4, 0x94, 0xa6, 0x54, 0x40, 0x05, 0xa5, 0x52, 0x4a, 0x54,
-  0x08, 0xa8, 0x95, 0x2a, 0x69, 0x22, 0x44, 0x49, 0x05, 0x42, 0x09, 0x0a,
-  0xaa, 0x49, 0x53, 0x12, 0x4a, 0x51, 0x25, 0x54, 0x95, 0x24, 0xa4, 0xaa,
-  0xa8, 0xa6, 0x52, 0x92, 0xa2, 0x29, 0x49, 0x35, 0x55, 0x55, 0x2a, 0xb5,
-  0x56, 0xaa, 0xa9, 0x56, 0x55, 0x15, 0xab, 0x54, 0xaa, 0xaa, 0xd0, 0xaa,
-  0xaa, 0xa8, 0xa5, 0x44, 0x25, 0x90, 0xaa, 0x8d, 0x95, 0x6d, 0x6e, 0xae,
-  0xed, 0x76, 0xaa, 0xaa, 0xb6, 0xaa, 0xaa, 0xa9, 0x52, 0x52, 0x55, 0x4a,
-  0x92, 0xa0, 0x04, 0x52, 0xa9, 0x49, 0x29, 0x4a, 0xca, 0x0a, 0x50, 0x91,
-  0x29, 0x2a, 0x52, 0x49, 0x54, 0x29, 0x49, 0x51, 0x12, 0xa5, 0x28, 0x92,
-  0x51, 0x15, 0x51, 0x25, 0x52, 0xaa, 0x92, 0x41, 0x25, 0x51, 0x49, 0x4a,
-  0x2a, 0xa4, 0x55, 0x4a, 0xab, 0x55, 0x6a, 0xaa, 0xa9, 0xaa, 0xaa, 0xa9,
-  0x4a, 0xca, 0xa8, 0xaa, 0xaa, 0x95, 0x1d, 0x56, 0xab, 0x54, 0x2a, 0xb5,
-  0x28, 0xda, 0x2a, 0xe5, 0xdd, 0x15, 0x2b, 0x52, 0xb7, 0x5a, 0xa5, 0x55,
-  0x55, 0xaa, 0x92, 0x95, 0x55, 0x4a, 0x94, 0xa2, 0x55, 0x5a, 0x00, 0x02,
-  0x25, 0x2a, 0x44, 0x24, 0x22, 0xd1, 0x15, 0x24, 0x8a, 0x42, 0x89, 0x12,
-  0x22, 0x84, 0xa4, 0x94, 0xa9, 0x29, 0x55, 0x54, 0x8a, 0xa4, 0xaa, 0xa9,
-  0x29, 0x24, 0xa9, 0x34, 0x94, 0x55, 0x2a, 0xa9, 0x92, 0x4b, 0x55, 0x5a,
-  0xd5, 0xaa, 0xaa, 0xaa, 0x55, 0x25, 0x55, 0x56, 0xb5, 0x2a, 0xa6, 0xb5,
-  0x55, 0x55, 0xd6, 0xa9, 0x55, 0x55, 0x81, 0x44, 0x82, 0x2a, 0x8a, 0xa9,
-  0x6b, 0x65, 0xa5, 0xdd, 0xdb, 0xad, 0x54, 0xaa, 0xb5, 0x55, 0x55, 0x52,
-  0x52, 0xa9, 0x4a, 0x55, 0x4a, 0xaa, 0x81, 0x28, 0x55, 0x49, 0x52, 0x92,
-  0x92, 0x15, 0x44, 0x92, 0x49, 0x28, 0xa5, 0x49, 0x28, 0x52, 0x24, 0xa5,
-  0x4a, 0x95, 0x12, 0x84, 0xa4, 0x92, 0x48, 0x94, 0x94, 0x94, 0xaa, 0x95,
-  0x55, 0x4a, 0xa9, 0x24, 0xa9, 0x51, 0x55, 0x55, 0x54, 0xaa, 0xaa, 0xaa,
-  0xaa, 0xaa, 0xa9, 0x51, 0x0a, 0xa5, 0x51, 0x55, 0x5a, 0xaa, 0x52, 0xa5,
-  0xaa, 0xaa, 0xb4, 0x52, 0xb8, 0xaa, 0xa2, 0xad, 0x3d, 0xaa, 0xd4, 0x6a,
-  0x6a, 0xed, 0xaa, 0x55, 0x56, 0xaa, 0xa9, 0x55, 0x2a, 0x4a, 0x51, 0x49,
-  0x24, 0xaa, 0xa0, 0x02, 0x92, 0x55, 0x25, 0x24, 0x24, 0x81, 0x52, 0x49,
-  0x25, 0x4a, 0x48, 0x92, 0x45, 0x24, 0x92, 0x12, 0x52, 0x54, 0xca, 0x6a,
-  0x52, 0x4a, 0xa6, 0x52, 0xaa, 0xa5, 0x12, 0xa4, 0xa5, 0x29, 0x24, 0x95,
-  0x55, 0x55, 0x54, 0xaa, 0xab, 0x5b, 0x55, 0x55, 0x55, 0x52, 0xa4, 0xac,
-  0xb5, 0x2a, 0xaa, 0xb5, 0x56, 0xaa, 0x96, 0xaa, 0xaa, 0x95, 0x55, 0x24,
-  0x46, 0x12, 0xa9, 0x6a, 0xaa, 0x52, 0x55, 0x57, 0x5d, 0xb7, 0x6a, 0xaa,
-  0xaa, 0xaa, 0xaa, 0xaa, 0xa5, 0x29, 0x4a, 0x25, 0x55, 0x55, 0x41, 0x51,
-  0xa9, 0x24, 0x94, 0x92, 0x91, 0x54, 0x49, 0x25, 0x24, 0x49, 0x2a, 0x49,
-  0x29, 0x12, 0x55, 0x52, 0x49, 0x52, 0x29, 0x22, 0x95, 0x52, 0x51, 0x4a,
-  0x92, 0x55, 0x49, 0x2a, 0x94, 0xaa, 0xaa, 0xaa, 0x4a, 0xaa, 0xb6, 0xaa,
-  0xad, 0x49, 0x52, 0xaa, 0x56, 0x95, 0x55, 0x56, 0x95, 0x4b, 0x55, 0x5a,
-  0xa9, 0x56, 0xab, 0x55, 0x4a, 0xe5, 0x54, 0xa2, 0x52, 0x92, 0xad, 0x2b,
-  0x4a, 0xda, 0xaf, 0x2a, 0xd6, 0xd5, 0x6a, 0x95, 0x6a, 0xd5, 0x4a, 0x49,
-  0x54, 0xa5, 0x2a, 0xaa, 0x55, 0x49, 0x04, 0x05, 0x4a, 0xaa, 0xa2, 0x54,
-  0x0a, 0x52, 0x2a, 0x91, 0x49, 0x24, 0x89, 0x24, 0x84, 0xa5, 0x12, 0x89,
-  0x2a, 0x4a, 0xa5, 0x51, 0x24, 0x49, 0x2a, 0x52, 0x55, 0x49, 0x54, 0x92,
-  0x52, 0x92, 0x4a, 0x95, 0x55, 0x75, 0x55, 0x55, 0x52, 0xaa, 0xaa, 0xaa,
-  0xaa, 0xaa, 0xa9, 0x54, 0xaa, 0xaa, 0xd5, 0x55, 0x5e, 0xab, 0x54, 0xaa,
-  0xaa, 0x2a, 0x93, 0x29, 0x29, 0x41, 0x2a, 0x55, 0x55, 0x55, 0x52, 0xd7,
-  0x5a, 0xbb, 0x95, 0x55, 0x56, 0xaa, 0xaa, 0xaa, 0x4a, 0x94, 0xa5, 0x25,
-  0x2a, 0xaa, 0x50, 0x92, 0x2a, 0x92, 0x59, 0x41, 0x51, 0x15, 0x44, 0x94,
-  0x2a, 0x92, 0xa4, 0x92, 0xa4, 0x91, 0x48, 0xaa, 0xaa, 0xa5, 0x29, 0x0c,
-  0x95, 0x2a, 0x95, 0x29, 0x49, 0x55, 0x25, 0x4a, 0xaa, 0x55, 0x25, 0x55,
-  0x55, 0x2a, 0xaa, 0xaa, 0xad, 0x56, 0xaa, 0xaa, 0xaa, 0xa5, 0x4a, 0xaa,
-  0xaa, 0xaa, 0x55, 0xaa, 0xa2, 0xaa, 0xab, 0xaa, 0xa5, 0xaa, 0xca, 0x85,
-  0x0a, 0xbc, 0xab, 0x4a, 0xd5, 0x55, 0x5a, 0xa9, 0x56, 0xda, 0xf5, 0x4a,
-  0xaa, 0xaa, 0xaa, 0xaa, 0xa9, 0x55, 0x24, 0xa9, 0x4a, 0xa8, 0x00, 0x02,
-  0x49, 0x55, 0x24, 0x2a, 0x4a, 0x42, 0x29, 0x4a, 0x84, 0x48, 0x55, 0x49,
-  0x29, 0x2a, 0x52, 0x44, 0x84, 0xaa, 0x94, 0xa2, 0x42, 0x92, 0x49, 0x55,
-  0x54, 0xa9, 0x54, 0xaa, 0x55, 0x4a, 0xd5, 0x56, 0xd6, 0xd5, 0x55, 0x55,
-  0x52, 0xa9, 0x55, 0x55, 0x55, 0x55, 0x69, 0x55, 0x55, 0x55, 0xaa, 0x55,
-  0x5d, 0x55, 0xaa, 0x55, 0x4a, 0x95, 0x35, 0x74, 0xa1, 0x42, 0x15, 0x52,
-  0xb5, 0x2b, 0x4a, 0xea, 0xeb, 0x55, 0x5b, 0x54, 0xaa, 0xd5, 0x55, 0x52,
-  0x95, 0x49, 0x52, 0x95, 0x55, 0x45, 0x02, 0x49, 0xaa, 0x52, 0xa6, 0x92,
-  0x49, 0x29, 0x22, 0x29, 0x65, 0x2d, 0x12, 0x24, 0x84, 0x88, 0x8a, 0x52,
-  0x55, 0x29, 0x4a, 0xaa, 0xaa, 0x4a, 0xa5, 0x25, 0x25, 0x25, 0x4a, 0xaa,
-  0x92, 0xaa, 0xb5, 0x55, 0x6a, 0x55, 0x55, 0x55, 0x55, 0x4a, 0xa9, 0x54,
-  0x95, 0x55, 0x2a, 0xaa, 0x56, 0xaa, 0xaa, 0xb5, 0x55, 0xaa, 0xaa, 0xab,
-  0x6a, 0xa2, 0xc9, 0x14, 0x94, 0x15, 0xca, 0xa9, 0x55, 0xa9, 0x6a, 0x5a,
-  0xbd, 0xbf, 0x6a, 0xaa, 0xaa, 0xaa, 0xaa, 0x95, 0x52, 0x55, 0x2a, 0x4a,
-  0xaa, 0xa0, 0x20, 0x41, 0x95, 0x2a, 0x91, 0x49, 0x02, 0x44, 0x95, 0x44,
-  0x12, 0x82, 0xa4, 0xaa, 0x52, 0x52, 0x52, 0x95, 0x48, 0x94, 0xa4, 0x91,
-  0x24, 0xa4, 0x92, 0x92, 0x94, 0x94, 0xa9, 0x25, 0x55, 0x55, 0x55, 0x54,
-  0x95, 0xaa, 0xaa, 0xa9, 0x55, 0x55, 0x55, 0x55, 0x55, 0x25, 0xd5, 0x6d,
-  0x55, 0x55, 0xd5, 0x5b, 0x55, 0x5a, 0xad, 0xaa, 0xa9, 0x55, 0x52, 0xa5,
-  0x22, 0xa2, 0x2a, 0xb4, 0x55, 0x55, 0x5d, 0x57, 0x4a, 0xd5, 0x5a, 0xd5,
-  0x55, 0x6a, 0xa5, 0x52, 0x4a, 0x92, 0x95, 0x52, 0xa9, 0x00, 0x00, 0x08,
-  0xa4, 0x92, 0x55, 0x24, 0xaa, 0x52, 0x51, 0x25, 0x48, 0x69, 0x25, 0x22,
-  0x92, 0x95, 0x48, 0xa4, 0xa5, 0x4a, 0x52, 0x94, 0x92, 0x92, 0xa8, 0xa8,
-  0xaa, 0xaa, 0x55, 0x52, 0x55, 0x55, 0x55, 0x56, 0xaa, 0xad, 0xaa, 0xaa,
-  0xaa, 0xaa, 0xaa, 0xaa, 0x4a, 0xaa, 0x55, 0x2a, 0xab, 0x54, 0x6a, 0xa9,
-  0x56, 0xad, 0xa4, 0xaa, 0xa5, 0x54, 0x8a, 0x95, 0x2a, 0x92, 0xaa, 0x97,
-  0x5a, 0xaa, 0xa5, 0x5d, 0xb5, 0x75, 0xd7, 0x55, 0x56, 0xaa, 0xaa, 0xaa,
-  0xaa, 0xa9, 0x49, 0x48, 0x94, 0x80, 0x0a, 0x00, 0x95, 0x49, 0x52, 0xa9,
-  0x24, 0x89, 0x0a, 0x52, 0x55, 0x14, 0x92, 0x94, 0x54, 0x44, 0x55, 0x12,
-  0x55, 0x42, 0xa9, 0x4a, 0x49, 0x29, 0x2a, 0x4a, 0x95, 0x4a, 0x95, 0x55,
-  0x2a, 0xad, 0xb6, 0xaa, 0xd5, 0x52, 0xaa, 0xaa, 0x55, 0x55, 0x4a, 0x55,
-  0x55, 0x55, 0x6a, 0xd5, 0x55, 0x57, 0xab, 0x6e, 0xaa, 0xaa, 0xab, 0x55,
-  0xad, 0x52, 0xaa, 0x45, 0x48, 0x58, 0x55, 0x54, 0x0b, 0x6d, 0x5b, 0x65,
-  0x4e, 0xae, 0xba, 0xd5, 0x55, 0x55, 0x54, 0xaa, 0xa4, 0xaa, 0xaa, 0x52,
-  0x4a, 0x20, 0x52, 0xaa, 0xa9, 0x55, 0x4a, 0x49, 0x12, 0x24, 0xa8, 0x89,
-  0x45, 0x52, 0xa8, 0xa5, 0x12, 0x52, 0x41, 0x55, 0x48, 0xba, 0x95, 0x29,
-  0x24, 0xa4, 0xa5, 0x24, 0x91, 0x29, 0x52, 0x4a, 0xa5, 0x55, 0x55, 0x55,
-  0x2a, 0xaa, 0xa9, 0x55, 0x55, 0x45, 0x55, 0x55, 0x55, 0x45, 0xaa, 0xab,
-  0x56, 0xb4, 0xb5, 0x55, 0x5a, 0xad, 0x6a, 0xaa, 0x52, 0xaa, 0xd2, 0xa4,
-  0xa6, 0xad, 0x05, 0x4b, 0xea, 0xaa, 0xa5, 0xba, 0xeb, 0xaa, 0xad, 0x55,
-  0x55, 0x55, 0x55, 0x24, 0xaa, 0x94, 0xa5, 0x49, 0x25, 0x08, 0x0a, 0xa5,
-  0x24, 0xaa, 0x52, 0x94, 0xa4, 0x92, 0x45, 0x24, 0x29, 0x09, 0x25, 0x29,
-  0x4a, 0x89, 0x2c, 0x88, 0x2a, 0x44, 0xa8, 0x8a, 0x95, 0x2a, 0x49, 0x55,
-  0x4a, 0xa5, 0x4a, 0xaa, 0x9b, 0x6a, 0xaa, 0xaa, 0xda, 0xaa, 0xd6, 0xaa,
-  0xaa, 0x55, 0x52, 0xaa, 0x4a, 0xb5, 0x55, 0x5a, 0xb5, 0xab, 0x55, 0x75,
-  0x6e, 0xa5, 0x55, 0x55, 0xaa, 0xaa, 0x25, 0x52, 0x91, 0x25, 0x6a, 0xa4,
-  0xa5, 0xaa, 0xb5, 0x4a, 0xb5, 0x77, 0xd6, 0xd6, 0xab, 0x6a, 0xaa, 0xaa,
-  0xaa, 0x52, 0x55, 0x54, 0x95, 0x01, 0x51, 0x12, 0xaa, 0x49, 0x54, 0xa2,
-  0x92, 0x49, 0x29, 0x55, 0x4a, 0xa4, 0x94, 0x89, 0x48, 0xa4, 0xa4, 0xa6,
-  0xa5, 0x55, 0x25, 0x52, 0x49, 0x49, 0x55, 0x24, 0xa9, 0x2a, 0x55, 0x52,
-  0xca, 0xaa, 0xaa, 0xaa, 0xaa, 0xaa, 0x55, 0x55, 0x2a, 0xaa, 0xa9, 0x6a,
-  0xaa, 0x92, 0xaa, 0xaa, 0xaa, 0xaa, 0xf6, 0xad, 0x52, 0xad, 0xab, 0xd5,
-  0x6a, 0xa9, 0xb2, 0x52, 0xca, 0xaa, 0xa1, 0x6a, 0xb5, 0x65, 0x54, 0xbb,
-  0x55, 0x55, 0x75, 0x75, 0x55, 0x55, 0x4a, 0xaa, 0xa5, 0x55, 0x24, 0xaa,
-  0x45, 0xf0, 0x15, 0x54, 0x25, 0x55, 0x25, 0x2a, 0x44, 0x92, 0x44, 0x22,
-  0x24, 0x95, 0x52, 0xa4, 0xa5, 0x2a, 0x4a, 0x51, 0x15, 0x49, 0x54, 0xa9,
-  0x54, 0x94, 0x92, 0xaa, 0x4a, 0x92, 0xa4, 0xaa, 0x55, 0x55, 0x55, 0x5a,
-  0xad, 0x55, 0xa5, 0x54, 0xab, 0x52, 0xad, 0x56, 0xaa, 0xaa, 0xb5, 0x56,
-  0xad, 0xaa, 0x99, 0x55, 0x5e, 0xd6, 0xb4, 0xb5, 0x55, 0x52, 0xa9, 0x08,
-  0x2a, 0x55, 0x2a, 0xaa, 0xa9, 0x59, 0x55, 0x56, 0xb5, 0xb6, 0xab, 0xaa,
-  0xaa, 0xaa, 0xa9, 0x54, 0x95, 0x2a, 0xaa, 0xaa, 0x93, 0x55, 0x49, 0x4a,
-  0x52, 0x49, 0x52, 0xa9, 0x52, 0x92, 0x21, 0x2a, 0x92, 0x52, 0x4a, 0x54,
-  0x94, 0x91, 0x22, 0x95, 0x52, 0x55, 0x4a, 0x4a, 0x4a, 0x4a, 0x54, 0x92,
-  0xa9, 0x49, 0x55, 0x2b, 0x55, 0x55, 0x6a, 0xad, 0x55, 0x55, 0x55, 0x55,
-  0x55, 0x4a, 0xaa, 0xaa, 0xaa, 0xd4, 0x95, 0x5a, 0xaa, 0xaa, 0xd7, 0x76,
-  0xa3, 0x52, 0xaa, 0x95, 0x55, 0x5a, 0xaa, 0xeb, 0x49, 0x15, 0xaa, 0x55,
-  0x5a, 0xaa, 0x55, 0x55, 0x9a, 0xab, 0xba, 0xaa, 0xaa, 0xda, 0xaa, 0x95,
-  0x52, 0x92, 0xaa, 0xa4, 0x49, 0x5d, 0x0a, 0x52
-};
-unsigned int family_len = 20480;
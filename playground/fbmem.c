@@ -0,0 +1,53 @@
+#include <stdlib.h>
+
+#include "pico/stdlib.h"
+
+#include "fbmem.h"
+
+#if PLAYGROUND_FRAME_BUFFER_BANK
+// Defined by the linker script. Static frame buffers come first, followed by free space.
+extern uint8_t __frame_buffer_bank_start__[], __frame_buffers_end__[], __frame_buffer_bank_end__[];
+
+static uint8_t *bank_top = __frame_buffers_end__;
+#endif
+
+void *fbmem_alloc(size_t size) {
+#if PLAYGROUND_FRAME_BUFFER_BANK
+  size = (size + 3) & ~(size_t)3;
+  if (size <= fbmem_bank_free()) {
+    void *buffer = bank_top;
+    bank_top += size;
+    return buffer;
+  }
+#endif
+  return fbmem_alloc_shared(size);
+}
+
+void *fbmem_alloc_shared(size_t size) { return malloc(size); }
+
+void fbmem_free(void *buffer) {
+  if (fbmem_in_bank(buffer)) {
+#if PLAYGROUND_FRAME_BUFFER_BANK
+    bank_top = MAX(MIN(bank_top, (uint8_t *)buffer), __frame_buffers_end__);
+#endif
+  } else {
+    free(buffer);
+  }
+}
+
+bool fbmem_in_bank(const void *buffer) {
+#if PLAYGROUND_FRAME_BUFFER_BANK
+  return ((const uint8_t *)buffer >= __frame_buffer_bank_start__) &&
+         ((const uint8_t *)buffer < __frame_buffer_bank_end__);
+#else
+  return false;
+#endif
+}
+
+size_t fbmem_bank_free(void) {
+#if PLAYGROUND_FRAME_BUFFER_BANK
+  return __frame_buffer_bank_end__ - bank_top;
+#else
+  return 0;
+#endif
+}
@@ -0,0 +1,41 @@
+#pragma once
+
+#include <stddef.h>
+
+#include "pico/types.h"
+
+// Frame buffer memory.
+//
+// By default SRAM banks 0 to 3 are striped word by word, so a frame buffer on the heap shares every
+// bank with the processors' data and the scanout DMA has to contend with them. A program linked
+// with playground_reserve_frame_buffer_bank() (see CMakeLists.txt) instead uses the banks
+// unstriped and keeps the last 64K bank, SRAM3, for frame buffers alone. The processors then only
+// contend with scanout while they are drawing into the frame buffer itself.
+//
+// Frame buffers come from the reserved bank while it has room and from the heap otherwise.
+
+// Place a static frame buffer in the reserved bank, e.g.
+//
+//   static uint32_t buffer[N] FBMEM_SECTION;
+//
+// Such buffers are not zeroed at startup. Without a reserved bank they are ordinary statics.
+#if PLAYGROUND_FRAME_BUFFER_BANK
+#define FBMEM_SECTION __attribute__((section(".frame_buffers")))
+#else
+#define FBMEM_SECTION
+#endif
+
+// Allocate a word aligned frame buffer. Returns NULL if there is no memory.
+void *fbmem_alloc(size_t size);
+
+// Allocate a frame buffer from the heap even if the bank has room, e.g. for comparison.
+void *fbmem_alloc_shared(size_t size);
+
+// Free a frame buffer. Freeing one from the reserved bank also frees any allocated after it.
+void fbmem_free(void *buffer);
+
+// Returns true if the buffer is in the reserved bank.
+bool fbmem_in_bank(const void *buffer);
+
+// Bytes left in the reserved bank, 0 if there is none.
+size_t fbmem_bank_free(void);
@@ -0,0 +1,548 @@
+#include <stdlib.h>
+
+#include "pico/stdlib.h"
+
+#include "gfx.h"
+
+// Everything here is written for the Cortex-M0+. Shifts by a register are single cycle but there
+// is no barrel shifter on operands, so masks are built with explicit shifts rather than indexed
+// tables and words are combined whole. Raster operations are resolved outside of inner loops:
+// functions taking a gfx_rop_t are force-inlined into a switch with a constant operation so that
+// each case compiles to its own loop.
+
+// Pixel operations to which a colour and raster operation reduce when drawing single pixels.
+typedef enum {
+  GFX_PIXEL_NOP,
+  GFX_PIXEL_SET,
+  GFX_PIXEL_CLEAR,
+  GFX_PIXEL_INVERT,
+} gfx_pixel_op_t;
+
+void gfx_surface_init(gfx_surface_t *surface, void *buffer, uint width, uint height, uint stride,
+                      bool byte_oriented) {
+  surface->buffer = buffer;
+  surface->width = width;
+  surface->height = height;
+  surface->stride = stride;
+  surface->byte_oriented = byte_oriented;
+}
+
+// Convert a word between screen order and the surface's memory order.
+static inline uint32_t gfx_intl_order(const gfx_surface_t *surface, uint32_t v) {
+  return surface->byte_oriented ? __builtin_bswap32(v) : v;
+}
+
+static inline uint32_t *gfx_intl_row(const gfx_surface_t *surface, int y) {
+  return (uint32_t *)((uint8_t *)surface->buffer + y * surface->stride);
+}
+
+// Combine src into the pixels of *dest selected by mask.
+static __force_inline void gfx_intl_apply(uint32_t *dest, uint32_t src, uint32_t mask,
+                                          gfx_rop_t rop) {
+  switch (rop) {
+  case GFX_ROP_COPY:
+    *dest = (*dest & ~mask) | (src & mask);
+    break;
+  case GFX_ROP_OR:
+    *dest |= src & mask;
+    break;
+  case GFX_ROP_AND:
+    *dest &= src | ~mask;
+    break;
+  case GFX_ROP_XOR:
+    *dest ^= src & mask;
+    break;
+  }
+}
+
+static inline gfx_pixel_op_t gfx_intl_pixel_op(uint colour, gfx_rop_t rop) {
+  switch (rop) {
+  case GFX_ROP_COPY:
+    return colour ? GFX_PIXEL_SET : GFX_PIXEL_CLEAR;
+  case GFX_ROP_OR:
+    return colour ? GFX_PIXEL_SET : GFX_PIXEL_NOP;
+  case GFX_ROP_AND:
+    return colour ? GFX_PIXEL_NOP : GFX_PIXEL_CLEAR;
+  case GFX_ROP_XOR:
+    return colour ? GFX_PIXEL_INVERT : GFX_PIXEL_NOP;
+  }
+  return GFX_PIXEL_NOP;
+}
+
+// Single pixels are addressed as bytes. In a word-oriented surface the bytes of each word are
+// reversed, which is undone by XORing the byte index with 3.
+static inline uint gfx_intl_byte_xor(const gfx_surface_t *surface) {
+  return surface->byte_oriented ? 0 : 3;
+}
+
+static __force_inline void gfx_intl_pixel_apply(uint8_t *p, uint8_t mask, gfx_pixel_op_t op) {
+  switch (op) {
+  case GFX_PIXEL_SET:
+    *p |= mask;
+    break;
+  case GFX_PIXEL_CLEAR:
+    *p &= ~mask;
+    break;
+  case GFX_PIXEL_INVERT:
+    *p ^= mask;
+    break;
+  case GFX_PIXEL_NOP:
+    break;
+  }
+}
+
+static __force_inline void gfx_intl_span(uint32_t *row, int x0, int x1, uint32_t pattern,
+                                         uint32_t first_mask, uint32_t last_mask, gfx_rop_t rop) {
+  uint32_t *dest = row + (x0 >> 5);
+  uint32_t *last = row + ((x1 - 1) >> 5);
+  if (dest == last) {
+    gfx_intl_apply(dest, pattern, first_mask & last_mask, rop);
+    return;
+  }
+
+  gfx_intl_apply(dest++, pattern, first_mask, rop);
+  switch (rop) {
+  case GFX_ROP_COPY:
+    for (; dest < last; dest++) {
+      *dest = pattern;
+    }
+    break;
+  case GFX_ROP_OR:
+    for (; dest < last; dest++) {
+      *dest |= pattern;
+    }
+    break;
+  case GFX_ROP_AND:
+    for (; dest < last; dest++) {
+      *dest &= pattern;
+    }
+    break;
+  case GFX_ROP_XOR:
+    for (; dest < last; dest++) {
+      *dest ^= pattern;
+    }
+    break;
+  }
+  gfx_intl_apply(last, pattern, last_mask, rop);
+}
+
+// Fill rows y0 <= y < y1 between x0 and x1. The region must already be clipped.
+static void gfx_intl_fill(const gfx_surface_t *surface, int x0, int x1, int y0, int y1,
+                          uint32_t pattern, gfx_rop_t rop) {
+  uint32_t first_mask = gfx_intl_order(surface, 0xFFFFFFFFu >> (x0 & 0x1f));
+  uint32_t last_mask = gfx_intl_order(surface, 0xFFFFFFFFu << (31 - ((x1 - 1) & 0x1f)));
+  pattern = gfx_intl_order(surface, pattern);
+  uint32_t *row = gfx_intl_row(surface, y0);
+  uint stride = surface->stride >> 2;
+
+  switch (rop) {
+  case GFX_ROP_COPY:
+    for (int y = y0; y < y1; y++, row += stride) {
+      gfx_intl_span(row, x0, x1, pattern, first_mask, last_mask, GFX_ROP_COPY);
+    }
+    break;
+  case GFX_ROP_OR:
+    for (int y = y0; y < y1; y++, row += stride) {
+      gfx_intl_span(row, x0, x1, pattern, first_mask, last_mask, GFX_ROP_OR);
+    }
+    break;
+  case GFX_ROP_AND:
+    for (int y = y0; y < y1; y++, row += stride) {
+      gfx_intl_span(row, x0, x1, pattern, first_mask, last_mask, GFX_ROP_AND);
+    }
+    break;
+  case GFX_ROP_XOR:
+    for (int y = y0; y < y1; y++, row += stride) {
+      gfx_intl_span(row, x0, x1, pattern, first_mask, last_mask, GFX_ROP_XOR);
+    }
+    break;
+  }
+}
+
+void gfx_span(const gfx_surface_t *surface, int x0, int x1, int y, uint32_t pattern,
+              gfx_rop_t rop) {
+  if ((y < 0) || (y >= (int)surface->height)) {
+    return;
+  }
+  x0 = MAX(x0, 0);
+  x1 = MIN(x1, (int)surface->width);
+  if (x0 >= x1) {
+    return;
+  }
+  gfx_intl_fill(surface, x0, x1, y, y + 1, pattern, rop);
+}
+
+void gfx_fill_rect(const gfx_surface_t *surface, int x, int y, int w, int h, uint32_t pattern,
+                   gfx_rop_t rop) {
+  int x0 = MAX(x, 0), x1 = MIN(x + w, (int)surface->width);
+  int y0 = MAX(y, 0), y1 = MIN(y + h, (int)surface->height);
+  if ((x0 >= x1) || (y0 >= y1)) {
+    return;
+  }
+  gfx_intl_fill(surface, x0, x1, y0, y1, pattern, rop);
+}
+
+void gfx_pixel(const gfx_surface_t *surface, int x, int y, uint colour, gfx_rop_t rop) {
+  if (((uint)x >= surface->width) || ((uint)y >= surface->height)) {
+    return;
+  }
+  uint8_t *p = (uint8_t *)gfx_intl_row(surface, y) + ((x >> 3) ^ gfx_intl_byte_xor(surface));
+  gfx_intl_pixel_apply(p, 0x80 >> (x & 0x7), gfx_intl_pixel_op(colour, rop));
+}
+
+// Largest magnitude of a coordinate of a clipped line. End points further out are clamped to it,
+// which bends such lines slightly, so that clipping needs only 32-bit arithmetic: every product
+// below is at most d * d, which is under 2^32.
+#define GFX_LINE_LIMIT 0x7fff
+
+// A line as Bresenham's algorithm draws it, stepping one pixel along the major axis of length d
+// each step and one along the minor axis, of length dm, whenever the error term, which starts at
+// d / 2, goes negative. After n steps the minor axis has moved k(n) = (n * dm - d / 2 + d - 1) / d
+// pixels, rounded down, and the error term is d / 2 - n * dm + k(n) * d.
+typedef struct {
+  int x, y;     // First pixel drawn
+  int sx, sy;   // Direction of each axis, 1 or -1
+  int dx, dy;   // Lengths of the whole line along each axis
+  int err;      // Error term at the first pixel drawn
+  int count;    // Pixels drawn
+} gfx_line_state_t;
+
+// Narrow the steps first to last of a line to those at which one of its coordinates, c0 at step 0
+// moving in direction s, is between lo and hi. The coordinate moves a pixel a step along the major
+// axis, or k(n) pixels after n steps along the minor one. Returns false if no step is left.
+static bool gfx_intl_clip_steps(int c0, int s, int lo, int hi, bool major, uint32_t d, uint32_t dm,
+                                uint32_t *first, uint32_t *last) {
+  // Range of the coordinate's distance from c0, which can be no more than the axis' length.
+  int near = (s > 0) ? lo - c0 : c0 - hi;
+  int far = (s > 0) ? hi - c0 : c0 - lo;
+  uint32_t length = major ? d : dm;
+  if ((far < 0) || ((near > 0) && ((uint32_t)near > length))) {
+    return false;
+  }
+  uint32_t from = MAX(near, 0), to = MIN((uint32_t)far, length);
+  if (major) {
+    *first = MAX(*first, from);
+    *last = MIN(*last, to);
+  } else if (dm != 0) {
+    // k(n) >= from and k(n) <= to, solved for n.
+    uint32_t h = d >> 1;
+    if (from > 0) {
+      *first = MAX(*first, ((from * d) - d + h + dm) / dm);
+    }
+    *last = MIN(*last, ((to * d) + h) / dm);
+  }
+  return *first <= *last;
+}
+
+static inline int gfx_intl_clamp_coordinate(int c) {
+  return MIN(MAX(c, -GFX_LINE_LIMIT), GFX_LINE_LIMIT);
+}
+
+// Clip a line to the surface in Bresenham's step space, so that the pixels drawn are exactly those
+// of the whole line which are on the surface. Returns false if none are.
+static bool gfx_intl_clip_line(const gfx_surface_t *surface, int x0, int y0, int x1, int y1,
+                               gfx_line_state_t *line) {
+  bool inside = ((uint)x0 < surface->width) && ((uint)y0 < surface->height) &&
+                ((uint)x1 < surface->width) && ((uint)y1 < surface->height);
+  if (!inside) {
+    x0 = gfx_intl_clamp_coordinate(x0);
+    y0 = gfx_intl_clamp_coordinate(y0);
+    x1 = gfx_intl_clamp_coordinate(x1);
+    y1 = gfx_intl_clamp_coordinate(y1);
+  }
+  line->dx = abs(x1 - x0);
+  line->dy = abs(y1 - y0);
+  line->sx = (x0 < x1) ? 1 : -1;
+  line->sy = (y0 < y1) ? 1 : -1;
+  bool x_major = line->dx >= line->dy;
+  uint32_t d = x_major ? line->dx : line->dy, dm = x_major ? line->dy : line->dx;
+  uint32_t h = d >> 1;
+
+  // Lines wholly on the surface, the common case, are drawn from end to end without dividing.
+  if (inside) {
+    line->x = x0;
+    line->y = y0;
+    line->err = h;
+    line->count = d + 1;
+    return true;
+  }
+
+  uint32_t first = 0, last = d;
+  if (!gfx_intl_clip_steps(x0, line->sx, 0, surface->width - 1, x_major, d, dm, &first, &last) ||
+      !gfx_intl_clip_steps(y0, line->sy, 0, surface->height - 1, !x_major, d, dm, &first,
+                           &last)) {
+    return false;
+  }
+
+  uint32_t k = (d != 0) ? ((first * dm) + d - 1 - h) / d : 0;
+  line->x = x0 + line->sx * (int)(x_major ? first : k);
+  line->y = y0 + line->sy * (int)(x_major ? k : first);
+  line->err = (int)(h + (k * d) - (first * dm));
+  line->count = (int)(last - first + 1);
+  return true;
+}
+
+// Bresenham's algorithm stepping one pixel along the major axis each iteration. The row pointer
+// is stepped rather than recomputed.
+static __force_inline void gfx_intl_line(const gfx_surface_t *surface,
+                                         const gfx_line_state_t *line, gfx_pixel_op_t op) {
+  int dx = line->dx, dy = line->dy, sx = line->sx, err = line->err;
+  int row_step = line->sy * (int)surface->stride;
+  uint byte_xor = gfx_intl_byte_xor(surface);
+  uint8_t *row = (uint8_t *)gfx_intl_row(surface, line->y);
+  int x = line->x;
+
+  if (dx >= dy) {
+    for (int n = line->count; n > 0; n--) {
+      gfx_intl_pixel_apply(row + ((x >> 3) ^ byte_xor), 0x80 >> (x & 0x7), op);
+      x += sx;
+      err -= dy;
+      if (err < 0) {
+        err += dx;
+        row += row_step;
+      }
+    }
+  } else {
+    for (int n = line->count; n > 0; n--) {
+      gfx_intl_pixel_apply(row + ((x >> 3) ^ byte_xor), 0x80 >> (x & 0x7), op);
+      row += row_step;
+      err -= dx;
+      if (err < 0) {
+        err += dy;
+        x += sx;
+      }
+    }
+  }
+}
+
+void gfx_line(const gfx_surface_t *surface, int x0, int y0, int x1, int y1, uint colour,
+              gfx_rop_t rop) {
+  if (y0 == y1) {
+    gfx_span(surface, MIN(x0, x1), MAX(x0, x1) + 1, y0, colour ? GFX_PATTERN_WHITE : 0, rop);
+    return;
+  }
+  gfx_line_state_t line;
+  if (!gfx_intl_clip_line(surface, x0, y0, x1, y1, &line)) {
+    return;
+  }
+
+  switch (gfx_intl_pixel_op(colour, rop)) {
+  case GFX_PIXEL_SET:
+    gfx_intl_line(surface, &line, GFX_PIXEL_SET);
+    break;
+  case GFX_PIXEL_CLEAR:
+    gfx_intl_line(surface, &line, GFX_PIXEL_CLEAR);
+    break;
+  case GFX_PIXEL_INVERT:
+    gfx_intl_line(surface, &line, GFX_PIXEL_INVERT);
+    break;
+  case GFX_PIXEL_NOP:
+    break;
+  }
+}
+
+void gfx_rect(const gfx_surface_t *surface, int x, int y, int w, int h, uint colour,
+              gfx_rop_t rop) {
+  if ((w <= 0) || (h <= 0)) {
+    return;
+  }
+  uint32_t pattern = colour ? GFX_PATTERN_WHITE : GFX_PATTERN_BLACK;
+  gfx_span(surface, x, x + w, y, pattern, rop);
+  if (h > 1) {
+    gfx_span(surface, x, x + w, y + h - 1, pattern, rop);
+  }
+  if (h > 2) {
+    gfx_fill_rect(surface, x, y + 1, 1, h - 2, pattern, rop);
+    if (w > 1) {
+      gfx_fill_rect(surface, x + w - 1, y + 1, 1, h - 2, pattern, rop);
+    }
+  }
+}
+
+// Plot the points of a circle symmetric with (x, y), each exactly once.
+static __force_inline void gfx_intl_circle_points(const gfx_surface_t *surface, int cx, int cy,
+                                                  int x, int y, gfx_pixel_op_t op) {
+  int points[8][2] = {
+      {cx + x, cy + y}, {cx - x, cy + y}, {cx + x, cy - y}, {cx - x, cy - y},
+      {cx + y, cy + x}, {cx - y, cy + x}, {cx + y, cy - x}, {cx - y, cy - x},
+  };
+  // On the axes and the diagonals the reflections coincide.
+  uint count = ((x == 0) || (x == y)) ? 4 : 8;
+  static const uint8_t axis_points[4] = {0, 2, 4, 5};
+  uint byte_xor = gfx_intl_byte_xor(surface);
+  for (uint i = 0; i < count; i++) {
+    const int *p = points[(x == 0) ? axis_points[i] : i];
+    if (((uint)p[0] < surface->width) && ((uint)p[1] < surface->height)) {
+      uint8_t *row = (uint8_t *)gfx_intl_row(surface, p[1]);
+      gfx_intl_pixel_apply(row + ((p[0] >> 3) ^ byte_xor), 0x80 >> (p[0] & 0x7), op);
+    }
+  }
+}
+
+// Midpoint circle algorithm over the octant from the top to the diagonal.
+static __force_inline void gfx_intl_circle(const gfx_surface_t *surface, int cx, int cy, int r,
+                                           gfx_pixel_op_t op) {
+  int x = 0, y = r, d = 1 - r;
+  while (x <= y) {
+    gfx_intl_circle_points(surface, cx, cy, x, y, op);
+    x++;
+    if (d < 0) {
+      d += 2 * x + 1;
+    } else {
+      y--;
+      d += 2 * (x - y) + 1;
+    }
+  }
+}
+
+void gfx_circle(const gfx_surface_t *surface, int cx, int cy, int r, uint colour, gfx_rop_t rop) {
+  if (r < 0) {
+    return;
+  }
+  if (r == 0) {
+    gfx_pixel(surface, cx, cy, colour, rop);
+    return;
+  }
+
+  switch (gfx_intl_pixel_op(colour, rop)) {
+  case GFX_PIXEL_SET:
+    gfx_intl_circle(surface, cx, cy, r, GFX_PIXEL_SET);
+    break;
+  case GFX_PIXEL_CLEAR:
+    gfx_intl_circle(surface, cx, cy, r, GFX_PIXEL_CLEAR);
+    break;
+  case GFX_PIXEL_INVERT:
+    gfx_intl_circle(surface, cx, cy, r, GFX_PIXEL_INVERT);
+    break;
+  case GFX_PIXEL_NOP:
+    break;
+  }
+}
+
+void gfx_fill_circle(const gfx_surface_t *surface, int cx, int cy, int r, uint32_t pattern,
+                     gfx_rop_t rop) {
+  if (r < 0) {
+    return;
+  }
+
+  // Walk down from the middle row keeping the half-width w as the widest for which
+  // w^2 + dy^2 <= r^2 + r. Each row is drawn once.
+  int w = r, limit = r * r + r;
+  for (int dy = 0; dy <= r; dy++) {
+    while (w * w + dy * dy > limit) {
+      w--;
+    }
+    gfx_span(surface, cx - w, cx + w + 1, cy + dy, pattern, rop);
+    if (dy != 0) {
+      gfx_span(surface, cx - w, cx + w + 1, cy - dy, pattern, rop);
+    }
+  }
+}
+
+// Fetch word i of a source row in screen order. Words outside the row read as zero.
+static inline uint32_t gfx_intl_fetch(const gfx_surface_t *src, const uint32_t *row, int i) {
+  return ((uint)i < (src->stride >> 2)) ? gfx_intl_order(src, row[i]) : 0;
+}
+
+// Blit one row. Each destination word is assembled from the two source words it overlaps, shifted
+// by the difference in alignment between source and destination. A destination word at pixel X
+// takes source pixels from X + offset where offset = sx - dx. Rows are walked right-to-left when
+// reverse is set so that a blit to the right within a single buffer reads each source word before
+// overwriting it.
+static __force_inline void gfx_intl_blit_row(const gfx_surface_t *dest, uint32_t *dest_row,
+                                             const gfx_surface_t *src, const uint32_t *src_row,
+                                             int dx, int sx, int w, bool reverse, gfx_rop_t rop) {
+  int k0 = dx >> 5, k1 = (dx + w - 1) >> 5;
+  int a = sx - (dx & 0x1f); // Source pixel aligned with the start of word k0
+  int i = a >> 5;           // Arithmetic shift so that a negative position rounds down
+  uint shift = a & 0x1f;
+  uint32_t first_mask = 0xFFFFFFFFu >> (dx & 0x1f);
+  uint32_t last_mask = 0xFFFFFFFFu << (31 - ((dx + w - 1) & 0x1f));
+
+  if (!reverse) {
+    uint32_t cur = gfx_intl_fetch(src, src_row, i), mask = first_mask;
+    for (int k = k0;; k++, i++) {
+      uint32_t next = gfx_intl_fetch(src, src_row, i + 1);
+      uint32_t bits = shift ? (cur << shift) | (next >> (32 - shift)) : cur;
+      cur = next;
+      if (k == k1) {
+        mask &= last_mask;
+      }
+      gfx_intl_apply(dest_row + k, gfx_intl_order(dest, bits), gfx_intl_order(dest, mask), rop);
+      if (k == k1) {
+        break;
+      }
+      mask = 0xFFFFFFFFu;
+    }
+  } else {
+    i += k1 - k0;
+    uint32_t next = gfx_intl_fetch(src, src_row, i + 1), mask = last_mask;
+    for (int k = k1;; k--, i--) {
+      uint32_t cur = gfx_intl_fetch(src, src_row, i);
+      uint32_t bits = shift ? (cur << shift) | (next >> (32 - shift)) : cur;
+      next = cur;
+      if (k == k0) {
+        mask &= first_mask;
+      }
+      gfx_intl_apply(dest_row + k, gfx_intl_order(dest, bits), gfx_intl_order(dest, mask), rop);
+      if (k == k0) {
+        break;
+      }
+      mask = 0xFFFFFFFFu;
+    }
+  }
+}
+
+static __force_inline void gfx_intl_blit(const gfx_surface_t *dest, int dx, int dy,
+                                         const gfx_surface_t *src, int sx, int sy, int w, int h,
+                                         gfx_rop_t rop) {
+  // Walk rows bottom-up when blitting downwards within a buffer and right-to-left when blitting to
+  // the right within a row so that no source pixel is overwritten before it is read.
+  bool same = dest->buffer == src->buffer;
+  bool bottom_up = same && (dy > sy);
+  bool reverse = same && (dy == sy) && (dx > sx);
+  int step = bottom_up ? -1 : 1;
+  int y0 = bottom_up ? h - 1 : 0;
+
+  for (int n = 0, y = y0; n < h; n++, y += step) {
+    gfx_intl_blit_row(dest, gfx_intl_row(dest, dy + y), src, gfx_intl_row(src, sy + y), dx, sx, w,
+                      reverse, rop);
+  }
+}
+
+void gfx_blit(const gfx_surface_t *dest, int dx, int dy, const gfx_surface_t *src, int sx, int sy,
+              int w, int h, gfx_rop_t rop) {
+  // Clip against both surfaces, moving the other rectangle's origin to match.
+  if (sx < 0) {
+    w += sx, dx -= sx, sx = 0;
+  }
+  if (sy < 0) {
+    h += sy, dy -= sy, sy = 0;
+  }
+  if (dx < 0) {
+    w += dx, sx -= dx, dx = 0;
+  }
+  if (dy < 0) {
+    h += dy, sy -= dy, dy = 0;
+  }
+  w = MIN(w, MIN((int)src->width - sx, (int)dest->width - dx));
+  h = MIN(h, MIN((int)src->height - sy, (int)dest->height - dy));
+  if ((w <= 0) || (h <= 0)) {
+    return;
+  }
+
+  switch (rop) {
+  case GFX_ROP_COPY:
+    gfx_intl_blit(dest, dx, dy, src, sx, sy, w, h, GFX_ROP_COPY);
+    break;
+  case GFX_ROP_OR:
+    gfx_intl_blit(dest, dx, dy, src, sx, sy, w, h, GFX_ROP_OR);
+    break;
+  case GFX_ROP_AND:
+    gfx_intl_blit(dest, dx, dy, src, sx, sy, w, h, GFX_ROP_AND);
+    break;
+  case GFX_ROP_XOR:
+    gfx_intl_blit(dest, dx, dy, src, sx, sy, w, h, GFX_ROP_XOR);
+    break;
+  }
+}
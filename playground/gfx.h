@@ -0,0 +1,60 @@
+#pragma once
+
+#include "pico/types.h"
+
+// 1bpp drawing into frame buffers in either of the formats accepted by tvout_init(). Set pixels
+// are white. All primitives clip to the surface.
+//
+// Patterns are 32-bit words in screen order, i.e. the MSB is the left-most pixel. A pattern is
+// aligned to the surface's 32 pixel columns so that pixel x of a span takes bit 31 - (x & 31).
+
+// Raster operation combining source pixels with the destination.
+typedef enum {
+  GFX_ROP_COPY, // dest = src
+  GFX_ROP_OR,   // dest = dest | src
+  GFX_ROP_AND,  // dest = dest & src
+  GFX_ROP_XOR,  // dest = dest ^ src
+} gfx_rop_t;
+
+#define GFX_PATTERN_BLACK 0x00000000u
+#define GFX_PATTERN_WHITE 0xFFFFFFFFu
+#define GFX_PATTERN_GREY 0xAAAAAAAAu
+
+typedef struct {
+  void *buffer;       // Word aligned
+  uint width, height; // Size in pixels
+  uint stride;        // Bytes between rows. Must be a multiple of four.
+  bool byte_oriented; // As for tvout_init()
+} gfx_surface_t;
+
+void gfx_surface_init(gfx_surface_t *surface, void *buffer, uint width, uint height, uint stride,
+                      bool byte_oriented);
+
+// Fill pixels x0 <= x < x1 of row y from a pattern.
+void gfx_span(const gfx_surface_t *surface, int x0, int x1, int y, uint32_t pattern,
+              gfx_rop_t rop);
+
+// Draw a single pixel with colour 0 (black) or 1 (white).
+void gfx_pixel(const gfx_surface_t *surface, int x, int y, uint colour, gfx_rop_t rop);
+
+// Draw a line including both end points.
+void gfx_line(const gfx_surface_t *surface, int x0, int y0, int x1, int y1, uint colour,
+              gfx_rop_t rop);
+
+// Draw the outline of a rectangle. Each pixel is drawn once so XOR may be used.
+void gfx_rect(const gfx_surface_t *surface, int x, int y, int w, int h, uint colour, gfx_rop_t rop);
+
+void gfx_fill_rect(const gfx_surface_t *surface, int x, int y, int w, int h, uint32_t pattern,
+                   gfx_rop_t rop);
+
+// Draw the outline of a circle. Each pixel is drawn once so XOR may be used.
+void gfx_circle(const gfx_surface_t *surface, int cx, int cy, int r, uint colour, gfx_rop_t rop);
+
+void gfx_fill_circle(const gfx_surface_t *surface, int cx, int cy, int r, uint32_t pattern,
+                     gfx_rop_t rop);
+
+// Combine the w x h pixel region of src at (sx, sy) into dest at (dx, dy). The surfaces may differ
+// in orientation. They may also share a buffer, e.g. to scroll, in which case the regions may
+// overlap.
+void gfx_blit(const gfx_surface_t *dest, int dx, int dy, const gfx_surface_t *src, int sx, int sy,
+              int w, int h, gfx_rop_t rop);
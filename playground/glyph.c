@@ -0,0 +1,97 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+#include "glyph.h"
+#include "hotpath.h"
+
+// Number of decoded glyphs kept in RAM. Must be a power of two.
+#define GLYPH_CACHE_SIZE 64
+#define GLYPH_CACHE_SHIFT 26 // 32 - log2(GLYPH_CACHE_SIZE)
+
+typedef struct {
+  const font_t *font; // NULL for an unused entry
+  uint32_t codepoint;
+  uint8_t rows[FONT_MAX_HEIGHT];
+} glyph_cache_entry_t;
+
+static glyph_cache_entry_t glyph_cache[GLYPH_CACHE_SIZE];
+
+// Map a code point to a compressed glyph index. Returns -1 if the font has no glyph for it.
+static int glyph_index(const font_t *font, uint32_t codepoint) {
+  uint lo = 0, hi = font->ext_range_count;
+  while (lo < hi) {
+    uint mid = (lo + hi) >> 1;
+    const font_range_t *range = &font->ext_ranges[mid];
+    if (codepoint < range->first) {
+      hi = mid;
+    } else if (codepoint >= range->first + range->count) {
+      lo = mid + 1;
+    } else {
+      return range->glyph + (codepoint - range->first);
+    }
+  }
+  return -1;
+}
+
+// Decode a compressed glyph. Each glyph is a row mask with bit n set if row n differs from the row
+// above followed by the differing rows. The mask is one byte for fonts up to eight rows high and
+// two, little-endian, for taller ones. Blocks of eight glyphs start at the offsets in
+// font->ext_block_offsets[].
+static void glyph_decode(const font_t *font, uint glyph, uint8_t *rows) {
+  const uint8_t *src = font->ext_data + font->ext_block_offsets[glyph >> 3];
+  bool wide_mask = font->height > 8;
+  for (uint i = glyph & 0x7; i > 0; i--) {
+    uint mask = wide_mask ? (src[0] | (src[1] << 8)) : src[0];
+    src += (wide_mask ? 2 : 1) + __builtin_popcount(mask);
+  }
+
+  uint mask = *src++;
+  if (wide_mask) {
+    mask |= *src++ << 8;
+  }
+  uint8_t row = 0;
+  for (uint i = 0; i < font->height; i++, mask >>= 1) {
+    if (mask & 0x1) {
+      row = *src++;
+    }
+    rows[i] = row;
+  }
+}
+
+const uint8_t *HOTPATH_FUNC(glyph_get)(const font_t *font, uint32_t codepoint) {
+  if ((codepoint >= FONT_ASCII_FIRST) && (codepoint <= FONT_ASCII_LAST)) {
+    return font_ascii_rows(font, codepoint);
+  }
+
+  // Fibonacci hashing spreads the box drawing block, which differs mostly in the low bits, evenly
+  // over the cache.
+  glyph_cache_entry_t *entry = &glyph_cache[(codepoint * 0x9E3779B1u) >> GLYPH_CACHE_SHIFT];
+  if ((entry->font == font) && (entry->codepoint == codepoint)) {
+    return entry->rows;
+  }
+
+  int glyph = glyph_index(font, codepoint);
+  if (glyph < 0) {
+    glyph = glyph_index(font, GLYPH_REPLACEMENT_CHARACTER);
+    if (glyph < 0) {
+      return font_ascii_rows(font, '?');
+    }
+  }
+  glyph_decode(font, glyph, entry->rows);
+  entry->font = font;
+  entry->codepoint = codepoint;
+  return entry->rows;
+}
+
+const font_t *glyph_copy_font_to_ram(const font_t *font) {
+  size_t size = FONT_ASCII_COUNT * font->height;
+  font_t *copy = malloc(sizeof(font_t) + size);
+  if (copy == NULL) {
+    return font;
+  }
+  *copy = *font;
+  copy->ascii = memcpy(copy + 1, font->ascii, size);
+  return copy;
+}
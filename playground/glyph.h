@@ -0,0 +1,23 @@
+#pragma once
+
+#include "pico/types.h"
+
+#include "font.h"
+
+// Glyph lookup by code point. ASCII glyphs are returned straight from the font's table. Everything
+// else is stored compressed in flash (see tools/fontc.py) and decoded on demand into a small RAM
+// cache shared by all fonts.
+
+// Code point drawn in place of undecodable input or characters with no glyph.
+#define GLYPH_REPLACEMENT_CHARACTER 0xFFFD
+
+// Return the font->height rows of the glyph for a code point. If the font has no glyph for it then
+// the replacement character is returned or, failing that, '?'. The font must use
+// FONT_LAYOUT_ROWS. The pointer may be into the glyph cache and is only valid until the next call.
+const uint8_t *glyph_get(const font_t *font, uint32_t codepoint);
+
+// Return a copy of a font with its ASCII table in RAM, so that drawing text never waits on the XIP
+// cache. Glyphs beyond ASCII stay in flash as they are decoded into the RAM cache anyway. The copy
+// is allocated on the heap and never freed. If there is not enough memory the font itself is
+// returned.
+const font_t *glyph_copy_font_to_ram(const font_t *font);
@@ -0,0 +1,23 @@
+#pragma once
+
+#include "pico/platform.h"
+
+// Placement of code on the video and text hot paths. By default it runs from SRAM so that an XIP
+// cache miss never stretches the video interrupt or the console's inner loops.
+//
+// HOTPATH_ISR() puts the field timing interrupt handler, and the vblank work it calls, in SRAM4
+// (scratch X). The bank is otherwise only used by core 1's stack and so the handler's instruction
+// fetches do not contend with drawing or scanout. HOTPATH_FUNC() puts a function in the SDK's
+// .time_critical section in main SRAM.
+//
+// Define PLAYGROUND_HOT_IN_FLASH to leave everything in flash, e.g. to measure the difference with
+// playground_bench_xip.
+#if PLAYGROUND_HOT_IN_FLASH
+#define HOTPATH_ISR(name) name
+#define HOTPATH_FUNC(name) name
+#define HOTPATH_MEMORY "flash"
+#else
+#define HOTPATH_ISR(name) __scratch_x(#name) name
+#define HOTPATH_FUNC(name) __not_in_flash_func(name)
+#define HOTPATH_MEMORY "SRAM"
+#endif
@@ -0,0 +1,61 @@
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+#include "image.h"
+
+void image_reader_init(image_reader_t *reader, const image_t *image) {
+  reader->image = image;
+  reader->offset = 0;
+  reader->row = 0;
+  delta_decoder_init(&reader->decoder, NULL, 0);
+}
+
+bool image_read_row(image_reader_t *reader, uint8_t *dest) {
+  const image_t *image = reader->image;
+  if (reader->row >= image->height) {
+    return false;
+  }
+
+  if (!image->compressed) {
+    memcpy(dest, image->data + reader->row * image->stride, image->stride);
+  } else {
+    // The delta is against a cleared frame. Runs may continue from one row into the next.
+    memset(dest, 0x00, image->stride);
+    delta_decoder_set_dest(&reader->decoder, dest, image->stride);
+    reader->offset += delta_decode(&reader->decoder, image->data + reader->offset,
+                                   image->size - reader->offset);
+    if ((reader->row == image->height - 1) &&
+        ((reader->offset != image->size) || !delta_decoder_idle(&reader->decoder))) {
+      // The data runs past the end of the image.
+      return false;
+    }
+  }
+  reader->row++;
+  return true;
+}
+
+bool image_decode(const image_t *image, void *dest, uint dest_stride) {
+  if (dest_stride == image->stride) {
+    // Fast path. Copy or decode the whole image in one go.
+    size_t size = image->stride * image->height;
+    if (!image->compressed) {
+      memcpy(dest, image->data, size);
+      return true;
+    }
+    delta_decoder_t decoder;
+    memset(dest, 0x00, size);
+    delta_decoder_init(&decoder, dest, size);
+    return (delta_decode(&decoder, image->data, image->size) == image->size) &&
+           delta_decoder_idle(&decoder);
+  }
+
+  image_reader_t reader;
+  image_reader_init(&reader, image);
+  for (uint8_t *row = dest; reader.row < image->height; row += dest_stride) {
+    if (!image_read_row(&reader, row)) {
+      return false;
+    }
+  }
+  return true;
+}
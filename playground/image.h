@@ -0,0 +1,43 @@
+#pragma once
+
+#include "pico/types.h"
+
+#include "delta.h"
+
+// 1bpp images compiled into flash by tools/imgc.py (see playground_add_image() in CMakeLists.txt).
+// Rows are padded to a multiple of four bytes and are in the frame buffer format chosen when the
+// image was compiled, byte or word oriented, so that an uncompressed image is ready to be scanned
+// out or blitted in place. A compressed image is a delta (see delta.h) against a cleared frame.
+
+typedef struct {
+  uint16_t width, height; // Size in pixels
+  uint16_t stride;        // Bytes between rows
+  bool byte_oriented;     // As for tvout_init()
+  bool compressed;
+  const uint8_t *data; // Word aligned
+  uint32_t size;       // Size of data in bytes
+} image_t;
+
+// Return the pixels of an uncompressed image, e.g. to pass to tvout_set_frame_buffer(), or NULL if
+// the image is compressed.
+static inline const void *image_pixels(const image_t *image) {
+  return image->compressed ? NULL : image->data;
+}
+
+// Draw the whole image into a buffer with the passed stride, which must be at least the image's.
+// Returns false if the compressed data is malformed.
+bool image_decode(const image_t *image, void *dest, uint dest_stride);
+
+// Reader decoding an image a row at a time, e.g. into a line buffer.
+typedef struct {
+  const image_t *image;
+  uint32_t offset; // Offset of the next byte of data
+  uint row;        // Next row
+  delta_decoder_t decoder;
+} image_reader_t;
+
+void image_reader_init(image_reader_t *reader, const image_t *image);
+
+// Decode the next row into image->stride bytes at dest. Returns false after the last row or if the
+// compressed data is malformed.
+bool image_read_row(image_reader_t *reader, uint8_t *dest);
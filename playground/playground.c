@@ -6,142 +6,171 @@
 #include "hardware/uart.h"
 #include "pico/stdlib.h"
 
-#include "font.h"
-#include "tvout.h"
-
+#include "console.h"
 #include "family.h"
+#include "fbmem.h"
+#include "font_8x8.h"
+#include "gfx.h"
+#include "glyph.h"
+#include "remote.h"
+#include "tvout.h"
 
 #define GPIO_SYNC_PIN 16
 #define GPIO_VIDEO_PIN 17
 
+#ifndef PLAYGROUND_VIDEO_MODE
+#define PLAYGROUND_VIDEO_MODE TVOUT_MODE_640X256
+#endif
+
 uint8_t *frame_buffer;
 uint width, height, stride;
+gfx_surface_t screen;
 
-uint cursor_row, cursor_col;
-bool cursor_shown;
+#if PLAYGROUND_TEXT_LAYER
+// Pixel rows of the console's layer below the screen, which bound how far its smooth scrolling may
+// fall behind the text.
+#define TEXT_SPARE_ROWS 32
 
-#define console_rows() (height >> 3)
-#define console_cols() (width >> 3)
+static uint text_rows;
 
-void console_reset(void);
-void console_putc(char c);
-void console_line_feed(void);
-void console_carriage_return(void);
-void console_refresh(void);
+static void text_origin(uint row) { tvout_set_layer_origin(row, text_rows); }
+#endif
 
-void console_intl_toggle_cursor(void);
+// Number of bytes of REMOTE_ENTRY_SEQUENCE matched so far in text mode. These are held back from
+// the console until the sequence either completes or fails to match.
+static uint entry_matched;
 
-void console_reset(void) {
-  cursor_row = cursor_col = 0;
-  cursor_shown = false;
-}
-
-void console_intl_toggle_cursor(void) {
-  uint8_t *dest = frame_buffer + cursor_col + (6 + (cursor_row << 3)) * stride;
-  for (int i = 0; i < 2; i++, dest += stride) {
-    *dest ^= 0xFF;
+// Write text to the console and echo it.
+static void text_write(const char *s, size_t n) {
+  console_write(s, n);
+  for (size_t i = 0; i < n; i++) {
+    uart_putc(uart0, s[i]);
   }
 }
 
-void console_putc(char c) {
-  bool cursor_was_shown = cursor_shown;
-  if (cursor_was_shown) {
-    console_intl_toggle_cursor();
-    cursor_shown = false;
-  }
-
-  if ((c >= 32) && (c < 127)) {
-    uint8_t *char_rows = font + ((c - 32) << 3);
-    uint8_t *dest = frame_buffer + cursor_col + (cursor_row << 3) * stride;
-    for (int i = 0; i < 8; i++, char_rows++, dest += stride) {
-      *dest = *char_rows;
-    }
-
-    cursor_col += 1;
-    if (cursor_col >= console_cols()) {
-      console_carriage_return();
-      console_line_feed();
+// Length of the longest proper prefix of entry which is also a suffix of its first matched bytes,
+// as in Knuth-Morris-Pratt: how much of a partial match may still be the start of the sequence.
+static uint entry_fallback(const char *entry, uint matched) {
+  for (uint k = matched - 1; k > 0; k--) {
+    if (memcmp(entry, entry + matched - k, k) == 0) {
+      return k;
     }
-  } else if (c == 0x0A) {
-    console_line_feed();
-  } else if (c == 0x0D) {
-    console_carriage_return();
-  }
-
-  if (cursor_was_shown) {
-    console_intl_toggle_cursor();
-    cursor_shown = true;
-  }
-}
-
-void console_carriage_return(void) {
-  bool cursor_was_shown = cursor_shown;
-  if (cursor_was_shown) {
-    console_intl_toggle_cursor();
-    cursor_shown = false;
-  }
-
-  cursor_col = 0;
-
-  if (cursor_was_shown) {
-    console_intl_toggle_cursor();
-    cursor_shown = true;
   }
+  return 0;
 }
 
-void console_line_feed(void) {
-  bool cursor_was_shown = cursor_shown;
-  if (cursor_was_shown) {
-    console_intl_toggle_cursor();
-    cursor_shown = false;
-  }
-
-  cursor_row += 1;
-  while (cursor_row >= console_rows()) {
-    memmove(frame_buffer, frame_buffer + (stride << 3), (height - 8) * stride);
-    memset(frame_buffer + (height - 8) * stride, 0x00, stride << 3);
-    cursor_row--;
-  }
-
-  if (cursor_was_shown) {
-    console_intl_toggle_cursor();
-    cursor_shown = true;
-  }
-}
-
-void console_refresh(void) {
-  static uint frame_count = 0;
-  if (frame_count == 0) {
-    console_intl_toggle_cursor();
-    cursor_shown = !cursor_shown;
+// Process text mode input, switching to binary mode after REMOTE_ENTRY_SEQUENCE. Returns the number
+// of bytes consumed.
+static size_t text_feed(const char *s, size_t n) {
+  static const char entry[] = REMOTE_ENTRY_SEQUENCE;
+  size_t start = 0;
+  for (size_t i = 0; i < n; i++) {
+    // False start. Release the held bytes which can no longer begin the sequence, keeping those
+    // which still may. The held bytes are always the last before this one.
+    while ((entry_matched > 0) && (s[i] != entry[entry_matched])) {
+      uint keep = entry_fallback(entry, entry_matched);
+      text_write(entry, entry_matched - keep);
+      entry_matched = keep;
+    }
+    if (s[i] == entry[entry_matched]) {
+      text_write(s + start, i - start);
+      start = i + 1;
+      if (++entry_matched == sizeof(entry) - 1) {
+        entry_matched = 0;
+        remote_begin();
+        return i + 1;
+      }
+    }
   }
-  frame_count = (frame_count + 1) & 0xf;
+  text_write(s + start, n - start);
+  return n;
 }
 
 int main() {
+  // The video mode comes first because it may choose sys_clk, which the UART depends on.
+  tvout_init(pio0, true, GPIO_SYNC_PIN, GPIO_VIDEO_PIN);
+  tvout_set_mode(PLAYGROUND_VIDEO_MODE);
+#ifdef PLAYGROUND_VIEWPORT_WIDTH
+  tvout_set_viewport(PLAYGROUND_VIEWPORT_WIDTH, PLAYGROUND_VIEWPORT_HEIGHT,
+                     PLAYGROUND_VIEWPORT_BORDER);
+#endif
+#if PLAYGROUND_EXACT_CLOCK
+  tvout_set_clock(TVOUT_CLOCK_EXACT);
+#endif
+
   stdio_init_all();
   puts("Starting...");
 
-  tvout_init(pio0, true, GPIO_SYNC_PIN, GPIO_VIDEO_PIN);
-
   width = tvout_get_screen_width();
   height = tvout_get_screen_height();
   stride = width >> 3;
 
-  frame_buffer = malloc(stride * height);
-  tvout_set_frame_buffer(frame_buffer);
+  frame_buffer = fbmem_alloc(stride * height);
+#if PLAYGROUND_TEXT_LAYER
+  // The console has a layer of its own over the graphics, so that text never destroys them. It's
+  // taller than the screen so that the console can scroll smoothly.
+  text_rows = height + TEXT_SPARE_ROWS;
+  uint8_t *text_buffer = fbmem_alloc(stride * text_rows);
+  tvout_set_layer(text_buffer, TVOUT_BLEND_XOR);
+#else
+  uint8_t *text_buffer = frame_buffer;
+  uint text_rows = height;
+#endif
+#if PLAYGROUND_FONT_IN_RAM
+  console_init(glyph_copy_font_to_ram(&font_8x8), text_buffer, width, text_rows, stride);
+#else
+  console_init(&font_8x8, text_buffer, width, text_rows, stride);
+#endif
+#if PLAYGROUND_TEXT_LAYER
+  console_set_smooth_scroll(height, text_origin);
+#endif
+  gfx_surface_init(&screen, frame_buffer, width, height, stride, true);
+  remote_init(&screen, uart0);
   tvout_set_vblank_callback(console_refresh);
 
+  // Show the splash screen straight from flash, if it fits the mode, until the first input arrives.
+  bool splash = (family.width == width) && (family.height == height) && !family.compressed;
+  tvout_set_frame_buffer(splash ? image_pixels(&family) : frame_buffer);
+
   tvout_start();
-  console_reset();
 
-  // memcpy(frame_buffer, family, stride * height);
-  memset(frame_buffer, 0x00, stride * height);
+  tvout_clock_info_t clocks;
+  tvout_get_clock_info(&clocks);
+  printf("sys_clk %luHz, PIO dividers %.3f and %.3f, timing clock %+ldppm, line rate %+ldppm, "
+         "field rate %+ldppm, dot clock %+ldppm, jitter %lups\n",
+         (unsigned long)clocks.sys_clock_hz, clocks.timing_divider, clocks.video_divider,
+         (long)clocks.timing_error_ppm, (long)clocks.line_error_ppm, (long)clocks.field_error_ppm,
+         (long)clocks.dot_error_ppm, (unsigned long)clocks.jitter_ps);
 
   while (true) {
-    char c = uart_getc(uart0);
-    console_putc(c);
-    uart_putc(uart0, c);
+    // Block for one character and then drain whatever else has arrived so that the console is
+    // claimed once per burst rather than once per character.
+    char buf[32];
+    size_t n = 0;
+    buf[n++] = uart_getc(uart0);
+    if (splash) {
+      tvout_set_frame_buffer(frame_buffer);
+      splash = false;
+    }
+    while ((n < sizeof(buf)) && uart_is_readable(uart0)) {
+      buf[n++] = uart_getc(uart0);
+    }
+
+    // The burst may switch between text and binary mode part way through. The cursor is kept out
+    // of the way of remote drawing.
+    for (size_t i = 0; i < n;) {
+      if (remote_active()) {
+        i += remote_feed((const uint8_t *)buf + i, n - i);
+        if (!remote_active()) {
+          console_set_cursor_enabled(true);
+        }
+      } else {
+        i += text_feed(buf + i, n - i);
+        if (remote_active()) {
+          console_set_cursor_enabled(false);
+        }
+      }
+    }
   }
 
   tvout_cleanup();
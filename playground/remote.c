@@ -0,0 +1,349 @@
+#include <stdlib.h>
+#include <string.h>
+
+#include "hardware/uart.h"
+#include "pico/stdlib.h"
+
+#include "remote.h"
+#include "stream.h"
+#include "tvout.h"
+
+// Frame receive state.
+typedef enum {
+  REMOTE_RX_SYNC,     // Waiting for REMOTE_FRAME_SYNC
+  REMOTE_RX_HEADER,   // Receiving seq, command and length
+  REMOTE_RX_PAYLOAD,  // Receiving the payload
+  REMOTE_RX_CHECKSUM, // Receiving the checksum
+} remote_rx_state_t;
+
+// Size of the header preceding each command's payload in the batch: command, padding and length.
+#define REMOTE_ENTRY_HEADER_SIZE 4
+
+static const gfx_surface_t *surface;
+static uart_inst_t *uart;
+static bool active;
+
+// Queued commands. Each is a header followed by the payload padded to a multiple of four bytes so
+// that tile bitmaps are word aligned.
+static uint32_t batch[REMOTE_BATCH_SIZE / 4];
+static uint batch_used;
+
+static remote_rx_state_t rx_state;
+static uint8_t rx_header[4]; // seq, command, length
+static uint rx_count;        // Bytes of the current state received so far
+static uint rx_length;
+static uint8_t *rx_payload;  // Destination for the payload, NULL to discard it
+static uint8_t rx_control_payload[4];
+static remote_status_t rx_status; // Status decided when the header arrived
+static uint rx_sum1, rx_sum2;     // Fletcher-16 sums
+static uint8_t rx_checksum[2];
+
+// Data following the reply to the current frame.
+static uint8_t reply_data[sizeof(stream_stats_t)];
+static uint reply_data_length;
+
+static inline uint remote_intl_u16(const uint8_t *p) { return p[0] | (p[1] << 8); }
+
+static inline int remote_intl_s16(const uint8_t *p) { return (int16_t)remote_intl_u16(p); }
+
+static inline uint32_t remote_intl_u32(const uint8_t *p) {
+  return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static inline void remote_intl_put_u32(uint8_t *p, uint32_t v) {
+  p[0] = v;
+  p[1] = v >> 8;
+  p[2] = v >> 16;
+  p[3] = v >> 24;
+}
+
+static inline uint remote_intl_entry_size(uint length) {
+  return REMOTE_ENTRY_HEADER_SIZE + ((length + 3) & ~0x3);
+}
+
+// Fletcher-16 with the modulo replaced by a conditional subtract.
+static inline void remote_intl_checksum_add(uint8_t b) {
+  rx_sum1 += b;
+  if (rx_sum1 >= 255) {
+    rx_sum1 -= 255;
+  }
+  rx_sum2 += rx_sum1;
+  if (rx_sum2 >= 255) {
+    rx_sum2 -= 255;
+  }
+}
+
+static void remote_intl_reply(uint8_t seq, remote_status_t status) {
+  uint8_t reply[3] = {REMOTE_REPLY_SYNC, seq, status};
+  uart_write_blocking(uart, reply, sizeof(reply));
+  if (status == REMOTE_STATUS_OK) {
+    uart_write_blocking(uart, reply_data, reply_data_length);
+  }
+}
+
+void remote_init(const gfx_surface_t *s, uart_inst_t *u) {
+  surface = s;
+  uart = u;
+  active = false;
+  stream_init(surface);
+}
+
+void remote_begin(void) {
+  active = true;
+  batch_used = 0;
+  rx_state = REMOTE_RX_SYNC;
+}
+
+bool remote_active(void) { return active; }
+
+static void remote_intl_scroll_rect(const uint8_t *p) {
+  int x = remote_intl_u16(p), y = remote_intl_u16(p + 2);
+  int w = remote_intl_u16(p + 4), h = remote_intl_u16(p + 6);
+  int dx = remote_intl_s16(p + 8), dy = remote_intl_s16(p + 10);
+  uint32_t pattern = remote_intl_u32(p + 12);
+
+  // Move whatever remains within the rectangle and then fill the exposed strips.
+  int kept_w = w - abs(dx), kept_h = h - abs(dy);
+  if ((kept_w <= 0) || (kept_h <= 0)) {
+    gfx_fill_rect(surface, x, y, w, h, pattern, GFX_ROP_COPY);
+    return;
+  }
+  gfx_blit(surface, x + MAX(dx, 0), y + MAX(dy, 0), surface, x + MAX(-dx, 0), y + MAX(-dy, 0),
+           kept_w, kept_h, GFX_ROP_COPY);
+  if (dy > 0) {
+    gfx_fill_rect(surface, x, y, w, dy, pattern, GFX_ROP_COPY);
+  } else if (dy < 0) {
+    gfx_fill_rect(surface, x, y + h + dy, w, -dy, pattern, GFX_ROP_COPY);
+  }
+  if (dx > 0) {
+    gfx_fill_rect(surface, x, y, dx, h, pattern, GFX_ROP_COPY);
+  } else if (dx < 0) {
+    gfx_fill_rect(surface, x + w + dx, y, -dx, h, pattern, GFX_ROP_COPY);
+  }
+}
+
+static void remote_intl_upload_tile(const uint8_t *p) {
+  uint w = remote_intl_u16(p + 4), h = remote_intl_u16(p + 6);
+  gfx_surface_t tile;
+  gfx_surface_init(&tile, (void *)(p + 12), w, h, ((w + 31) >> 5) << 2, true);
+  gfx_blit(surface, remote_intl_u16(p), remote_intl_u16(p + 2), &tile, 0, 0, w, h, p[8]);
+}
+
+// Execute and empty the batch. Commands were validated as they were queued.
+static void remote_intl_execute(void) {
+  for (uint offset = 0; offset < batch_used;) {
+    const uint8_t *entry = (const uint8_t *)batch + offset;
+    const uint8_t *p = entry + REMOTE_ENTRY_HEADER_SIZE;
+    uint length = remote_intl_u16(entry + 2);
+
+    switch (entry[0]) {
+    case REMOTE_COMMAND_FILL_SPANS: {
+      int x0 = remote_intl_u16(p), x1 = remote_intl_u16(p + 2);
+      gfx_fill_rect(surface, x0, remote_intl_u16(p + 4), x1 - x0, remote_intl_u16(p + 6),
+                    remote_intl_u32(p + 8), p[12]);
+      break;
+    }
+    case REMOTE_COMMAND_BLIT:
+      gfx_blit(surface, remote_intl_u16(p + 4), remote_intl_u16(p + 6), surface,
+               remote_intl_u16(p), remote_intl_u16(p + 2), remote_intl_u16(p + 8),
+               remote_intl_u16(p + 10), p[12]);
+      break;
+    case REMOTE_COMMAND_SCROLL_RECT:
+      remote_intl_scroll_rect(p);
+      break;
+    case REMOTE_COMMAND_UPLOAD_TILE:
+      remote_intl_upload_tile(p);
+      break;
+    }
+    offset += remote_intl_entry_size(length);
+  }
+  batch_used = 0;
+}
+
+// Decide what to do with a frame once its header has arrived. Returns the status to reply with
+// and sets rx_payload to where the payload should be received.
+static remote_status_t remote_intl_accept_header(uint command, uint length) {
+  rx_payload = NULL;
+  switch (command) {
+  case REMOTE_COMMAND_FILL_SPANS:
+  case REMOTE_COMMAND_BLIT:
+  case REMOTE_COMMAND_SCROLL_RECT:
+  case REMOTE_COMMAND_UPLOAD_TILE:
+  case REMOTE_COMMAND_STREAM_DATA:
+    // Stream data is received into the free part of the batch but never committed to it.
+    if (remote_intl_entry_size(length) > REMOTE_BATCH_SIZE) {
+      return REMOTE_STATUS_BAD_LENGTH;
+    }
+    if (remote_intl_entry_size(length) > REMOTE_BATCH_SIZE - batch_used) {
+      return REMOTE_STATUS_FULL;
+    }
+    rx_payload = (uint8_t *)batch + batch_used + REMOTE_ENTRY_HEADER_SIZE;
+    return REMOTE_STATUS_OK;
+  case REMOTE_COMMAND_EXECUTE:
+  case REMOTE_COMMAND_EXIT:
+  case REMOTE_COMMAND_PING:
+  case REMOTE_COMMAND_STREAM_BEGIN:
+  case REMOTE_COMMAND_STREAM_END:
+  case REMOTE_COMMAND_STREAM_STOP:
+  case REMOTE_COMMAND_STREAM_STATS:
+  case REMOTE_COMMAND_TEST_PATTERN:
+    if (length > sizeof(rx_control_payload)) {
+      return REMOTE_STATUS_BAD_LENGTH;
+    }
+    rx_payload = rx_control_payload;
+    return REMOTE_STATUS_OK;
+  default:
+    return REMOTE_STATUS_BAD_COMMAND;
+  }
+}
+
+// Check the payload of a complete frame.
+static remote_status_t remote_intl_validate(uint command, const uint8_t *p, uint length) {
+  switch (command) {
+  case REMOTE_COMMAND_FILL_SPANS:
+  case REMOTE_COMMAND_BLIT:
+    if (length != 13) {
+      return REMOTE_STATUS_BAD_LENGTH;
+    }
+    return (p[12] <= GFX_ROP_XOR) ? REMOTE_STATUS_OK : REMOTE_STATUS_BAD_COMMAND;
+  case REMOTE_COMMAND_SCROLL_RECT:
+    return (length == 16) ? REMOTE_STATUS_OK : REMOTE_STATUS_BAD_LENGTH;
+  case REMOTE_COMMAND_UPLOAD_TILE:
+    if ((length < 12) ||
+        (length != 12 + (((remote_intl_u16(p + 4) + 31) >> 5) << 2) * remote_intl_u16(p + 6))) {
+      return REMOTE_STATUS_BAD_LENGTH;
+    }
+    return (p[8] <= GFX_ROP_XOR) ? REMOTE_STATUS_OK : REMOTE_STATUS_BAD_COMMAND;
+  case REMOTE_COMMAND_EXECUTE:
+    return (length == 1) ? REMOTE_STATUS_OK : REMOTE_STATUS_BAD_LENGTH;
+  case REMOTE_COMMAND_TEST_PATTERN:
+    if (length != 1) {
+      return REMOTE_STATUS_BAD_LENGTH;
+    }
+    return (p[0] <= TVOUT_PATTERN_SAFE_AREA) ? REMOTE_STATUS_OK : REMOTE_STATUS_BAD_COMMAND;
+  case REMOTE_COMMAND_STREAM_DATA:
+    return REMOTE_STATUS_OK;
+  default:
+    return (length == 0) ? REMOTE_STATUS_OK : REMOTE_STATUS_BAD_LENGTH;
+  }
+}
+
+// Act on a complete frame whose checksum is correct.
+static remote_status_t remote_intl_complete(uint command, uint length) {
+  if (rx_status != REMOTE_STATUS_OK) {
+    return rx_status;
+  }
+  remote_status_t status = remote_intl_validate(command, rx_payload, length);
+  if (status != REMOTE_STATUS_OK) {
+    return status;
+  }
+
+  switch (command) {
+  case REMOTE_COMMAND_EXECUTE:
+    if (rx_control_payload[0] & REMOTE_EXECUTE_WAIT_FOR_VBLANK) {
+      tvout_wait_for_vblank();
+    }
+    remote_intl_execute();
+    break;
+  case REMOTE_COMMAND_EXIT:
+    remote_intl_execute();
+    if (stream_active()) {
+      stream_stop();
+    }
+    active = false;
+    break;
+  case REMOTE_COMMAND_PING:
+    break;
+  case REMOTE_COMMAND_STREAM_BEGIN:
+    return stream_begin() ? REMOTE_STATUS_OK : REMOTE_STATUS_NO_MEMORY;
+  case REMOTE_COMMAND_STREAM_DATA:
+    if (!stream_active()) {
+      return REMOTE_STATUS_BAD_COMMAND;
+    }
+    return stream_data(rx_payload, length) ? REMOTE_STATUS_OK : REMOTE_STATUS_BAD_DATA;
+  case REMOTE_COMMAND_STREAM_END:
+    if (!stream_active()) {
+      return REMOTE_STATUS_BAD_COMMAND;
+    }
+    return stream_end_frame() ? REMOTE_STATUS_OK : REMOTE_STATUS_BAD_DATA;
+  case REMOTE_COMMAND_STREAM_STOP:
+    if (stream_active()) {
+      stream_stop();
+    }
+    break;
+  case REMOTE_COMMAND_STREAM_STATS: {
+    stream_stats_t stats;
+    stream_get_stats(&stats);
+    remote_intl_put_u32(reply_data, stats.frames);
+    remote_intl_put_u32(reply_data + 4, stats.elapsed_us);
+    remote_intl_put_u32(reply_data + 8, stats.decode_us);
+    remote_intl_put_u32(reply_data + 12, stats.max_decode_us);
+    reply_data_length = 16;
+    break;
+  }
+  case REMOTE_COMMAND_TEST_PATTERN:
+    tvout_set_test_pattern(rx_control_payload[0]);
+    break;
+  default: {
+    // Commit the queued command by writing its header.
+    uint8_t *entry = (uint8_t *)batch + batch_used;
+    entry[0] = command;
+    entry[1] = 0;
+    entry[2] = length & 0xff;
+    entry[3] = length >> 8;
+    batch_used += remote_intl_entry_size(length);
+    break;
+  }
+  }
+  return REMOTE_STATUS_OK;
+}
+
+size_t remote_feed(const uint8_t *data, size_t n) {
+  size_t i = 0;
+  while ((i < n) && active) {
+    uint8_t b = data[i++];
+    switch (rx_state) {
+    case REMOTE_RX_SYNC:
+      // Anything other than a sync byte is noise, e.g. the rest of a frame after a lost byte.
+      if (b == REMOTE_FRAME_SYNC) {
+        rx_state = REMOTE_RX_HEADER;
+        rx_count = 0;
+        rx_sum1 = rx_sum2 = 0;
+      }
+      break;
+    case REMOTE_RX_HEADER:
+      remote_intl_checksum_add(b);
+      rx_header[rx_count++] = b;
+      if (rx_count == sizeof(rx_header)) {
+        rx_length = remote_intl_u16(rx_header + 2);
+        rx_status = remote_intl_accept_header(rx_header[1], rx_length);
+        rx_state = (rx_length > 0) ? REMOTE_RX_PAYLOAD : REMOTE_RX_CHECKSUM;
+        rx_count = 0;
+      }
+      break;
+    case REMOTE_RX_PAYLOAD:
+      remote_intl_checksum_add(b);
+      if (rx_payload != NULL) {
+        rx_payload[rx_count] = b;
+      }
+      if (++rx_count == rx_length) {
+        rx_state = REMOTE_RX_CHECKSUM;
+        rx_count = 0;
+      }
+      break;
+    case REMOTE_RX_CHECKSUM:
+      rx_checksum[rx_count++] = b;
+      if (rx_count == sizeof(rx_checksum)) {
+        remote_status_t status = REMOTE_STATUS_BAD_CHECKSUM;
+        reply_data_length = 0;
+        if ((rx_checksum[0] == rx_sum1) && (rx_checksum[1] == rx_sum2)) {
+          status = remote_intl_complete(rx_header[1], rx_length);
+        }
+        remote_intl_reply(rx_header[0], status);
+        rx_state = REMOTE_RX_SYNC;
+      }
+      break;
+    }
+  }
+  return i;
+}
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "hardware/uart.h"
+#include "pico/types.h"
+
+#include "gfx.h"
+
+// Binary drawing protocol over the UART. The main loop switches from text to binary mode when it
+// sees REMOTE_ENTRY_SEQUENCE, an APC string which a terminal would silently discard, and back again
+// after an EXIT command. See tools/remote.py for a host-side client.
+//
+// Each command is sent as a frame:
+//
+//   0xA5 | seq | command | length (u16) | payload[length] | checksum (u16)
+//
+// All multi-byte values are little-endian. seq is chosen by the host and echoed in the reply. The
+// checksum is Fletcher-16 over seq, command, length and payload with the first sum in the low byte.
+// Every frame is answered with a three byte reply:
+//
+//   0x5A | seq | status
+//
+// Commands are not executed as they arrive. They are checked, acknowledged and queued in a batch
+// of at most REMOTE_BATCH_SIZE bytes which is executed against the frame buffer by an EXECUTE
+// command. A command which does not fit in the remaining space is refused with REMOTE_STATUS_FULL
+// and should be resent after an EXECUTE. EXECUTE is only acknowledged once the batch has run and
+// so also serves as flow control: the host may send commands without waiting for their replies
+// so long as it waits for the reply to each EXECUTE.
+//
+// The STREAM_* commands stream delta-coded frames (see stream.h and tools/stream.py). They are
+// executed as soon as they arrive rather than batched. STREAM_END is only acknowledged once the
+// frame is on screen and the host must wait for its reply before sending the next frame.
+
+#define REMOTE_ENTRY_SEQUENCE "\x1b_B\x1b\\"
+
+#define REMOTE_FRAME_SYNC 0xA5
+#define REMOTE_REPLY_SYNC 0x5A
+
+// Size of the batch buffer including a four byte header per command.
+#define REMOTE_BATCH_SIZE 4096
+
+// Commands. Coordinates are u16 unless stated otherwise and rop is a gfx_rop_t in one byte.
+typedef enum {
+  // x0, x1, y, rows, pattern (u32), rop. Fill x0 <= x < x1 of rows y to y + rows - 1.
+  REMOTE_COMMAND_FILL_SPANS = 0x01,
+  // sx, sy, dx, dy, w, h, rop. Combine a region of the frame buffer into another region.
+  REMOTE_COMMAND_BLIT = 0x02,
+  // x, y, w, h, dx (s16), dy (s16), pattern (u32). Move the contents of a rectangle by (dx, dy)
+  // within the rectangle, filling the exposed area with pattern.
+  REMOTE_COMMAND_SCROLL_RECT = 0x03,
+  // x, y, w, h, rop, three bytes of padding and then h rows of bitmap, MSB-first. Each row is
+  // padded to a multiple of four bytes.
+  REMOTE_COMMAND_UPLOAD_TILE = 0x04,
+  // flags. Execute the batch. If bit 0 of flags is set then wait for vblank first.
+  REMOTE_COMMAND_EXECUTE = 0x10,
+  // No payload. Execute the batch and return to text mode.
+  REMOTE_COMMAND_EXIT = 0x11,
+  // No payload. Reply without doing anything.
+  REMOTE_COMMAND_PING = 0x12,
+  // No payload. Clear the screen and start streaming.
+  REMOTE_COMMAND_STREAM_BEGIN = 0x20,
+  // The next part of the current frame's delta.
+  REMOTE_COMMAND_STREAM_DATA = 0x21,
+  // No payload. Show the current frame.
+  REMOTE_COMMAND_STREAM_END = 0x22,
+  // No payload. Stop streaming, leaving the last frame on screen.
+  REMOTE_COMMAND_STREAM_STOP = 0x23,
+  // No payload. The reply is followed by a stream_stats_t as four u32 values.
+  REMOTE_COMMAND_STREAM_STATS = 0x24,
+  // pattern (u8). Show a tvout_pattern_t test pattern at once, or the frame buffer again with 0.
+  REMOTE_COMMAND_TEST_PATTERN = 0x30,
+} remote_command_t;
+
+#define REMOTE_EXECUTE_WAIT_FOR_VBLANK 0x01
+
+typedef enum {
+  REMOTE_STATUS_OK = 0x00,
+  REMOTE_STATUS_BAD_CHECKSUM = 0x01,
+  REMOTE_STATUS_BAD_COMMAND = 0x02,
+  REMOTE_STATUS_BAD_LENGTH = 0x03,
+  REMOTE_STATUS_FULL = 0x04,
+  REMOTE_STATUS_NO_MEMORY = 0x05,
+  REMOTE_STATUS_BAD_DATA = 0x06,
+} remote_status_t;
+
+// Initialise the protocol to draw into a surface and reply via a UART.
+void remote_init(const gfx_surface_t *surface, uart_inst_t *uart);
+
+// Enter binary mode.
+void remote_begin(void);
+
+// Return true while in binary mode.
+bool remote_active(void);
+
+// Process received bytes. Returns the number of bytes consumed which is less than n only if an
+// EXIT command was processed, in which case the remaining bytes are text.
+size_t remote_feed(const uint8_t *data, size_t n);
@@ -0,0 +1,203 @@
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+#include "sixel.h"
+
+#define SIXEL_MAX_PARAM 0xFFFF
+
+// Colour register coordinate systems.
+#define SIXEL_COLOUR_HLS 1
+#define SIXEL_COLOUR_RGB 2
+
+// The VT340's default palette as RGB percentages. Higher registers default to black.
+static const uint8_t default_palette[16][3] = {
+    {0, 0, 0},    {20, 20, 80}, {80, 13, 13}, {20, 80, 20}, {80, 20, 80}, {20, 80, 80},
+    {80, 80, 20}, {53, 53, 53}, {26, 26, 26}, {33, 33, 60}, {60, 26, 26}, {33, 60, 33},
+    {60, 33, 60}, {33, 60, 60}, {60, 60, 33}, {80, 80, 80},
+};
+
+// 4x4 Bayer matrix. A pixel is white if its colour's level, from 0 to 16, exceeds its threshold.
+static const uint8_t bayer[4][4] = {
+    {0, 8, 2, 10},
+    {12, 4, 14, 6},
+    {3, 11, 1, 9},
+    {15, 7, 13, 5},
+};
+
+// Rec. 601 luma of an RGB colour given in percent, from 0 to 255.
+static inline uint8_t sixel_intl_luminance(uint r, uint g, uint b) {
+  return ((77 * r + 150 * g + 29 * b) * 255) / (100 * 256);
+}
+
+static void sixel_intl_select(sixel_decoder_t *d, uint colour) {
+  d->colour = colour & SIXEL_MAX_COLOUR;
+  uint luminance = d->luminance[d->colour];
+  for (uint row = 0; row < 4; row++) {
+    uint32_t nibble = 0;
+    for (uint col = 0; col < 4; col++) {
+      bool white = d->dither ? ((luminance * 17) >> 8) > bayer[row][col] : luminance >= 128;
+      nibble |= (uint32_t)white << (3 - col);
+    }
+    d->patterns[row] = nibble * 0x11111111u;
+  }
+}
+
+void sixel_decoder_init(sixel_decoder_t *d, const gfx_surface_t *surface, int x, int y,
+                        sixel_band_callback_t band, bool transparent, bool dither) {
+  d->surface = surface;
+  d->left = d->x = x;
+  d->y = y;
+  d->bottom = -1;
+  d->band = band;
+  d->transparent = transparent;
+  d->dither = dither;
+  d->band_ready = false;
+  d->background_width = d->background_top = d->background_bottom = 0;
+  d->command = 0;
+  d->repeat = 1;
+
+  memset(d->luminance, 0, sizeof(d->luminance));
+  for (uint i = 0; i < count_of(default_palette); i++) {
+    const uint8_t *rgb = default_palette[i];
+    d->luminance[i] = sixel_intl_luminance(rgb[0], rgb[1], rgb[2]);
+  }
+  sixel_intl_select(d, 0);
+}
+
+// Surface row of row y of the current band.
+static inline int sixel_intl_row(const sixel_decoder_t *d, int y) {
+  int row = d->band_row + (y - d->y);
+  return (row >= (int)d->surface->height) ? row - (int)d->surface->height : row;
+}
+
+// Make room for the current band, find where it wraps to on the surface and draw its part of the
+// background.
+static void sixel_intl_prepare_band(sixel_decoder_t *d) {
+  int scrolled = d->band(d->y + 6);
+  d->y -= scrolled;
+  d->background_top -= scrolled;
+  d->background_bottom -= scrolled;
+  if (d->bottom >= 0) {
+    d->bottom = MAX(d->bottom - scrolled, 0);
+  }
+  d->band_row = d->y % (int)d->surface->height;
+
+  for (int y = MAX(d->y, d->background_top); y < MIN(d->y + 6, d->background_bottom); y++) {
+    gfx_span(d->surface, d->left, d->left + d->background_width, sixel_intl_row(d, y),
+             GFX_PATTERN_BLACK, GFX_ROP_COPY);
+    d->bottom = MAX(d->bottom, y + 1);
+  }
+  d->band_ready = true;
+}
+
+// Move on to the next band. A band with no sixels drawn is still prepared if the background covers
+// it.
+static void sixel_intl_new_line(sixel_decoder_t *d) {
+  if (!d->band_ready && (d->background_bottom > d->y)) {
+    sixel_intl_prepare_band(d);
+  }
+  d->x = d->left;
+  d->y += 6;
+  d->band_ready = false;
+}
+
+// Draw a sixel repeated over n columns. Bit 0 is the top row of the band.
+static void sixel_intl_draw(sixel_decoder_t *d, uint bits, uint n) {
+  if (bits != 0) {
+    if (!d->band_ready) {
+      sixel_intl_prepare_band(d);
+    }
+    for (int y = d->y; bits != 0; bits >>= 1, y++) {
+      if (bits & 1) {
+        int row = sixel_intl_row(d, y);
+        gfx_span(d->surface, d->x, d->x + n, row, d->patterns[row & 3], GFX_ROP_COPY);
+        d->bottom = MAX(d->bottom, y + 1);
+      }
+    }
+  }
+  d->x += n;
+}
+
+static void sixel_intl_complete_command(sixel_decoder_t *d) {
+  uint *p = d->params;
+  switch (d->command) {
+  case '!':
+    d->repeat = MAX(p[0], 1);
+    break;
+  case '#':
+    if (d->param_count >= 5) {
+      uint8_t *luminance = &d->luminance[p[0] & SIXEL_MAX_COLOUR];
+      if (p[1] == SIXEL_COLOUR_RGB) {
+        *luminance = sixel_intl_luminance(MIN(p[2], 100), MIN(p[3], 100), MIN(p[4], 100));
+      } else if (p[1] == SIXEL_COLOUR_HLS) {
+        // Lightness stands in for luminance.
+        *luminance = (MIN(p[3], 100) * 255) / 100;
+      }
+    }
+    sixel_intl_select(d, p[0]);
+    break;
+  case '"':
+    // Raster attributes: Pan; Pad; Ph; Pv. Only the size is used, to draw the background from
+    // the next band to be prepared.
+    if ((d->param_count >= 4) && !d->transparent) {
+      d->background_width = p[2];
+      d->background_top = d->band_ready ? d->y + 6 : d->y;
+      d->background_bottom = d->y + MIN((int)p[3], (int)d->surface->height);
+    }
+    break;
+  }
+  d->command = 0;
+}
+
+void sixel_putc(sixel_decoder_t *d, char c) {
+  if (d->command != 0) {
+    if ((c >= '0') && (c <= '9')) {
+      uint *p = &d->params[d->param_count - 1];
+      *p = MIN(*p * 10 + (c - '0'), SIXEL_MAX_PARAM);
+      return;
+    }
+    if (c == ';') {
+      if (d->param_count < count_of(d->params)) {
+        d->params[d->param_count++] = 0;
+      }
+      return;
+    }
+    sixel_intl_complete_command(d);
+  }
+
+  switch (c) {
+  case '!':
+  case '#':
+  case '"':
+    d->command = c;
+    d->param_count = 1;
+    d->params[0] = 0;
+    break;
+  case '$':
+    // Graphics carriage return, e.g. to draw the band again in another colour.
+    d->x = d->left;
+    break;
+  case '-':
+    // Graphics new line.
+    sixel_intl_new_line(d);
+    break;
+  default:
+    if ((c >= '?') && (c <= '~')) {
+      sixel_intl_draw(d, c - '?', d->repeat);
+      d->repeat = 1;
+    }
+    // Anything else, including control characters, is ignored.
+    break;
+  }
+}
+
+int sixel_finish(sixel_decoder_t *d) {
+  if (d->command != 0) {
+    sixel_intl_complete_command(d);
+  }
+  while (d->background_bottom > d->y) {
+    sixel_intl_new_line(d);
+  }
+  return d->bottom;
+}
@@ -0,0 +1,67 @@
+#pragma once
+
+#include "pico/types.h"
+
+#include "gfx.h"
+
+// Streaming decoder for DEC sixel graphics. The data of a sixel DCS sequence, i.e. everything
+// between the final 'q' and the string terminator, is passed a byte at a time and drawn straight
+// into a 1bpp surface. Nothing is buffered beyond the current command: each sixel is drawn as soon
+// as it arrives, six rows at a time.
+//
+// Colour registers are reduced to their luminance and drawn either thresholded to black or white
+// or ordered dithered. The dither pattern is fixed to the surface so that bands, and images drawn
+// with several passes over a band, line up. Sixel pixels are drawn one to one with frame buffer
+// pixels whatever aspect ratio the image asks for.
+//
+// The image's background is drawn black unless transparent. As the image's size is only known
+// from its raster attributes, the background is only drawn for images which have them. It is drawn
+// a band at a time along with the sixels, and no taller than the surface.
+//
+// Rows are counted on from the top of the surface as the image goes down and drawn modulo its
+// height, so the surface may be a ring of rows, e.g. the console's when it scrolls smoothly.
+
+// Largest colour register. Higher registers wrap.
+#define SIXEL_MAX_COLOUR 255
+
+// Called before each band is drawn with the row below it, so that the caller can make room for it,
+// e.g. by scrolling. Returns the number of rows by which the surface was scrolled up, which moves
+// the image up with it.
+typedef int (*sixel_band_callback_t)(int bottom);
+
+typedef struct {
+  const gfx_surface_t *surface;
+  int left;        // Left-most column of the image
+  int x, y;        // Next column and top row of the current band
+  int bottom;      // Row below the lowest pixel drawn so far or -1
+  int band_row;    // Surface row of the top of the current band
+  sixel_band_callback_t band;
+  bool transparent, dither;
+  bool band_ready; // The current band has been passed to band and its background drawn
+
+  // Background from the raster attributes, background_top <= row < background_bottom.
+  int background_width, background_top, background_bottom;
+
+  // Command being parsed, its parameters and the sixel repeat count which it may set.
+  char command;
+  uint param_count;
+  uint params[5];
+  uint repeat;
+
+  uint8_t colour;
+  uint32_t patterns[4]; // The selected colour's pattern for each of four consecutive rows
+  uint8_t luminance[SIXEL_MAX_COLOUR + 1];
+} sixel_decoder_t;
+
+// Start decoding an image with its top-left corner at (x, y), calling band before drawing each band
+// of it. transparent is true if the sequence's second parameter is 1.
+void sixel_decoder_init(sixel_decoder_t *decoder, const gfx_surface_t *surface, int x, int y,
+                        sixel_band_callback_t band, bool transparent, bool dither);
+
+// Decode the next byte of sixel data.
+void sixel_putc(sixel_decoder_t *decoder, char c);
+
+// Complete the image at the end of the sequence, drawing the rest of its background. Returns the
+// row below the lowest pixel drawn, counted on from the top of the surface as above, or -1 if
+// nothing was drawn.
+int sixel_finish(sixel_decoder_t *decoder);
@@ -0,0 +1,84 @@
+#include <string.h>
+
+#include "pico/stdlib.h"
+
+#include "delta.h"
+#include "fbmem.h"
+#include "stream.h"
+#include "tvout.h"
+
+static const gfx_surface_t *surface;
+static size_t frame_size;
+static uint8_t *buffers[2]; // buffers[0] is the surface's buffer
+static uint front;          // Index of the buffer being shown
+static bool active;
+
+static delta_decoder_t decoder;
+static stream_stats_t stats;
+static uint32_t first_frame_time, frame_decode_us;
+
+void stream_init(const gfx_surface_t *s) {
+  surface = s;
+  frame_size = surface->stride * surface->height;
+  buffers[0] = surface->buffer;
+  active = false;
+}
+
+bool stream_begin(void) {
+  if (buffers[1] == NULL) {
+    buffers[1] = fbmem_alloc(frame_size);
+    if (buffers[1] == NULL) {
+      return false;
+    }
+  }
+
+  // Only buffers[0] can be on screen when not streaming.
+  memset(buffers[0], 0x00, frame_size);
+  memset(buffers[1], 0x00, frame_size);
+  front = 0;
+  delta_decoder_init(&decoder, buffers[1], frame_size);
+  memset(&stats, 0, sizeof(stats));
+  frame_decode_us = 0;
+  active = true;
+  return true;
+}
+
+bool stream_active(void) { return active; }
+
+bool stream_data(const uint8_t *data, size_t n) {
+  uint32_t start = time_us_32();
+  bool ok = delta_decode(&decoder, data, n) == n;
+  frame_decode_us += time_us_32() - start;
+  return ok;
+}
+
+bool stream_end_frame(void) {
+  if (!delta_decoder_idle(&decoder)) {
+    return false;
+  }
+
+  front ^= 1;
+  tvout_flip(buffers[front]);
+  memcpy(buffers[front ^ 1], buffers[front], frame_size);
+  delta_decoder_init(&decoder, buffers[front ^ 1], frame_size);
+
+  uint32_t now = time_us_32();
+  if (stats.frames++ == 0) {
+    first_frame_time = now;
+  }
+  stats.elapsed_us = now - first_frame_time;
+  stats.decode_us += frame_decode_us;
+  stats.max_decode_us = MAX(stats.max_decode_us, frame_decode_us);
+  frame_decode_us = 0;
+  return true;
+}
+
+void stream_stop(void) {
+  if (front != 0) {
+    memcpy(buffers[0], buffers[1], frame_size);
+    tvout_flip(buffers[0]);
+  }
+  active = false;
+}
+
+void stream_get_stats(stream_stats_t *s) { *s = stats; }
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "pico/types.h"
+
+#include "gfx.h"
+
+// Streaming of delta-coded frames (see delta.h) from the host. Each frame is decoded into a back
+// buffer as it arrives and then flipped with the front buffer at vblank. The back buffer is then
+// brought up to date with the front so that every delta is coded against the frame on screen.
+// Streaming is driven by the STREAM_* commands of the remote protocol.
+
+typedef struct {
+  uint32_t frames;        // Frames shown since stream_begin()
+  uint32_t elapsed_us;    // Time from showing the first frame to showing the last
+  uint32_t decode_us;     // Total time spent decoding
+  uint32_t max_decode_us; // Longest time spent decoding a single frame
+} stream_stats_t;
+
+// Initialise streaming into a surface. The surface's buffer is used as one of the two buffers.
+void stream_init(const gfx_surface_t *surface);
+
+// Start streaming, allocating the second buffer on first use. Both buffers are cleared so that the
+// first frame is coded against black. Returns false if the allocation fails.
+bool stream_begin(void);
+
+// Return true between stream_begin() and stream_stop().
+bool stream_active(void);
+
+// Decode the next part of the current frame. Returns false if the data is malformed, in which
+// case streaming must be restarted with stream_begin().
+bool stream_data(const uint8_t *data, size_t n);
+
+// Show the current frame from the next field and wait until the previous one is no longer being
+// scanned out. Returns false if the frame ended part way through a run.
+bool stream_end_frame(void);
+
+// Stop streaming, leaving the last frame on screen in the surface's buffer.
+void stream_stop(void);
+
+void stream_get_stats(stream_stats_t *stats);
@@ -0,0 +1,102 @@
+#include <string.h>
+
+#include "testpattern.h"
+
+// Spacing of the grid's dots and of the crosshatch's lines, and the size of the checkerboard's
+// squares, which are whole words.
+#define GRID_SPACING 16
+#define CROSSHATCH_SPACING 32
+#define CHECKERBOARD_SIZE 32
+
+// Number of bars, each of stripes twice as wide as the last, and then a white one.
+#define BARS 6
+
+// Set pixels x0 <= x < x1 of a row.
+static void testpattern_intl_span(uint32_t *row, unsigned x0, unsigned x1) {
+  for (unsigned x = x0; x < x1; x++) {
+    row[x >> 5] |= 0x80000000u >> (x & 0x1f);
+  }
+}
+
+static void testpattern_intl_pixel(uint32_t *row, unsigned x) {
+  testpattern_intl_span(row, x, x + 1);
+}
+
+void testpattern_draw_rows(testpattern_t pattern, unsigned width, uint32_t *rows) {
+  unsigned words = width >> 5;
+  memset(rows, 0, TESTPATTERN_ROWS * words * sizeof(uint32_t));
+  uint32_t *row[TESTPATTERN_ROWS];
+  for (unsigned i = 0; i < TESTPATTERN_ROWS; i++) {
+    row[i] = rows + (i * words);
+  }
+
+  switch (pattern) {
+  case TESTPATTERN_NONE:
+    break;
+  case TESTPATTERN_GRID:
+    for (unsigned x = 0; x < width; x += GRID_SPACING) {
+      testpattern_intl_pixel(row[1], x);
+    }
+    break;
+  case TESTPATTERN_CROSSHATCH:
+    for (unsigned x = 0; x < width; x += CROSSHATCH_SPACING) {
+      testpattern_intl_pixel(row[0], x);
+    }
+    testpattern_intl_pixel(row[0], width - 1);
+    testpattern_intl_span(row[1], 0, width);
+    break;
+  case TESTPATTERN_CHECKERBOARD:
+    for (unsigned i = 0; i < words; i++) {
+      row[i & 1][i] = 0xffffffff;
+    }
+    break;
+  case TESTPATTERN_BARS:
+    for (unsigned bar = 0; bar < BARS; bar++) {
+      unsigned x0 = (bar * width) / BARS, x1 = ((bar + 1) * width) / BARS;
+      unsigned stripe = 1u << bar;
+      for (unsigned x = x0; x < x1; x++) {
+        if ((bar == BARS - 1) || ((((x - x0) / stripe) & 1) == 0)) {
+          testpattern_intl_pixel(row[0], x);
+        }
+      }
+    }
+    break;
+  case TESTPATTERN_SAFE_AREA: {
+    // Row 0 is between the outlines, 1 the top and bottom of the outer one, 2 those of the inner
+    // one and 3 inside the inner one.
+    unsigned x0 = width / 10, x1 = width - 1 - (width / 10);
+    for (unsigned i = 0; i < TESTPATTERN_ROWS; i++) {
+      testpattern_intl_pixel(row[i], 0);
+      testpattern_intl_pixel(row[i], width - 1);
+    }
+    testpattern_intl_span(row[1], 0, width);
+    testpattern_intl_span(row[2], x0, x1 + 1);
+    testpattern_intl_pixel(row[3], x0);
+    testpattern_intl_pixel(row[3], x1);
+    break;
+  }
+  }
+}
+
+unsigned testpattern_row(testpattern_t pattern, unsigned height, unsigned y) {
+  switch (pattern) {
+  case TESTPATTERN_GRID:
+    return ((y % GRID_SPACING) == 0) ? 1 : 0;
+  case TESTPATTERN_CROSSHATCH:
+    return (((y % CROSSHATCH_SPACING) == 0) || (y == height - 1)) ? 1 : 0;
+  case TESTPATTERN_CHECKERBOARD:
+    return (y / CHECKERBOARD_SIZE) & 1;
+  case TESTPATTERN_SAFE_AREA: {
+    unsigned y0 = height / 10, y1 = height - 1 - (height / 10);
+    if ((y == 0) || (y == height - 1)) {
+      return 1;
+    }
+    if ((y == y0) || (y == y1)) {
+      return 2;
+    }
+    return ((y > y0) && (y < y1)) ? 3 : 0;
+  }
+  default:
+    return 0;
+  }
+}
@@ -0,0 +1,27 @@
+#pragma once
+
+#include <stdint.h>
+
+// Test patterns for setting up a TV: its geometry, focus and overscan. Each pattern is made of at
+// most TESTPATTERN_ROWS different rows, so that scanout can show it by pointing every line at one
+// of them, with no frame buffer. This module has no dependency on the Pico SDK so that it can also
+// be built on the host, e.g. to check a capture of the output against the pattern.
+
+#define TESTPATTERN_ROWS 4
+
+typedef enum {
+  TESTPATTERN_NONE,         // Black
+  TESTPATTERN_GRID,         // Dots every 16 pixels
+  TESTPATTERN_CROSSHATCH,   // Lines every 32 pixels and along the right and bottom edges
+  TESTPATTERN_CHECKERBOARD, // 32 pixel squares
+  TESTPATTERN_BARS,         // Stripes 1, 2, 4, 8 and 16 pixels wide and a white bar
+  TESTPATTERN_SAFE_AREA,    // Outlines of the whole picture and of the middle 80% of it
+} testpattern_t;
+
+// Draw the rows of a pattern width pixels wide, a multiple of 32, into rows, TESTPATTERN_ROWS rows
+// of width / 32 words each. Each word's MSB is its left-most pixel.
+void testpattern_draw_rows(testpattern_t pattern, unsigned width, uint32_t *rows);
+
+// Index into the rows drawn by testpattern_draw_rows() of the one shown on row y of a pattern
+// height rows high.
+unsigned testpattern_row(testpattern_t pattern, unsigned height, unsigned y);
@@ -1,74 +1,138 @@
 #include <stdalign.h>
 #include <stdatomic.h>
+#include <string.h>
 
 #include "hardware/clocks.h"
 #include "hardware/dma.h"
 #include "hardware/pio.h"
+#include "hardware/regs/addressmap.h"
+#include "hardware/structs/bus_ctrl.h"
 #include "pico/stdlib.h"
 #include "pico/sync.h"
 
+#include "clockplan.h"
+#include "colour.h"
+#include "hotpath.h"
+#include "testpattern.h"
 #include "tvout.h"
 #include "tvout.pio.h"
+#include "tvout_timing.h"
 
-// Resolution
-#define VISIBLE_DOTS_PER_LINE 640                          // Horizontal resolution
-#define VISIBLE_LINES_PER_FIELD 256                        // Number of visible lines per field
-
-// TV signal timing. See http://martin.hinner.info/vga/pal.html. We repeatedly send the first field
-// which is sometimes known as "240p". (Or the PAL equivalent of "272p".)
-#define LINE_PERIOD_NS 64000                               // Period of one line of video (ns)
-#define LINES_PER_FIELD 310                                // Number of lines in a *field*
-#define HSYNC_WIDTH_NS 4700                                // Line sync pulse width (ns)
-#define HORIZ_OVERSCAN_NS 5520                             // Horizontal overscan (ns)
-#define VSYNC_LINES_PER_FIELD 5                            // V-sync lines at start of field
-#define VERT_OVERSCAN_LINES 16                             // Vertical overscan (lines per *field*)
-#define VERT_VISIBLE_START_LINE (23 + VERT_OVERSCAN_LINES) // Start line of visible data (0-based)
-#define FRONT_PORCH_WIDTH_NS (1650 + HORIZ_OVERSCAN_NS)    // Front porch width (ns)
-#define VISIBLE_WIDTH_NS (52000 - (2 * HORIZ_OVERSCAN_NS)) // Visible area (ns)
-#define SHORT_SYNC_WIDTH_NS 2350                           // "Short" sync pulse width (ns)
-#define LONG_SYNC_WIDTH_NS 27300                           // "Long" sync pulse width (ns)
-
-// Implied back porch period
-#define BACK_PORCH_WIDTH_NS                                                                        \
-  (LINE_PERIOD_NS - VISIBLE_WIDTH_NS - FRONT_PORCH_WIDTH_NS - HSYNC_WIDTH_NS)
-
-// Implied dot frequency
-#define DOT_CLOCK_FREQ (VISIBLE_DOTS_PER_LINE * (1e9 / VISIBLE_WIDTH_NS))
-
-// Timing program for a blank line
-alignas(8) uint32_t timing_blank_line[] = {
-    line_timing_encode(0, HSYNC_WIDTH_NS, SIDE_EFFECT_NOP),
-    line_timing_encode(1, LINE_PERIOD_NS - HSYNC_WIDTH_NS, SIDE_EFFECT_NOP),
-};
-#define TIMING_BLANK_LINE_LEN (sizeof(timing_blank_line) / sizeof(timing_blank_line[0]))
-
-// Timing program for a visible line. Note that we need to shift the visible portion by a few line
-// timing program clock cycles because of the difference in time between side effect and pin change
-// times.
-alignas(16) uint32_t timing_visible_line[] = {
-    line_timing_encode(0, HSYNC_WIDTH_NS, SIDE_EFFECT_NOP),
-    line_timing_encode(1, BACK_PORCH_WIDTH_NS + (2 * LINE_TIMING_CLOCK_PERIOD_NS), SIDE_EFFECT_NOP),
-    line_timing_encode(1, VISIBLE_WIDTH_NS, SIDE_EFFECT_SET_TRIGGER),
-    line_timing_encode(1, FRONT_PORCH_WIDTH_NS - (2 * LINE_TIMING_CLOCK_PERIOD_NS),
-                       SIDE_EFFECT_CLEAR_TRIGGER),
-};
-#define TIMING_VISIBLE_LINE_LEN (sizeof(timing_visible_line) / sizeof(timing_visible_line[0]))
+// Range of system clocks tvout_set_clock() may choose from: the RP2040's rated maximum and enough
+// below it to find integer dividers without giving up much drawing speed.
+#define MIN_SYS_CLOCK_HZ 100000000
+#define MAX_SYS_CLOCK_HZ 133000000
 
-// "Long" sync pulse "half line"
-alignas(8) uint32_t timing_long_sync_half_line[] = {
-    line_timing_encode(0, LONG_SYNC_WIDTH_NS, SIDE_EFFECT_NOP),
-    line_timing_encode(1, ((LINE_PERIOD_NS >> 1) - LONG_SYNC_WIDTH_NS), SIDE_EFFECT_NOP),
-};
-#define TIMING_LONG_SYNC_HALF_LINE_LEN                                                             \
-  (sizeof(timing_long_sync_half_line) / sizeof(timing_long_sync_half_line[0]))
+// Errors of the PIO clocks which count as equally bad. Line timing has to be accurate for the TV to
+// lock whereas a dot clock error only changes the width of the picture.
+#define LINE_TIMING_TOLERANCE_PPM 100
+#define VIDEO_OUTPUT_TOLERANCE_PPM 10000
+
+// Error of the colour subcarrier, and so of the sample clock which both programs run at in the
+// colour modes. A TV's colour decoder only locks to a burst within a few hundred Hz, about 440Hz
+// for PAL at this tolerance.
+#define COLOUR_TOLERANCE_PPM 100
+
+// Words in a line buffer: enough for a colour line, which is the burst, the blanking up to the
+// picture and a whole picture line at either standard's sample clock.
+#define LINE_BUFFER_WORDS 256
+
+// Frame buffer layout of each mode. Pixels are spread across the visible width, so narrower modes
+// have wider pixels, and each row of the frame buffer is shown on 1 << line_shift lines. Modes
+// wider than 640 pixels use video_output_fast, which takes one PIO cycle per pixel, not two. So do
+// the colour modes, whose 4 bit pixels are each two DAC samples of a line encoded by the CPU.
+typedef struct {
+  uint16_t width, height;
+  uint8_t line_shift;
+  bool fast;
+  bool colour;
+} mode_info_t;
 
-// "Short" sync pulse "half line"
-alignas(8) uint32_t timing_short_sync_half_line[] = {
-    line_timing_encode(0, SHORT_SYNC_WIDTH_NS, SIDE_EFFECT_NOP),
-    line_timing_encode(1, ((LINE_PERIOD_NS >> 1) - SHORT_SYNC_WIDTH_NS), SIDE_EFFECT_NOP),
+static const mode_info_t modes[] = {
+    [TVOUT_MODE_640X256] = {640, 256, 0, false, false},
+    [TVOUT_MODE_320X256] = {320, 256, 0, false, false},
+    [TVOUT_MODE_640X128] = {640, 128, 1, false, false},
+    [TVOUT_MODE_320X128] = {320, 128, 1, false, false},
+    [TVOUT_MODE_768X256] = {768, 256, 0, true, false},
+    [TVOUT_MODE_800X256] = {800, 256, 0, true, false},
+    [TVOUT_MODE_320X256_COLOUR] = {320, 256, 0, true, true},
 };
-#define TIMING_SHORT_SYNC_HALF_LINE_LEN                                                            \
-  (sizeof(timing_short_sync_half_line) / sizeof(timing_short_sync_half_line[0]))
+
+static const mode_info_t *mode = &modes[TVOUT_MODE_640X256];
+
+// Size of the frame buffer, the window centred on the screen, and the colour of the border around
+// it. Sizes are in pixels of the current mode.
+static uint window_width = VISIBLE_DOTS_PER_LINE;
+static uint window_height = VISIBLE_LINES_PER_FIELD;
+static tvout_border_t border = TVOUT_BORDER_BLACK;
+
+// First line and number of lines on which the video output program is triggered. A black border
+// above and below the window is made of blank lines. A white one is made of visible lines which
+// show border_row, as are the first border_lines entries of the line table and those after the
+// window.
+static uint first_visible_line = VERT_VISIBLE_START_LINE;
+static uint visible_lines = VISIBLE_LINES_PER_FIELD;
+static uint border_lines;
+
+// A row of white pixels for lines of white border, and one of black pixels for blank bands.
+static uint32_t border_row[MAX_VISIBLE_DOTS_PER_LINE >> 5];
+static uint32_t blank_row[MAX_VISIBLE_DOTS_PER_LINE >> 5];
+
+// Rows of the test pattern, each as wide as the window, as DMA reads them, and which of them each
+// row of the window shows.
+static uint32_t pattern_rows[TESTPATTERN_ROWS * (MAX_VISIBLE_DOTS_PER_LINE >> 5)];
+static uint8_t pattern_row_index[VISIBLE_LINES_PER_FIELD];
+
+// Start address of the frame buffer row shown on each visible line, followed by a zero which ends
+// the field. The line DMA channel writes each in turn to the video DMA channel's read address
+// trigger, chaining back after every line, so that rows can be repeated without any CPU work.
+static uintptr_t line_table[VISIBLE_LINES_PER_FIELD + 1];
+
+// What each visible line shows: a row of the frame buffer or of a band's bitmap, border_row or
+// blank_row, as line_table points at it unless the CPU builds the line. A line of a text band shows
+// its row of characters, with the index of the band and the row of its glyphs.
+static uintptr_t line_source[VISIBLE_LINES_PER_FIELD];
+static uint8_t line_band[VISIBLE_LINES_PER_FIELD];
+static uint8_t line_glyph_row[VISIBLE_LINES_PER_FIELD];
+
+// line_band of lines which aren't text.
+#define NO_BAND 0xff
+
+// Frame buffer for which line_table was built, 0 if none or if it was built for a display list,
+// whether it was built for the CPU to build every line and whether the CPU builds any.
+static uintptr_t line_table_frame_buffer;
+static bool line_table_staged;
+static bool line_table_built_lines;
+
+// In the colour modes, and with a layer or sprites, the CPU builds each visible line into one of
+// two line buffers while the other is scanned out, see line_dma_handler().
+static uint32_t line_buffer[2][LINE_BUFFER_WORDS];
+
+// Visible line whose line buffer is scanned out next.
+static uint next_staged_line;
+
+// Clocks chosen by tvout_start().
+static tvout_clock_info_t clock_info;
+
+// Colour encoding, DAC width and palette, and the DAC sample patterns encoded from them.
+static colour_standard_t colour_standard = COLOUR_PAL;
+static uint colour_dac_bits = 4;
+static uint32_t colour_palette[COLOUR_PALETTE_SIZE];
+static colour_patterns_t colour_patterns;
+
+// A colour line is the colour burst from the trigger, blanking up to the picture, the picture, and
+// a word of blanking which the DAC holds until the next line's burst.
+static uint colour_line_words;
+static uint colour_prefix_words;
+
+// Phase of the subcarrier, in samples, at the trigger of each visible line relative to the start
+// of the field, and the phase of the current field, which moves on by the length of a field.
+static uint8_t colour_line_phase[VISIBLE_LINES_PER_FIELD];
+static uint32_t colour_field_samples;
+static uint colour_field_phase;
+
+// Index of each byte of a frame buffer within its word, as DMA reads it, see tvout_init().
+static uint frame_buffer_byte_swap;
 
 // Semaphore used to signal vblank.
 semaphore_t vblank_semaphore;
@@ -76,12 +140,51 @@ semaphore_t vblank_semaphore;
 // Current frame buffer pointer. Marked as atomic so that the ISR always gets a valid value.
 static atomic_uintptr_t frame_buffer_ptr;
 
+// Frame buffer pointer read by the ISR at the start of the current field.
+static atomic_uintptr_t scanout_frame_buffer_ptr;
+
+// Layer shown over the frame buffer, how it's combined with it, the row of the layer shown on the
+// first row of the window and the rows after which it wraps, and their values latched by the ISR
+// at the start of the field.
+static atomic_uintptr_t layer_ptr;
+static atomic_uint layer_blend;
+static atomic_uint layer_origin;
+static atomic_uint layer_rows;
+static uintptr_t scanout_layer;
+static tvout_blend_t scanout_layer_blend;
+static uint scanout_layer_origin;
+static uint scanout_layer_rows;
+
+// Sprite list shown over the frame buffer and its length, and their values latched by the ISR at
+// the start of the field.
+static atomic_uintptr_t sprites_ptr;
+static atomic_uint sprite_count;
+static const tvout_sprite_t *scanout_sprites;
+static uint scanout_sprite_count;
+
+// Display list shown instead of the frame buffer and its length, 0 if none, and their values
+// latched by the ISR at the start of the field.
+static atomic_uintptr_t display_list_ptr;
+static atomic_uint display_list_count;
+static const tvout_band_t *scanout_display_list;
+static uint scanout_display_list_count;
+
+// Test pattern shown instead of the frame buffer, and its value latched by the ISR at the start of
+// the field.
+static atomic_uint test_pattern;
+static tvout_pattern_t scanout_test_pattern;
+
+// Counts of lines built by the CPU, see tvout_get_line_stats().
+static volatile tvout_line_stats_t line_stats;
+
 // Blanking interval callback
 static tvout_vblank_callback_t vblank_callback = NULL;
 
 // PIO-related configuration values.
+static uint video_output_pin;
 static uint video_output_sm;
 static uint video_output_offset;
+static uint video_output_fast_offset;
 static uint line_timing_sm;
 static uint line_timing_offset;
 static PIO pio_instance;
@@ -90,8 +193,13 @@ static PIO pio_instance;
 static uint field_timing_dma_channel;
 static dma_channel_config field_timing_dma_channel_config;
 
-// Video data DMA channel number.
+// Video data DMA channel number and config, and the channel which feeds it the start of each line.
 static uint video_dma_channel;
+static dma_channel_config video_dma_channel_config;
+static uint line_dma_channel;
+
+// DMA channel which restarts video_output_fast for each line and then starts the line channel.
+static uint restart_dma_channel;
 
 // Configure a DMA channel to copy the frame buffer into the video output PIO state machine.
 static inline dma_channel_config
@@ -103,6 +211,30 @@ get_video_output_dma_channel_config(uint dma_chan, PIO pio, uint sm,
   channel_config_set_write_increment(&c, false);
   channel_config_set_dreq(&c, pio_get_dreq(pio, sm, true));
   channel_config_set_bswap(&c, byte_oriented_frame_buffer);
+  channel_config_set_high_priority(&c, true);
+  return c;
+}
+
+// Configure a DMA channel to write the line table, one entry per trigger, to the video DMA
+// channel's read address trigger.
+static inline dma_channel_config get_line_dma_channel_config(uint dma_chan) {
+  dma_channel_config c = dma_channel_get_default_config(dma_chan);
+  channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+  channel_config_set_read_increment(&c, true);
+  channel_config_set_write_increment(&c, false);
+  channel_config_set_high_priority(&c, true);
+  return c;
+}
+
+// Configure a DMA channel to write each zero pushed by the timing PIO state machine to the video
+// output state machine's instruction register.
+static inline dma_channel_config get_restart_dma_channel_config(uint dma_chan, PIO pio, uint sm) {
+  dma_channel_config c = dma_channel_get_default_config(dma_chan);
+  channel_config_set_transfer_data_size(&c, DMA_SIZE_32);
+  channel_config_set_read_increment(&c, false);
+  channel_config_set_write_increment(&c, false);
+  channel_config_set_dreq(&c, pio_get_dreq(pio, sm, false));
+  channel_config_set_high_priority(&c, true);
   return c;
 }
 
@@ -117,8 +249,411 @@ static inline dma_channel_config get_field_timing_dma_channel_config(uint dma_ch
   return c;
 }
 
-// DMA handler called when each phase of a frame timing is finished.
-static void field_timing_dma_handler() {
+// Frame buffers in flash are read through the XIP alias which neither looks up nor allocates in the
+// XIP cache. A frame is four times the size of the cache and is read once per field, so caching it
+// would only evict code and data in exchange for no hits at all.
+static inline uintptr_t scanout_address(const void *frame_buffer) {
+  uintptr_t address = (uintptr_t)frame_buffer;
+  if ((address >= XIP_BASE) && (address < XIP_CTRL_BASE)) {
+    address = XIP_NOCACHE_NOALLOC_BASE + (address & (XIP_NOALLOC_BASE - XIP_BASE - 1));
+  }
+  return address;
+}
+
+// Source of a visible line showing row band_row of a band. For a line of text it's the row of
+// characters, and the line's band and glyph row are set.
+static uintptr_t HOTPATH_FUNC(band_source)(uint line, uint band_index, uint band_row) {
+  const tvout_band_t *band = &scanout_display_list[band_index];
+  uint source_rows = (band->source_rows != 0) ? band->source_rows : band->rows;
+  uint row = (band->scroll + band_row) % source_rows;
+  switch (band->mode) {
+  case TVOUT_BAND_BITMAP:
+    return scanout_address(band->source) + (row * band->increment);
+  case TVOUT_BAND_REPEAT:
+    return scanout_address(band->source);
+  case TVOUT_BAND_TEXT:
+    line_band[line] = band_index;
+    line_glyph_row[line] = row % band->font->height;
+    return (uintptr_t)band->source + ((row / band->font->height) * band->increment);
+  default:
+    return (uintptr_t)blank_row;
+  }
+}
+
+// Work out what each visible line shows, from the test pattern or display list if there is one,
+// and point it at that. Lines built by the CPU, every line if staged and otherwise those of text,
+// take turns in the two line buffers instead.
+static void HOTPATH_FUNC(build_line_table)(uintptr_t frame_buffer, bool staged) {
+  uint stride = window_width >> 3;
+  uint window_lines = window_height << mode->line_shift;
+  uint band = 0, band_start = 0;
+  bool built_lines = staged;
+  for (uint line = 0; line < visible_lines; line++) {
+    // Wraps around for lines above the window.
+    uint window_line = line - border_lines;
+    uint row = window_line >> mode->line_shift;
+    line_band[line] = NO_BAND;
+    if (window_line >= window_lines) {
+      line_source[line] = (uintptr_t)border_row;
+    } else if (scanout_test_pattern != TVOUT_PATTERN_NONE) {
+      line_source[line] = (uintptr_t)pattern_rows + (pattern_row_index[row] * stride);
+    } else if (scanout_display_list_count != 0) {
+      while ((band < scanout_display_list_count) &&
+             (row >= band_start + scanout_display_list[band].rows)) {
+        band_start += scanout_display_list[band++].rows;
+      }
+      line_source[line] = (band < scanout_display_list_count)
+                              ? band_source(line, band, row - band_start)
+                              : (uintptr_t)blank_row;
+    } else {
+      line_source[line] = frame_buffer + (row * stride);
+    }
+    bool built = staged || (line_band[line] != NO_BAND);
+    line_table[line] = built ? (uintptr_t)line_buffer[line & 1] : line_source[line];
+    built_lines |= built;
+  }
+  line_table[visible_lines] = 0;
+  line_table_frame_buffer =
+      ((scanout_test_pattern != TVOUT_PATTERN_NONE) || (scanout_display_list_count != 0))
+          ? 0
+          : frame_buffer;
+  line_table_staged = staged;
+  line_table_built_lines = built_lines;
+}
+
+// True if the CPU builds a visible line into its line buffer.
+static inline bool line_is_built(uint line) {
+  return line_table[line] == (uintptr_t)line_buffer[line & 1];
+}
+
+// Clock of the video output program in the current mode.
+static uint32_t video_output_clock_hz(void) {
+  if (mode->colour) {
+    return colour_sample_hz(colour_standard);
+  }
+  return ((uint64_t)mode->width * (mode->fast ? 1 : 2) * 1000000000) / VISIBLE_WIDTH_NS;
+}
+
+// Clock of the line timing program in the current mode. In the colour modes it runs at the sample
+// clock so that the subcarrier phase at the start of each line is known exactly.
+static uint32_t line_timing_clock_hz(void) {
+  return mode->colour ? colour_sample_hz(colour_standard) : LINE_TIMING_CLOCK_FREQ;
+}
+
+// Set a PIO state machine's clock divider as close to sys_hz / target_hz as its 8 fractional bits
+// allow. Returns the divider in 256ths.
+static uint32_t set_pio_clock(uint sm, uint32_t sys_hz, uint32_t target_hz) {
+  uint32_t divider_256 = ((((uint64_t)sys_hz) << 8) + (target_hz >> 1)) / target_hz;
+  pio_sm_set_clkdiv_int_frac(pio_instance, sm, divider_256 >> 8, divider_256 & 0xff);
+  return divider_256;
+}
+
+// Convert a line, or half line, of states into TIMING_LINES copies of it in a line timing program,
+// in cycles of a line timing clock of period tick_ns. Rounding to whole cycles loses up to a cycle
+// per state, so rather than rounding each state, the end of each state is rounded from the start of
+// its line and the start of each line from the start of the program, Bresenham style. The states
+// of every line then fall in the same place relative to its sync pulse and only the length of the
+// last state varies by a cycle, so that on average the line period is exact.
+static void build_timing_program(uint32_t *program, const timing_state_t *states, uint count,
+                                 double tick_ns) {
+  uint32_t period_ns = 0;
+  for (uint i = 0; i < count; i++) {
+    period_ns += states[i].ns;
+  }
+  uint32_t line_start = 0;
+  for (uint line = 1; line <= TIMING_LINES; line++) {
+    uint32_t line_end = (uint32_t)(((double)line * period_ns) / tick_ns + 0.5);
+    uint32_t state_start = 0, state_end_ns = 0;
+    for (uint i = 0; i < count; i++) {
+      state_end_ns += states[i].ns;
+      uint32_t state_end = (i + 1 < count) ? (uint32_t)(state_end_ns / tick_ns + 0.5)
+                                           : line_end - line_start;
+      *program++ =
+          line_timing_encode(states[i].sync, state_end - state_start, states[i].side_effect);
+      state_start = state_end;
+    }
+    line_start = line_end;
+  }
+}
+
+// Build the blank and sync timing programs, or copy those generated at compile time if the line
+// timing clock is nominal.
+static void build_blank_lines(double tick_ns, bool nominal) {
+  if (nominal) {
+    memcpy(timing_blank_line, timing_blank_line_nominal, sizeof(timing_blank_line));
+    memcpy(timing_long_sync_half_line, timing_long_sync_half_line_nominal,
+           sizeof(timing_long_sync_half_line));
+    memcpy(timing_short_sync_half_line, timing_short_sync_half_line_nominal,
+           sizeof(timing_short_sync_half_line));
+    return;
+  }
+  build_timing_program(timing_blank_line, timing_blank_line_states, TIMING_BLANK_LINE_STATES,
+                       tick_ns);
+  build_timing_program(timing_long_sync_half_line, timing_long_sync_half_line_states,
+                       TIMING_LONG_SYNC_HALF_LINE_STATES, tick_ns);
+  build_timing_program(timing_short_sync_half_line, timing_short_sync_half_line_states,
+                       TIMING_SHORT_SYNC_HALF_LINE_STATES, tick_ns);
+}
+
+// Build the visible line timing program for the mode. video_output counts out the left and right
+// borders itself but video_output_fast can't, so for it the trigger is delayed by the left border
+// instead and the line starts and ends with the side effects which restart it and blank its output.
+// window_ns is how long the window actually takes at the chosen video output clock.
+static void build_visible_line(uint window_ns, double tick_ns, bool nominal) {
+  if (mode->colour) {
+    build_timing_program(timing_visible_line, timing_visible_line_colour_states,
+                         TIMING_VISIBLE_LINE_STATES, tick_ns);
+    return;
+  }
+  uint border_ns = 0;
+  if (mode->fast && (window_ns < VISIBLE_WIDTH_NS)) {
+    border_ns = (VISIBLE_WIDTH_NS - window_ns) / 2;
+  }
+  if (nominal && (border_ns == 0)) {
+    memcpy(timing_visible_line,
+           mode->fast ? timing_visible_line_fast_nominal : timing_visible_line_nominal,
+           sizeof(timing_visible_line));
+    return;
+  }
+  timing_state_t visible_line[TIMING_VISIBLE_LINE_STATES];
+  memcpy(visible_line, mode->fast ? timing_visible_line_fast_states : timing_visible_line_states,
+         sizeof(visible_line));
+  visible_line[1].ns += border_ns;
+  visible_line[2].ns -= 2 * border_ns;
+  visible_line[3].ns += border_ns;
+  build_timing_program(timing_visible_line, visible_line, TIMING_VISIBLE_LINE_STATES, tick_ns);
+}
+
+// Number of address bits wrapped by DMA ring mode for a timing program of the given size in bytes.
+static inline uint ring_bits(size_t size) { return __builtin_ctz(size); }
+
+// Line timing clock cycles taken by count lines, or half lines, of a timing program of states
+// states a line, starting from its line first and read in ring mode.
+static uint32_t timing_program_cycles(const uint32_t *program, uint states, uint first,
+                                      uint count) {
+  uint32_t cycles = 0;
+  for (uint i = first * states; i < (first + count) * states; i++) {
+    cycles += line_timing_cycles(program[i % (states * TIMING_LINES)]);
+  }
+  return cycles;
+}
+
+// Line timing clock cycles taken by a whole field, as timed by field_timing_dma_handler().
+static uint32_t field_timing_cycles(void) {
+  uint bottom_line = first_visible_line + visible_lines;
+  return timing_program_cycles(timing_long_sync_half_line, TIMING_LONG_SYNC_HALF_LINE_STATES, 0,
+                               VSYNC_LINES_PER_FIELD) +
+         timing_program_cycles(timing_short_sync_half_line, TIMING_SHORT_SYNC_HALF_LINE_STATES,
+                               VSYNC_LINES_PER_FIELD, VSYNC_LINES_PER_FIELD) +
+         timing_program_cycles(timing_blank_line, TIMING_BLANK_LINE_STATES, VSYNC_LINES_PER_FIELD,
+                               first_visible_line - VSYNC_LINES_PER_FIELD) +
+         timing_program_cycles(timing_visible_line, TIMING_VISIBLE_LINE_STATES, first_visible_line,
+                               visible_lines) +
+         timing_program_cycles(timing_blank_line, TIMING_BLANK_LINE_STATES, bottom_line,
+                               LINES_PER_FIELD - bottom_line);
+}
+
+// Lay out the colour line buffers for a sample clock of period sample_ns, with the picture centred
+// in the visible area, and work out the subcarrier phase at the trigger of each visible line. The
+// line timing program runs at the sample clock, so the trigger is a whole number of samples from
+// the start of the field, as counted by the timing programs. Each word of a line buffer is four
+// samples, so every word starts at the same phase as the line.
+static void build_colour_lines(double sample_ns) {
+  int picture_ns = (int)((window_width << 1) * sample_ns);
+  int start_ns = (LINE_PERIOD_NS - FRONT_PORCH_WIDTH_NS - VISIBLE_WIDTH_NS) +
+                 ((VISIBLE_WIDTH_NS - picture_ns) / 2);
+  colour_prefix_words = (uint)((start_ns - COLOUR_BURST_START_NS) / sample_ns) / COLOUR_PHASES;
+  colour_line_words = colour_prefix_words + (window_width >> 1) + 1;
+  for (uint i = 0; i < LINE_BUFFER_WORDS; i++) {
+    line_buffer[0][i] = colour_patterns.blank;
+    line_buffer[1][i] = colour_patterns.blank;
+  }
+
+  uint32_t samples =
+      timing_program_cycles(timing_long_sync_half_line, TIMING_LONG_SYNC_HALF_LINE_STATES, 0,
+                            VSYNC_LINES_PER_FIELD) +
+      timing_program_cycles(timing_short_sync_half_line, TIMING_SHORT_SYNC_HALF_LINE_STATES,
+                            VSYNC_LINES_PER_FIELD, VSYNC_LINES_PER_FIELD) +
+      timing_program_cycles(timing_blank_line, TIMING_BLANK_LINE_STATES, VSYNC_LINES_PER_FIELD,
+                            first_visible_line - VSYNC_LINES_PER_FIELD);
+  for (uint line = 0; line < visible_lines; line++) {
+    colour_line_phase[line] = samples % COLOUR_PHASES;
+    samples += timing_program_cycles(timing_visible_line, TIMING_VISIBLE_LINE_STATES,
+                                     first_visible_line + line, 1);
+  }
+  colour_field_samples = field_timing_cycles();
+  colour_field_phase = 0;
+}
+
+// Encode a visible line of the colour frame buffer into its line buffer at the subcarrier phase of
+// its trigger. Each byte is two pixels, the left one in the high nibble, and each pixel is half a
+// subcarrier cycle of its colour's samples.
+static void HOTPATH_FUNC(encode_colour_line)(uint line) {
+  uint phase = (colour_line_phase[line] + colour_field_phase) % COLOUR_PHASES;
+  uint v_switch = line & 1;
+  uint32_t *out = line_buffer[line & 1];
+  uint32_t burst = colour_patterns.burst[v_switch][phase];
+  for (uint i = 0; i < colour_burst_cycles(colour_standard); i++) {
+    out[i] = burst;
+  }
+
+  const uint32_t *pixel = colour_patterns.pixel[v_switch][phase];
+  uint stride = window_width >> 1;
+  const uint8_t *row = (const uint8_t *)atomic_load(&scanout_frame_buffer_ptr) +
+                       ((line >> mode->line_shift) * stride);
+  out += colour_prefix_words;
+  for (uint i = 0; i < stride; i++) {
+    uint pixels = row[i ^ frame_buffer_byte_swap];
+    *out++ = (pixel[pixels >> 4] & 0xffff0000) | (pixel[pixels & 0xf] & 0xffff);
+  }
+}
+
+// Draw the sprites on a row of the window over its line buffer, out, of words words. Sprites are
+// in pixel order, so in the line buffer's order they're byte swapped if DMA swaps them back.
+static void HOTPATH_FUNC(draw_sprites)(uint32_t *out, uint row, uint words) {
+  const tvout_sprite_t *on_row[TVOUT_SPRITES_PER_LINE];
+  uint count = 0;
+  for (uint i = 0; i < scanout_sprite_count; i++) {
+    const tvout_sprite_t *sprite = &scanout_sprites[i];
+    if ((uint)((int)row - sprite->y) < sprite->height) {
+      if (count == TVOUT_SPRITES_PER_LINE) {
+        line_stats.dropped_sprites++;
+        continue;
+      }
+      on_row[count++] = sprite;
+    }
+  }
+
+  // The first sprite in the list is drawn last, so that it's on top.
+  while (count > 0) {
+    const tvout_sprite_t *sprite = on_row[--count];
+    uint sprite_row = row - sprite->y;
+    uint32_t bits = sprite->bitmap[sprite_row];
+    uint32_t mask = (sprite->mask != NULL) ? sprite->mask[sprite_row] : bits;
+    int word = sprite->x >> 5;
+    uint shift = sprite->x & 0x1f;
+    uint32_t halves[2][2] = {{bits >> shift, mask >> shift}, {0, 0}};
+    if (shift != 0) {
+      halves[1][0] = bits << (32 - shift);
+      halves[1][1] = mask << (32 - shift);
+    }
+    for (uint i = 0; i < 2; i++, word++) {
+      if ((uint)word < words) {
+        uint32_t below = frame_buffer_byte_swap ? out[word] : __builtin_bswap32(out[word]);
+        below = (below & ~halves[i][1]) | (halves[i][0] & halves[i][1]);
+        out[word] = frame_buffer_byte_swap ? below : __builtin_bswap32(below);
+      }
+    }
+  }
+}
+
+// Draw a line of a text band into its line buffer, out, of words words. Each character is a byte
+// of its glyph's row, placed where DMA reads the frame buffer's bytes from.
+static void HOTPATH_FUNC(draw_text_line)(uint32_t *out, uint line, uint words) {
+  const font_t *font = scanout_display_list[line_band[line]].font;
+  const uint8_t *chars = (const uint8_t *)line_source[line];
+  const uint8_t *glyphs = font->ascii;
+  uint glyph_step;
+  if (font->layout == FONT_LAYOUT_INTERLEAVED) {
+    glyphs += line_glyph_row[line] * FONT_ASCII_COUNT;
+    glyph_step = 1;
+  } else {
+    glyphs += line_glyph_row[line];
+    glyph_step = font->height;
+  }
+  uint8_t *bytes = (uint8_t *)out;
+  for (uint i = 0; i < (words << 2); i++) {
+    uint glyph = chars[i] - FONT_ASCII_FIRST;
+    bytes[i ^ frame_buffer_byte_swap] = (glyph < FONT_ASCII_COUNT) ? glyphs[glyph * glyph_step] : 0;
+  }
+}
+
+// Merge a visible line of the layer into its line buffer with what the line shows, if there is a
+// layer, and draw the sprites over it. Lines of text are drawn into the line buffer first. Lines of
+// white border are copied from border_row.
+static void HOTPATH_FUNC(compose_line)(uint line) {
+  uint32_t *out = line_buffer[line & 1];
+  uint words = window_width >> 5;
+  uint window_line = line - border_lines;
+  if (window_line >= (window_height << mode->line_shift)) {
+    memcpy(out, border_row, words * sizeof(uint32_t));
+    return;
+  }
+
+  const uint32_t *below = (const uint32_t *)line_source[line];
+  if (line_band[line] != NO_BAND) {
+    draw_text_line(out, line, words);
+    below = out;
+  }
+  uint row = window_line >> mode->line_shift;
+  uint layer_row = (row + scanout_layer_origin) % scanout_layer_rows;
+  const uint32_t *above = (const uint32_t *)scanout_layer + (layer_row * words);
+  switch (scanout_layer_blend) {
+  case TVOUT_BLEND_NONE:
+    if (below != out) {
+      memcpy(out, below, words * sizeof(uint32_t));
+    }
+    break;
+  case TVOUT_BLEND_OR:
+    for (uint i = 0; i < words; i++) {
+      out[i] = below[i] | above[i];
+    }
+    break;
+  case TVOUT_BLEND_XOR:
+    for (uint i = 0; i < words; i++) {
+      out[i] = below[i] ^ above[i];
+    }
+    break;
+  case TVOUT_BLEND_MASK:
+    for (uint i = 0; i < words; i++) {
+      out[i] = below[i] & ~above[i];
+    }
+    break;
+  }
+  draw_sprites(out, row, words);
+}
+
+// Build a visible line into its line buffer.
+static void HOTPATH_FUNC(build_staged_line)(uint line) {
+  if (mode->colour) {
+    encode_colour_line(line);
+  } else {
+    compose_line(line);
+  }
+}
+
+// DMA handler called when each line buffer has been read, from when its line is scanned out until
+// the start of the next. It builds the line after next into the buffer. The line is late if DMA
+// has finished reading the next line, and so started on this one, before it's built.
+static void HOTPATH_ISR(line_dma_handler)() {
+  dma_channel_acknowledge_irq1(video_dma_channel);
+  uint line = next_staged_line++ + 2;
+  if ((line < visible_lines) && line_is_built(line)) {
+    build_staged_line(line);
+    line_stats.lines++;
+    if (dma_channel_get_irq1_status(video_dma_channel)) {
+      line_stats.late_lines++;
+    }
+  }
+}
+
+// Start the field timing DMA on count lines, or half lines, of a timing program of size bytes and
+// states states a line, which begin line first of the field. Rather than restarting the program,
+// each phase carries on from the line it would have reached had the whole field been timed by it,
+// so that the rounding spread over the program's lines isn't lost at each phase boundary. Blank and
+// visible lines are the same length, as are the two kinds of sync half line, so each of those
+// pairs times its lines as a single program would.
+static __force_inline void start_timing_phase(const uint32_t *program, size_t size, uint states,
+                                              uint first, uint count) {
+  channel_config_set_ring(&field_timing_dma_channel_config, false, ring_bits(size));
+  dma_channel_set_config(field_timing_dma_channel, &field_timing_dma_channel_config, false);
+  dma_channel_transfer_from_buffer_now(field_timing_dma_channel,
+                                       program + ((first % TIMING_LINES) * states), states * count);
+}
+
+// DMA handler called when each phase of a frame timing is finished. It runs from SRAM, see
+// hotpath.h.
+static void HOTPATH_ISR(field_timing_dma_handler)() {
   // 0 - vsync A, 1 - vsync B, 2 - top blank lines, 3 - visible lines, 4 - bottom blank lines
   static uint phase = 0;
 
@@ -126,46 +661,73 @@ static void field_timing_dma_handler() {
 
   switch (phase) {
   case 0:
+    // "long pulse" half lines, started first so that they go out while the line table is built.
+    start_timing_phase(timing_long_sync_half_line, sizeof(timing_long_sync_half_line),
+                       TIMING_LONG_SYNC_HALF_LINE_STATES, 0, VSYNC_LINES_PER_FIELD);
+
     // Start frame buffer transfer for the next field.
-    dma_channel_transfer_from_buffer_now(video_dma_channel, (void *)atomic_load(&frame_buffer_ptr),
-                                         VISIBLE_LINES_PER_FIELD * (VISIBLE_DOTS_PER_LINE >> 5));
-    // "long pulse" half lines
-    channel_config_set_ring(&field_timing_dma_channel_config, false, 3);
-    dma_channel_set_config(field_timing_dma_channel, &field_timing_dma_channel_config, false);
-    dma_channel_transfer_from_buffer_now(field_timing_dma_channel, timing_long_sync_half_line,
-                                         TIMING_LONG_SYNC_HALF_LINE_LEN * VSYNC_LINES_PER_FIELD);
+    uintptr_t frame_buffer = atomic_load(&frame_buffer_ptr);
+    atomic_store(&scanout_frame_buffer_ptr, frame_buffer);
+    scanout_layer = atomic_load(&layer_ptr);
+    scanout_layer_blend = atomic_load(&layer_blend);
+    scanout_layer_origin = atomic_load(&layer_origin);
+    scanout_layer_rows = atomic_load(&layer_rows);
+    if (scanout_layer_rows == 0) {
+      scanout_layer_rows = window_height;
+    }
+    scanout_sprites = (const tvout_sprite_t *)atomic_load(&sprites_ptr);
+    scanout_sprite_count = atomic_load(&sprite_count);
+    scanout_display_list = (const tvout_band_t *)atomic_load(&display_list_ptr);
+    scanout_display_list_count = mode->colour ? 0 : atomic_load(&display_list_count);
+    scanout_test_pattern = mode->colour ? TVOUT_PATTERN_NONE : atomic_load(&test_pattern);
+    bool staged = mode->colour || (scanout_layer_blend != TVOUT_BLEND_NONE) ||
+                  (scanout_sprite_count != 0);
+    // A display list is rebuilt every field as its bands may have been scrolled, and a test
+    // pattern as it may have been changed.
+    if ((scanout_display_list_count != 0) || (scanout_test_pattern != TVOUT_PATTERN_NONE) ||
+        (frame_buffer != line_table_frame_buffer) || (staged != line_table_staged)) {
+      build_line_table(frame_buffer, staged);
+    }
+    dma_channel_set_irq1_enabled(video_dma_channel, line_table_built_lines);
+    if (mode->colour) {
+      colour_field_phase = (colour_field_phase + colour_field_samples) % COLOUR_PHASES;
+    }
+    if (mode->fast) {
+      // The restart channel starts the line channel once per line.
+      dma_channel_set_read_addr(line_dma_channel, line_table, false);
+    } else {
+      dma_channel_transfer_from_buffer_now(line_dma_channel, line_table, 1);
+    }
     break;
   case 1:
     // "short pulse" half lines
-    channel_config_set_ring(&field_timing_dma_channel_config, false, 3);
-    dma_channel_set_config(field_timing_dma_channel, &field_timing_dma_channel_config, false);
-    dma_channel_transfer_from_buffer_now(field_timing_dma_channel, timing_short_sync_half_line,
-                                         TIMING_SHORT_SYNC_HALF_LINE_LEN * VSYNC_LINES_PER_FIELD);
+    start_timing_phase(timing_short_sync_half_line, sizeof(timing_short_sync_half_line),
+                       TIMING_SHORT_SYNC_HALF_LINE_STATES, VSYNC_LINES_PER_FIELD,
+                       VSYNC_LINES_PER_FIELD);
     break;
   case 2:
-    // Top blank lines
-    channel_config_set_ring(&field_timing_dma_channel_config, false, 3);
-    dma_channel_set_config(field_timing_dma_channel, &field_timing_dma_channel_config, false);
-    dma_channel_transfer_from_buffer_now(field_timing_dma_channel, timing_blank_line,
-                                         TIMING_BLANK_LINE_LEN *
-                                             (VERT_VISIBLE_START_LINE - VSYNC_LINES_PER_FIELD));
+    // Build the first two lines while the top blank lines go out.
+    next_staged_line = 0;
+    for (uint line = 0; line < MIN(visible_lines, 2); line++) {
+      if (line_is_built(line)) {
+        build_staged_line(line);
+      }
+    }
 
+    // Top blank lines
+    start_timing_phase(timing_blank_line, sizeof(timing_blank_line), TIMING_BLANK_LINE_STATES,
+                       VSYNC_LINES_PER_FIELD, first_visible_line - VSYNC_LINES_PER_FIELD);
     break;
   case 3:
     // Visible lines
-    channel_config_set_ring(&field_timing_dma_channel_config, false, 4);
-    dma_channel_set_config(field_timing_dma_channel, &field_timing_dma_channel_config, false);
-    dma_channel_transfer_from_buffer_now(field_timing_dma_channel, timing_visible_line,
-                                         TIMING_VISIBLE_LINE_LEN * VISIBLE_LINES_PER_FIELD);
+    start_timing_phase(timing_visible_line, sizeof(timing_visible_line),
+                       TIMING_VISIBLE_LINE_STATES, first_visible_line, visible_lines);
     break;
   case 4:
     // Bottom blank lines
-    channel_config_set_ring(&field_timing_dma_channel_config, false, 3);
-    dma_channel_set_config(field_timing_dma_channel, &field_timing_dma_channel_config, false);
-    dma_channel_transfer_from_buffer_now(
-        field_timing_dma_channel, timing_blank_line,
-        TIMING_BLANK_LINE_LEN *
-            (LINES_PER_FIELD - VERT_VISIBLE_START_LINE - VISIBLE_LINES_PER_FIELD));
+    start_timing_phase(timing_blank_line, sizeof(timing_blank_line), TIMING_BLANK_LINE_STATES,
+                       first_visible_line + visible_lines,
+                       LINES_PER_FIELD - first_visible_line - visible_lines);
 
     // Release the vblank semaphore which will wake anything waiting on it.
     sem_release(&vblank_semaphore);
@@ -183,44 +745,50 @@ static void field_timing_dma_handler() {
 // This function contains all static asserts. It's never called but the compiler will raise a
 // diagnostic if the assertions fail.
 static inline void all_static_asserts() {
-  // Check that the number of *visible* dots per line is a multiple of 32.
+  // Check that the number of *visible* dots per line is a multiple of 32, as is the width of every
+  // mode so that lines are whole words.
   static_assert((VISIBLE_DOTS_PER_LINE & 0x1f) == 0);
+  static_assert(((VISIBLE_DOTS_PER_LINE >> 1) & 0x1f) == 0);
+  static_assert((MAX_VISIBLE_DOTS_PER_LINE & 0x1f) == 0);
 
   // Check that the number of *visible* lines per field is a multiple of 8.
   static_assert((VISIBLE_LINES_PER_FIELD & 0x7) == 0);
 
-  // Statically assert alignment and length of timing programs. Alignment is necessary to allow DMA
-  // in ring mode and the length needs to be known because we need to set the number of significan
-  // bits in ring mode.
-  static_assert(alignof(timing_long_sync_half_line) == sizeof(timing_long_sync_half_line));
-  static_assert(TIMING_LONG_SYNC_HALF_LINE_LEN == 2);
-  static_assert(alignof(timing_short_sync_half_line) == sizeof(timing_short_sync_half_line));
-  static_assert(TIMING_SHORT_SYNC_HALF_LINE_LEN == 2);
-  static_assert(alignof(timing_blank_line) == sizeof(timing_blank_line));
-  static_assert(TIMING_BLANK_LINE_LEN == 2);
-  static_assert(alignof(timing_visible_line) == sizeof(timing_visible_line));
-  static_assert(TIMING_VISIBLE_LINE_LEN == 4);
-  static_assert(VERT_VISIBLE_START_LINE > VSYNC_LINES_PER_FIELD);
-  static_assert(LINES_PER_FIELD > (VERT_VISIBLE_START_LINE + VISIBLE_LINES_PER_FIELD));
+  // The public colour encodings are the colour module's.
+  static_assert((int)TVOUT_COLOUR_PAL == (int)COLOUR_PAL);
+  static_assert((int)TVOUT_COLOUR_NTSC == (int)COLOUR_NTSC);
+
+  // The public test patterns are the test pattern module's.
+  static_assert((int)TVOUT_PATTERN_NONE == (int)TESTPATTERN_NONE);
+  static_assert((int)TVOUT_PATTERN_SAFE_AREA == (int)TESTPATTERN_SAFE_AREA);
+
+  // The timing programs themselves are checked where they're generated, in tvout_timing.cpp.
 }
 
 void tvout_init(PIO pio, bool byte_oriented_frame_buffer, uint sync_pin, uint video_pin) {
   // Record which PIO instance is used.
   pio_instance = pio;
 
+  // DMA reads a word-oriented frame buffer a word at a time, so its first byte in memory is the
+  // last one shown of each word.
+  frame_buffer_byte_swap = byte_oriented_frame_buffer ? 0 : 3;
+  tvout_set_palette(colour_default_palette);
+
   // Ensure IRQ 4 of the PIO is clear
   pio_interrupt_clear(pio_instance, 4);
 
-  // Configure and enable output program
+  // Load both output programs. tvout_start() runs the one for the mode.
+  video_output_pin = video_pin;
+  video_output_fast_offset = pio_add_program(pio_instance, &video_output_fast_program);
   video_output_offset = pio_add_program(pio_instance, &video_output_program);
   video_output_sm = pio_claim_unused_sm(pio_instance, true);
-  video_output_program_init(pio_instance, video_output_sm, video_output_offset, video_pin,
-                            DOT_CLOCK_FREQ);
 
   // Configure and enable timing program.
   line_timing_offset = pio_add_program(pio_instance, &line_timing_program);
   line_timing_sm = pio_claim_unused_sm(pio_instance, true);
-  line_timing_program_init(pio_instance, line_timing_sm, line_timing_offset, sync_pin);
+  line_timing_program_init(pio_instance, line_timing_sm, line_timing_offset, sync_pin, video_pin);
+
+  memset(border_row, 0xff, sizeof(border_row));
 
   // Configure frame timing DMA channel.
   field_timing_dma_channel = dma_claim_unused_channel(true);
@@ -231,29 +799,178 @@ void tvout_init(PIO pio, bool byte_oriented_frame_buffer, uint sync_pin, uint vi
 
   // Configure DMA channel for copying frame buffer to video output.
   video_dma_channel = dma_claim_unused_channel(true);
-  dma_channel_config video_dma_channel_config = get_video_output_dma_channel_config(
+  line_dma_channel = dma_claim_unused_channel(true);
+  video_dma_channel_config = get_video_output_dma_channel_config(
       video_dma_channel, pio_instance, video_output_sm, byte_oriented_frame_buffer);
   dma_channel_set_config(video_dma_channel, &video_dma_channel_config, false);
   dma_channel_set_write_addr(video_dma_channel, &pio_instance->txf[video_output_sm], false);
 
-  // Enable interrupt handler for field timing.
+  // Configure DMA channel for starting each line.
+  dma_channel_config line_dma_channel_config = get_line_dma_channel_config(line_dma_channel);
+  dma_channel_set_config(line_dma_channel, &line_dma_channel_config, false);
+  dma_channel_set_write_addr(line_dma_channel, &dma_hw->ch[video_dma_channel].al3_read_addr_trig,
+                             false);
+
+  // Configure DMA channel for restarting video_output_fast.
+  restart_dma_channel = dma_claim_unused_channel(true);
+  dma_channel_config restart_dma_channel_config =
+      get_restart_dma_channel_config(restart_dma_channel, pio_instance, line_timing_sm);
+  channel_config_set_chain_to(&restart_dma_channel_config, line_dma_channel);
+  dma_channel_configure(restart_dma_channel, &restart_dma_channel_config,
+                        &pio_instance->sm[video_output_sm].instr,
+                        &pio_instance->rxf[line_timing_sm], 1, false);
+
+  // Give DMA priority over the processors at the bus arbiters so that scanout is never held up by
+  // heavy drawing. DMA moves one word every 32 dots, so the processors lose very little.
+  bus_ctrl_hw->priority = BUSCTRL_BUS_PRIORITY_DMA_R_BITS | BUSCTRL_BUS_PRIORITY_DMA_W_BITS;
+
+  // Enable interrupt handler for field timing, and the one for lines built by the CPU.
   irq_set_exclusive_handler(DMA_IRQ_0, field_timing_dma_handler);
+  irq_set_exclusive_handler(DMA_IRQ_1, line_dma_handler);
+}
+
+void tvout_set_mode(tvout_mode_t m) {
+  mode = &modes[m];
+  tvout_set_viewport(mode->width, mode->height, TVOUT_BORDER_BLACK);
+}
+
+void tvout_set_viewport(uint width, uint height, tvout_border_t b) {
+  window_width = MAX(MIN(width, mode->width) & ~0x1f, 32);
+  window_height = MAX(MIN(height, mode->height), 1);
+  border = mode->colour ? TVOUT_BORDER_BLACK : b;
+
+  // Centre the window vertically with whole lines of border.
+  uint window_lines = window_height << mode->line_shift;
+  uint top_lines = (VISIBLE_LINES_PER_FIELD - window_lines) >> 1;
+  if (border == TVOUT_BORDER_WHITE) {
+    first_visible_line = VERT_VISIBLE_START_LINE;
+    visible_lines = VISIBLE_LINES_PER_FIELD;
+    border_lines = top_lines;
+  } else {
+    first_visible_line = VERT_VISIBLE_START_LINE + top_lines;
+    visible_lines = window_lines;
+    border_lines = 0;
+  }
+  line_table[0] = 0;
+  line_table_frame_buffer = 0;
+}
+
+void tvout_set_colour(tvout_colour_t encoding, uint dac_bits) {
+  colour_standard = (colour_standard_t)encoding;
+  colour_dac_bits = MAX(MIN(dac_bits, 8), 1);
+  tvout_set_palette(colour_palette);
+}
+
+void tvout_set_palette(const uint32_t *palette) {
+  memmove(colour_palette, palette, sizeof(colour_palette));
+  colour_encode(colour_standard, colour_dac_bits, colour_palette, &colour_patterns);
+}
+
+void tvout_set_clock(tvout_clock_t policy) {
+  if (policy == TVOUT_CLOCK_EXACT) {
+    clockplan_target_t targets[] = {
+        {line_timing_clock_hz(),
+         mode->colour ? COLOUR_TOLERANCE_PPM : LINE_TIMING_TOLERANCE_PPM},
+        {video_output_clock_hz(),
+         mode->colour ? COLOUR_TOLERANCE_PPM : VIDEO_OUTPUT_TOLERANCE_PPM},
+    };
+    clockplan_t plan;
+    if (clockplan_search(targets, count_of(targets), MIN_SYS_CLOCK_HZ, MAX_SYS_CLOCK_HZ, &plan) &&
+        (plan.sys_hz != clock_get_hz(clk_sys))) {
+      set_sys_clock_pll(plan.vco_hz, plan.postdiv1, plan.postdiv2);
+    }
+  }
 }
 
 void tvout_start(void) {
   sem_init(&vblank_semaphore, 0, 1);
 
-  pio_sm_put(pio_instance, video_output_sm, VISIBLE_DOTS_PER_LINE - 1);
-  pio_sm_set_enabled(pio_instance, video_output_sm, true);
-  pio_sm_set_enabled(pio_instance, line_timing_sm, true);
+  // Pixels are spread across the visible width, so narrower modes clock the output program slower.
+  float pixel_freq = mode->width * (1e9 / VISIBLE_WIDTH_NS);
+  uint border_dots = (mode->width - window_width) >> 1;
+  if (mode->colour) {
+    // The DAC rests at the blanking level, with the sync pin pulling it down to sync.
+    uint32_t dac_mask = ((1u << colour_dac_bits) - 1) << video_output_pin;
+    video_output_colour_program_init(pio_instance, video_output_sm, video_output_fast_offset,
+                                     video_output_pin, colour_dac_bits, video_output_clock_hz());
+    pio_sm_set_pins_with_mask(pio_instance, video_output_sm,
+                              (colour_patterns.blank & 0xff) << video_output_pin, dac_mask);
+    // Line buffers of samples are built with the first sample in the MSB, the order the program
+    // shifts them out, whichever way round the frame buffer is.
+    channel_config_set_bswap(&video_dma_channel_config, false);
+  } else if (mode->fast) {
+    video_output_fast_program_init(pio_instance, video_output_sm, video_output_fast_offset,
+                                   video_output_pin, pixel_freq);
+  }
+  if (mode->fast) {
+    // Each line's data is fed only once the restart channel has restarted the program.
+    channel_config_set_chain_to(&video_dma_channel_config, restart_dma_channel);
+    dma_channel_set_trans_count(line_dma_channel, 1, false);
+    dma_channel_start(restart_dma_channel);
+  } else {
+    video_output_program_init(pio_instance, video_output_sm, video_output_offset,
+                              video_output_pin, pixel_freq);
+    // The video output program makes the left and right borders itself so that DMA only reads the
+    // window. Both are a multiple of 16 pixels, so at least the 2 the program needs.
+    video_output_program_set_border(pio_instance, video_output_offset,
+                                    (border_dots != 0) && (border == TVOUT_BORDER_WHITE));
+    pio_sm_put(pio_instance, video_output_sm, window_width - 1);
+    pio_sm_put(pio_instance, video_output_sm, (border_dots != 0) ? border_dots - 2 : 0);
+    channel_config_set_chain_to(&video_dma_channel_config, line_dma_channel);
+  }
+  dma_channel_set_config(video_dma_channel, &video_dma_channel_config, false);
+
+  // Replace the program's floating point clock dividers with the nearest the hardware has, and
+  // record how far they are from the ideal clocks. A fractional divider has a cycle of jitter.
+  uint32_t sys_hz = clock_get_hz(clk_sys);
+  uint32_t timing_divider = set_pio_clock(line_timing_sm, sys_hz, line_timing_clock_hz());
+  uint32_t video_divider = set_pio_clock(video_output_sm, sys_hz, video_output_clock_hz());
+  clock_info.sys_clock_hz = sys_hz;
+  clock_info.timing_divider = timing_divider / 256.0f;
+  clock_info.video_divider = video_divider / 256.0f;
+  clock_info.timing_error_ppm =
+      clockplan_error_ppm(sys_hz, timing_divider, line_timing_clock_hz());
+  clock_info.dot_error_ppm = clockplan_error_ppm(sys_hz, video_divider, video_output_clock_hz());
+  clock_info.jitter_ps = ((timing_divider | video_divider) & 0xff) ? (1000000000000 / sys_hz) : 0;
+
+  // Build the timing programs in cycles of the actual line timing clock.
+  double tick_ns = (timing_divider * 1e9) / ((double)sys_hz * 256);
+  bool nominal = ((uint64_t)timing_divider * 1000000000) ==
+                 ((uint64_t)sys_hz * 256 * LINE_TIMING_CLOCK_PERIOD_NS);
+  build_blank_lines(tick_ns, nominal);
+  build_visible_line(((uint64_t)window_width * (mode->fast ? 1 : 2) * video_divider * 1000000000) /
+                         ((uint64_t)sys_hz << 8),
+                     tick_ns, nominal);
+  uint32_t line_cycles =
+      timing_program_cycles(timing_blank_line, TIMING_BLANK_LINE_STATES, 0, TIMING_LINES);
+  clock_info.line_error_ppm =
+      (int32_t)(((LINE_PERIOD_NS * TIMING_LINES) / (line_cycles * tick_ns) - 1) * 1e6);
+  double field_ns = (double)LINE_PERIOD_NS * LINES_PER_FIELD;
+  clock_info.field_error_ppm = (int32_t)((field_ns / (field_timing_cycles() * tick_ns) - 1) * 1e6);
+  if (mode->colour) {
+    build_colour_lines(tick_ns);
+  }
+  dma_channel_set_trans_count(video_dma_channel,
+                              mode->colour ? colour_line_words : (window_width >> 5), false);
+
+  // Start both state machines with their clock dividers in step, so that in the colour modes the
+  // output program always starts a fixed number of samples after the trigger.
+  pio_enable_sm_mask_in_sync(pio_instance, (1u << video_output_sm) | (1u << line_timing_sm));
 
   // Start field timing.
+  irq_set_enabled(DMA_IRQ_1, true);
   irq_set_enabled(DMA_IRQ_0, true);
   field_timing_dma_handler();
 }
 
 void tvout_cleanup(void) {
   irq_set_enabled(DMA_IRQ_0, false);
+  irq_set_enabled(DMA_IRQ_1, false);
+  dma_channel_set_irq1_enabled(video_dma_channel, false);
+  dma_channel_cleanup(restart_dma_channel);
+  dma_channel_unclaim(restart_dma_channel);
+  dma_channel_cleanup(line_dma_channel);
+  dma_channel_unclaim(line_dma_channel);
   dma_channel_cleanup(video_dma_channel);
   dma_channel_unclaim(video_dma_channel);
   dma_channel_cleanup(field_timing_dma_channel);
@@ -261,6 +978,7 @@ void tvout_cleanup(void) {
 
   pio_sm_set_enabled(pio_instance, video_output_sm, false);
   pio_remove_program(pio_instance, &video_output_program, video_output_offset);
+  pio_remove_program(pio_instance, &video_output_fast_program, video_output_fast_offset);
   pio_sm_unclaim(pio_instance, video_output_sm);
   pio_sm_set_enabled(pio_instance, line_timing_sm, false);
   pio_remove_program(pio_instance, &line_timing_program, line_timing_offset);
@@ -269,12 +987,71 @@ void tvout_cleanup(void) {
 
 void tvout_set_vblank_callback(tvout_vblank_callback_t callback) { vblank_callback = callback; }
 
-uint tvout_get_screen_width(void) { return VISIBLE_DOTS_PER_LINE; }
+uint tvout_get_screen_width(void) { return window_width; }
+
+uint tvout_get_screen_height(void) { return window_height; }
+
+void tvout_get_clock_info(tvout_clock_info_t *info) { *info = clock_info; }
+
+uint tvout_get_field_period_us(void) { return (LINE_PERIOD_NS * LINES_PER_FIELD) / 1000; }
+
+void tvout_set_frame_buffer(const void *frame_buffer) {
+  atomic_store(&frame_buffer_ptr, scanout_address(frame_buffer));
+}
+
+void tvout_set_layer(const void *layer, tvout_blend_t blend) {
+  atomic_store(&layer_ptr, scanout_address(layer));
+  atomic_store(&layer_blend, (layer != NULL) ? blend : TVOUT_BLEND_NONE);
+}
+
+void tvout_set_layer_origin(uint row, uint rows) {
+  atomic_store(&layer_origin, row);
+  atomic_store(&layer_rows, rows);
+}
+
+void tvout_set_sprites(const tvout_sprite_t *sprites, uint count) {
+  atomic_store(&sprites_ptr, (uintptr_t)sprites);
+  atomic_store(&sprite_count, (sprites != NULL) ? MIN(count, TVOUT_MAX_SPRITES) : 0);
+}
 
-uint tvout_get_screen_height(void) { return VISIBLE_LINES_PER_FIELD; }
+void tvout_set_display_list(const tvout_band_t *bands, uint count) {
+  atomic_store(&display_list_ptr, (uintptr_t)bands);
+  atomic_store(&display_list_count, (bands != NULL) ? MIN(count, TVOUT_MAX_BANDS) : 0);
+}
 
-void tvout_set_frame_buffer(void *frame_buffer) {
-  atomic_store(&frame_buffer_ptr, (uintptr_t)frame_buffer);
+void tvout_set_test_pattern(tvout_pattern_t pattern) {
+  // Patterns are drawn in pixel order, so they're byte swapped if DMA swaps them back. A pattern
+  // which is already shown changes in place.
+  testpattern_draw_rows((testpattern_t)pattern, window_width, pattern_rows);
+  if (!frame_buffer_byte_swap) {
+    for (uint i = 0; i < TESTPATTERN_ROWS * (window_width >> 5); i++) {
+      pattern_rows[i] = __builtin_bswap32(pattern_rows[i]);
+    }
+  }
+  for (uint y = 0; y < window_height; y++) {
+    pattern_row_index[y] = testpattern_row((testpattern_t)pattern, window_height, y);
+  }
+  atomic_store(&test_pattern, pattern);
 }
 
-void tvout_wait_for_vblank(void) { sem_acquire_blocking(&vblank_semaphore); }
+void tvout_get_line_stats(tvout_line_stats_t *stats) {
+  stats->lines = line_stats.lines;
+  stats->late_lines = line_stats.late_lines;
+  stats->dropped_sprites = line_stats.dropped_sprites;
+}
+
+void tvout_wait_for_vblank(void) {
+  // Discard any release from a vblank which has already passed.
+  sem_reset(&vblank_semaphore, 0);
+  sem_acquire_blocking(&vblank_semaphore);
+}
+
+void tvout_flip(const void *frame_buffer) {
+  // A frame buffer set since the start of the current field has not been shown yet. Replacing it
+  // would drop it, so wait for it to be picked up first.
+  while (atomic_load(&frame_buffer_ptr) != atomic_load(&scanout_frame_buffer_ptr)) {
+    tight_loop_contents();
+  }
+  tvout_set_frame_buffer(frame_buffer);
+  tvout_wait_for_vblank();
+}
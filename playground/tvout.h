@@ -1,12 +1,17 @@
 #include "pico/types.h"
 #include "hardware/pio.h"
 
+#include "font.h"
+
 // Callback to be notified of video blanking period start.
 typedef void (*tvout_vblank_callback_t) (void);
 
-// TV-out uses two DMA channels claimed via dma_claim_unused_channel(), DMA IRQ 0, two PIO state
-// machines and IRQ for the PIO instance containing the state machines. Pass a PIO instance to
-// tvout_init() to specify which instance is used.
+// TV-out uses four DMA channels claimed via dma_claim_unused_channel(), DMA IRQ 0, DMA IRQ 1 in the
+// colour modes and with a layer or sprites, two PIO state machines and IRQ for the PIO instance
+// containing the state machines. Pass a PIO instance to tvout_init() to specify which instance is
+// used. Its instruction memory must be free from address 0, where the output program for the
+// widest and colour modes has to be. tvout_init() also gives all DMA priority over the processors
+// on the bus fabric.
 //
 // If big_endian_frame_buffer is true then the frame buffer is byte-oriented so that the MSB of the
 // first byte in memory is the top-left most pixel. If false then the frame buffer is word oriented
@@ -15,23 +20,229 @@ typedef void (*tvout_vblank_callback_t) (void);
 // *fourth* byte in memory.
 void tvout_init(PIO pio, bool byte_oriented_frame_buffer, uint sync_pin, uint video_pin);
 
+// Video modes. Every mode fills the screen. Narrower modes stretch each pixel over two dots and
+// shorter modes show each row of the frame buffer on two lines, so the frame buffer shrinks. Wider
+// modes have narrower pixels, which a TV may soften.
+typedef enum {
+  TVOUT_MODE_640X256,        // 20K frame buffer, the default
+  TVOUT_MODE_320X256,        // 10K
+  TVOUT_MODE_640X128,        // 10K
+  TVOUT_MODE_320X128,        // 5K
+  TVOUT_MODE_768X256,        // 24K
+  TVOUT_MODE_800X256,        // 25K
+  TVOUT_MODE_320X256_COLOUR, // 40K, 16 colours, see tvout_set_colour()
+} tvout_mode_t;
+
+// Select the video mode. Call between tvout_init() and tvout_start().
+void tvout_set_mode(tvout_mode_t mode);
+
+// Border colours for tvout_set_viewport().
+typedef enum {
+  TVOUT_BORDER_BLACK,
+  TVOUT_BORDER_WHITE,
+} tvout_border_t;
+
+// Show a frame buffer smaller than the mode's screen, e.g. 256x192, centred with a border around
+// it. Width and height are in pixels of the current mode. The width is rounded down to a multiple
+// of 32 and both are limited to the mode's size. DMA reads only the window: the video output
+// program makes the left and right borders and a black border above and below is made of blank
+// lines, while a white one repeats a single row. In the 768 and 800 pixel modes the left and right
+// borders are always black, and in the colour modes all of them are. Call between tvout_set_mode(),
+// which resets the viewport to the whole screen, and tvout_start().
+void tvout_set_viewport(uint width, uint height, tvout_border_t border);
+
+// Composite colour encodings for the colour modes.
+typedef enum {
+  TVOUT_COLOUR_PAL,
+  TVOUT_COLOUR_NTSC, // NTSC colour on the same 625 line timing, which multi-standard TVs accept
+} tvout_colour_t;
+
+// Configure the colour modes, PAL with a 4 bit DAC by default. They need a DAC of dac_bits pins, at
+// most 8, from the video pin upwards with the least significant bit on the video pin. Its full
+// scale is 5/3 of the swing from black to white, with black at a fifth of it, see colour.h. The
+// sync pin is mixed in as for the other modes and pulls the signal from black down to sync level.
+// The line timing and video output programs both run at four times the colour subcarrier, so use
+// tvout_set_clock(TVOUT_CLOCK_EXACT) to get it without jitter. That gets PAL's within 64ppm, at
+// 106.4MHz, but no system clock made from the 12MHz crystal gets NTSC's closer than about 0.1%,
+// which some TVs won't lock to. The palette is re-encoded for the DAC. Call before tvout_start().
+void tvout_set_colour(tvout_colour_t encoding, uint dac_bits);
+
+// Set the 16 colours of the colour modes as 0xRRGGBB, by default those of the IBM PC's CGA. Each
+// byte of a colour frame buffer is two pixels, the left one in the high nibble. A new palette
+// shows from the next line which is encoded.
+void tvout_set_palette(const uint32_t *palette);
+
+// System clock policies for tvout_set_clock().
+typedef enum {
+  TVOUT_CLOCK_KEEP,  // Keep sys_clk, using fractional PIO clock dividers where needed
+  TVOUT_CLOCK_EXACT, // Change sys_clk to the one whose integer dividers best fit the mode
+} tvout_clock_t;
+
+// Choose sys_clk for the current mode, between 100MHz and 133MHz. With TVOUT_CLOCK_EXACT this may
+// change sys_clk and with it clk_peri, so call it before setting up anything which depends on them,
+// e.g. stdio_init_all(). Call between tvout_set_mode() and tvout_start(). Without it sys_clk is
+// kept.
+void tvout_set_clock(tvout_clock_t policy);
+
+// Clocks chosen by tvout_start().
+typedef struct {
+  uint32_t sys_clock_hz;
+  float timing_divider;     // Line timing PIO clock divider
+  float video_divider;      // Video output PIO clock divider
+  int32_t timing_error_ppm; // Error of the line timing clock
+  int32_t line_error_ppm;   // Error of the average line rate, after rounding to whole cycles
+  int32_t field_error_ppm;  // Error of the field rate, after rounding to whole cycles
+  int32_t dot_error_ppm;    // Error of the dot clock, and so of the picture width
+  uint32_t jitter_ps;       // Edge jitter from fractional dividers, 0 if they are whole numbers
+} tvout_clock_info_t;
+
+// Get the clocks chosen by tvout_start().
+void tvout_get_clock_info(tvout_clock_info_t *info);
+
 // Start TV-out. tvout_init() must have been called first.
 void tvout_start(void);
 
 // Cleanup TV-out after tvout_init().
 void tvout_cleanup(void);
 
-// Get screen resolution.
+// Get screen resolution, i.e. the size of the frame buffer in the current mode and viewport.
 uint tvout_get_screen_width(void);
 uint tvout_get_screen_height(void);
 
+// Get the period of one field, the budget for drawing a frame at the full field rate.
+uint tvout_get_field_period_us(void);
+
 // Set vblank callback. Pass NULL to disable.
 void tvout_set_vblank_callback(tvout_vblank_callback_t callback);
 
 // Frame buffer is big-endian within a 32-bit word so the MSB of the word is the left-most pixel.
 // Note that the pico itself is little-endian and so, with an array of bytes, the first byte in
 // memory is the right-most group of 8 pixels.
-void tvout_set_frame_buffer(void *frame_buffer);
+//
+// The frame buffer must be word aligned. It may be in flash, e.g. a const image, in which case it
+// is scanned out directly without using any SRAM. Flash must not be written while it is shown.
+void tvout_set_frame_buffer(const void *frame_buffer);
+
+// Ways of combining a layer with the frame buffer.
+typedef enum {
+  TVOUT_BLEND_NONE, // No layer
+  TVOUT_BLEND_OR,   // Set pixels of the layer are white
+  TVOUT_BLEND_XOR,  // Set pixels of the layer invert those of the frame buffer
+  TVOUT_BLEND_MASK, // Set pixels of the layer are black
+} tvout_blend_t;
+
+// Show a second frame buffer, e.g. of console text, over the frame buffer so that each can be
+// drawn, scrolled and flipped without touching the other. The layer has the same size and layout
+// as the frame buffer. Each line of it is merged with the frame buffer's by the CPU, in a DMA
+// interrupt per line, into one of two line buffers which DMA then scans out. That takes about a
+// microsecond per line at 640 pixels. Pass NULL or TVOUT_BLEND_NONE to remove the layer. Changes
+// show from the next field. The colour modes have no layer.
+void tvout_set_layer(const void *layer, tvout_blend_t blend);
+
+// Scroll the layer vertically: show its row at row on the first row of the window, wrapping
+// around after rows rows of the layer, or the window's height if rows is 0. A layer taller than
+// the window is a ring whose rows below the window can be drawn before they scroll into view.
+// Changes show from the next field.
+void tvout_set_layer_origin(uint row, uint rows);
+
+// Most sprites shown on one row of the window, and most sprites in the list.
+#define TVOUT_SPRITES_PER_LINE 8
+#define TVOUT_MAX_SPRITES 32
+
+// A sprite is a 32 pixel wide bitmap of height rows, one word per row with the MSB the left-most
+// pixel, shown with its top-left pixel at x, y in the window. It may be partly or wholly off it.
+// Pixels set in the mask are replaced by the bitmap's, or with a NULL mask the set pixels of the
+// bitmap are white.
+typedef struct {
+  int16_t x, y;
+  uint16_t height;
+  const uint32_t *bitmap;
+  const uint32_t *mask;
+} tvout_sprite_t;
+
+// Show a list of up to TVOUT_MAX_SPRITES sprites over the frame buffer and any layer, without
+// drawing into either. Like the layer, they are drawn into the line buffers in the per line DMA
+// interrupt. Each line looks through the whole list, about 10 cycles per sprite, and draws each
+// sprite on it in about 40 more. Only the first TVOUT_SPRITES_PER_LINE sprites on a row are drawn,
+// which bounds a line to about 6μs at 125MHz, and the first sprite in the list is on top. The list
+// is read as each line is built, so move sprites after tvout_wait_for_vblank() to avoid tearing.
+// Pass a count of 0 to remove them. Changes to the list show from the next field. The colour modes
+// have no sprites.
+void tvout_set_sprites(const tvout_sprite_t *sprites, uint count);
+
+// Counts of lines built by the CPU since tvout_start(), with the number which weren't ready by the
+// time DMA started to scan them out and the number of sprites left out by the per line limit.
+typedef struct {
+  uint32_t lines;
+  uint32_t late_lines;
+  uint32_t dropped_sprites;
+} tvout_line_stats_t;
+
+// Get the counts of lines built by the CPU.
+void tvout_get_line_stats(tvout_line_stats_t *stats);
+
+// Kinds of band in a display list.
+typedef enum {
+  TVOUT_BAND_BLANK,  // Black rows, with no source
+  TVOUT_BAND_BITMAP, // Rows of a 1bpp bitmap laid out like the frame buffer
+  TVOUT_BAND_REPEAT, // The first row of a bitmap on every row of the band
+  TVOUT_BAND_TEXT,   // Rows of 8 pixel wide character cells, one byte each, drawn with a font
+} tvout_band_mode_t;
+
+// Most bands in a display list.
+#define TVOUT_MAX_BANDS 32
+
+// A band of rows of the window and where they come from. The band shows rows of its source from
+// scroll onwards, wrapping around after source_rows rows, or after as many as the band has if
+// source_rows is 0. A row of a bitmap is increment bytes after the one before it, a multiple of
+// four which may be more than the width of the window, e.g. to pan across a wider bitmap by moving
+// source 4 bytes at a time. A text band's rows are those of its characters' glyphs, from font, with
+// a character for every 8 pixels of the window, and a row of characters is increment bytes after
+// the one before it. The font must use FONT_LAYOUT_ROWS or FONT_LAYOUT_INTERLEAVED and is read in
+// the line interrupt, so copy it to RAM with glyph_copy_font_to_ram(). Characters outside ASCII
+// show as spaces.
+typedef struct {
+  tvout_band_mode_t mode;
+  uint16_t rows;
+  uint16_t scroll;
+  uint16_t source_rows;
+  uint32_t increment;
+  const void *source;
+  const font_t *font;
+} tvout_band_t;
+
+// Show a display list of up to TVOUT_MAX_BANDS bands, from the top of the window down, instead of
+// the frame buffer. Rows below the last band are black. Bitmap, repeated and blank rows are read by
+// DMA straight from their source, as the frame buffer's are, so they take no CPU time, and a text
+// row is drawn by the CPU in the line interrupt, in about a microsecond at 80 columns. A dashboard
+// can so be a line of text over a chart and a scrolling log, each scrolled by changing its band's
+// scroll, in a fraction of the RAM of a frame buffer. The list is read again at the start of every
+// field, so changes to it show from the next field. Any layer and sprites are drawn over it. Pass
+// NULL to show the frame buffer again. The colour modes have no display list.
+void tvout_set_display_list(const tvout_band_t *bands, uint count);
+
+// Built-in test patterns for tvout_set_test_pattern(), see testpattern.h.
+typedef enum {
+  TVOUT_PATTERN_NONE,         // Show the frame buffer or display list
+  TVOUT_PATTERN_GRID,         // Dots every 16 pixels
+  TVOUT_PATTERN_CROSSHATCH,   // Lines every 32 pixels and along the right and bottom edges
+  TVOUT_PATTERN_CHECKERBOARD, // 32 pixel squares
+  TVOUT_PATTERN_BARS,         // Stripes 1, 2, 4, 8 and 16 pixels wide, for the dot clock
+  TVOUT_PATTERN_SAFE_AREA,    // Outlines of the whole window and of the middle 80% of it
+} tvout_pattern_t;
+
+// Show a test pattern over the whole window instead of the frame buffer or display list, e.g. to
+// set up a TV's geometry. A pattern is made of at most four different rows, drawn into a few
+// hundred bytes of tvout's own, and DMA is pointed at one of them for every line, so it needs no
+// frame buffer and no CPU time. Any layer and sprites are drawn over it. The pattern is drawn for
+// the current mode and viewport, so call after tvout_set_viewport(). It shows from the next field.
+// The colour modes have no test patterns.
+void tvout_set_test_pattern(tvout_pattern_t pattern);
 
 // Wait until the next vblank interval
 void tvout_wait_for_vblank(void);
+
+// Double buffering. Show a frame buffer from the next field which has not already started and wait
+// until the frame buffer shown before it has been scanned out for the last time, after which it
+// may be drawn into.
+void tvout_flip(const void *frame_buffer);
@@ -0,0 +1,177 @@
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "hardware/clocks.h"
+#include "hardware/pio.h"
+
+#include "tvout.pio.h"
+#include "tvout_timing.h"
+
+// Line timing programs for the nominal line timing clock, generated from the description of each
+// kind of line at compile time. A line which doesn't add up to the line period, a state too short
+// or too long for the program's cycle count, or a program which DMA can't read in ring mode is a
+// compile error. tvout_start() copies these programs into those read by DMA, or builds them at run
+// time from the same descriptions if the line timing clock isn't nominal.
+
+namespace {
+
+constexpr uint32_t tick_ns = LINE_TIMING_CLOCK_PERIOD_NS;
+
+template <std::size_t N> using program_t = std::array<uint32_t, N * TIMING_LINES>;
+
+// Period of a line in nanoseconds.
+template <std::size_t N> constexpr uint32_t period_ns(const timing_state_t (&states)[N]) {
+  uint32_t ns = 0;
+  for (std::size_t i = 0; i < N; i++) {
+    ns += states[i].ns;
+  }
+  return ns;
+}
+
+// Round a / tick_ns to the nearest whole number of cycles.
+constexpr uint32_t to_cycles(uint64_t ns) { return (ns + (tick_ns / 2)) / tick_ns; }
+
+// Cycles of each state of TIMING_LINES copies of a line, rounded as by build_timing_program() in
+// tvout.c: the end of each state from the start of its line, the start of each line from the start
+// of the program.
+template <std::size_t N> constexpr program_t<N> cycles(const timing_state_t (&states)[N]) {
+  program_t<N> program{};
+  uint32_t line_start = 0;
+  for (uint32_t line = 1; line <= TIMING_LINES; line++) {
+    uint32_t line_end = to_cycles(uint64_t{line} * period_ns(states));
+    uint32_t state_start = 0, state_end_ns = 0;
+    for (std::size_t i = 0; i < N; i++) {
+      state_end_ns += states[i].ns;
+      uint32_t state_end = (i + 1 < N) ? to_cycles(state_end_ns) : line_end - line_start;
+      program[((line - 1) * N) + i] = state_end - state_start;
+      state_start = state_end;
+    }
+    line_start = line_end;
+  }
+  return program;
+}
+
+template <std::size_t N> constexpr program_t<N> encode(const timing_state_t (&states)[N]) {
+  program_t<N> program = cycles(states);
+  for (std::size_t i = 0; i < program.size(); i++) {
+    const timing_state_t &state = states[i % N];
+    program[i] = line_timing_encode(state.sync, program[i], state.side_effect);
+  }
+  return program;
+}
+
+// True if every state lasts between 5 and 0x7fff + 5 cycles, the range of the cycle count field.
+template <std::size_t N> constexpr bool fits(const timing_state_t (&states)[N]) {
+  for (uint32_t c : cycles(states)) {
+    if ((c < 5) || (c - 5 > 0x7fff)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// True if the line lasts exactly line_ns and its copies exactly TIMING_LINES * line_ns.
+template <std::size_t N>
+constexpr bool exact(const timing_state_t (&states)[N], uint32_t line_ns) {
+  uint32_t total = 0;
+  for (uint32_t c : cycles(states)) {
+    total += c;
+  }
+  return (period_ns(states) == line_ns) && ((uint64_t{line_ns} * TIMING_LINES) % tick_ns == 0) &&
+         (uint64_t{total} * tick_ns == uint64_t{line_ns} * TIMING_LINES);
+}
+
+constexpr bool is_power_of_two(std::size_t n) { return (n != 0) && ((n & (n - 1)) == 0); }
+
+} // namespace
+
+extern "C" {
+
+constexpr timing_state_t timing_blank_line_states[] = {
+    {0, HSYNC_WIDTH_NS, SIDE_EFFECT_NOP},
+    {1, LINE_PERIOD_NS - HSYNC_WIDTH_NS, SIDE_EFFECT_NOP},
+};
+
+constexpr timing_state_t timing_visible_line_states[] = {
+    {0, HSYNC_WIDTH_NS, SIDE_EFFECT_NOP},
+    {1, BACK_PORCH_WIDTH_NS + TRIGGER_SHIFT_NS, SIDE_EFFECT_NOP},
+    {1, VISIBLE_WIDTH_NS, SIDE_EFFECT_SET_TRIGGER},
+    {1, FRONT_PORCH_WIDTH_NS - TRIGGER_SHIFT_NS, SIDE_EFFECT_CLEAR_TRIGGER},
+};
+
+constexpr timing_state_t timing_visible_line_fast_states[] = {
+    {0, HSYNC_WIDTH_NS, SIDE_EFFECT_PUSH},
+    {1, BACK_PORCH_WIDTH_NS + TRIGGER_SHIFT_NS, SIDE_EFFECT_NOP},
+    {1, VISIBLE_WIDTH_NS, SIDE_EFFECT_SET_TRIGGER},
+    {1, FRONT_PORCH_WIDTH_NS - TRIGGER_SHIFT_NS, SIDE_EFFECT_BLANK},
+};
+
+constexpr timing_state_t timing_visible_line_colour_states[] = {
+    {0, HSYNC_WIDTH_NS, SIDE_EFFECT_PUSH},
+    {1, COLOUR_BURST_START_NS - HSYNC_WIDTH_NS + TRIGGER_SHIFT_NS, SIDE_EFFECT_NOP},
+    {1, LINE_PERIOD_NS - FRONT_PORCH_WIDTH_NS - COLOUR_BURST_START_NS, SIDE_EFFECT_SET_TRIGGER},
+    {1, FRONT_PORCH_WIDTH_NS - TRIGGER_SHIFT_NS, SIDE_EFFECT_CLEAR_TRIGGER},
+};
+
+constexpr timing_state_t timing_long_sync_half_line_states[] = {
+    {0, LONG_SYNC_WIDTH_NS, SIDE_EFFECT_NOP},
+    {1, (LINE_PERIOD_NS >> 1) - LONG_SYNC_WIDTH_NS, SIDE_EFFECT_NOP},
+};
+
+constexpr timing_state_t timing_short_sync_half_line_states[] = {
+    {0, SHORT_SYNC_WIDTH_NS, SIDE_EFFECT_NOP},
+    {1, (LINE_PERIOD_NS >> 1) - SHORT_SYNC_WIDTH_NS, SIDE_EFFECT_NOP},
+};
+
+} // extern "C"
+
+namespace {
+
+constexpr auto blank_line = encode(timing_blank_line_states);
+constexpr auto visible_line = encode(timing_visible_line_states);
+constexpr auto visible_line_fast = encode(timing_visible_line_fast_states);
+constexpr auto long_sync_half_line = encode(timing_long_sync_half_line_states);
+constexpr auto short_sync_half_line = encode(timing_short_sync_half_line_states);
+
+static_assert(exact(timing_blank_line_states, LINE_PERIOD_NS));
+static_assert(exact(timing_visible_line_states, LINE_PERIOD_NS));
+static_assert(exact(timing_visible_line_fast_states, LINE_PERIOD_NS));
+static_assert(exact(timing_visible_line_colour_states, LINE_PERIOD_NS));
+static_assert(exact(timing_long_sync_half_line_states, LINE_PERIOD_NS >> 1));
+static_assert(exact(timing_short_sync_half_line_states, LINE_PERIOD_NS >> 1));
+
+static_assert(fits(timing_blank_line_states));
+static_assert(fits(timing_visible_line_states));
+static_assert(fits(timing_visible_line_fast_states));
+static_assert(fits(timing_visible_line_colour_states));
+static_assert(fits(timing_long_sync_half_line_states));
+static_assert(fits(timing_short_sync_half_line_states));
+
+static_assert(is_power_of_two(sizeof(blank_line)));
+static_assert(is_power_of_two(sizeof(visible_line)));
+static_assert(is_power_of_two(sizeof(long_sync_half_line)));
+static_assert(is_power_of_two(sizeof(short_sync_half_line)));
+
+// The field is made of long and short sync half lines, blank lines and visible lines.
+static_assert(VERT_VISIBLE_START_LINE > VSYNC_LINES_PER_FIELD);
+static_assert(LINES_PER_FIELD > (VERT_VISIBLE_START_LINE + VISIBLE_LINES_PER_FIELD));
+
+} // namespace
+
+extern "C" {
+
+const uint32_t *const timing_blank_line_nominal = blank_line.data();
+const uint32_t *const timing_visible_line_nominal = visible_line.data();
+const uint32_t *const timing_visible_line_fast_nominal = visible_line_fast.data();
+const uint32_t *const timing_long_sync_half_line_nominal = long_sync_half_line.data();
+const uint32_t *const timing_short_sync_half_line_nominal = short_sync_half_line.data();
+
+alignas(sizeof(blank_line)) uint32_t timing_blank_line[blank_line.size()];
+alignas(sizeof(visible_line)) uint32_t timing_visible_line[visible_line.size()];
+alignas(sizeof(long_sync_half_line)) uint32_t
+    timing_long_sync_half_line[long_sync_half_line.size()];
+alignas(sizeof(short_sync_half_line)) uint32_t
+    timing_short_sync_half_line[short_sync_half_line.size()];
+
+} // extern "C"
@@ -0,0 +1,84 @@
+#pragma once
+
+#include <stdint.h>
+
+// TV signal timing, shared by tvout.c and tvout_timing.cpp. The latter describes each kind of line
+// as a sequence of line timing program states and generates the line timing programs for the
+// nominal line timing clock from them at compile time, checking that they are in spec.
+
+// Resolution
+#define VISIBLE_DOTS_PER_LINE 640                          // Horizontal resolution
+#define MAX_VISIBLE_DOTS_PER_LINE 800                      // Horizontal resolution of widest mode
+#define VISIBLE_LINES_PER_FIELD 256                        // Number of visible lines per field
+
+// TV signal timing. See http://martin.hinner.info/vga/pal.html. We repeatedly send the first field
+// which is sometimes known as "240p". (Or the PAL equivalent of "272p".)
+#define LINE_PERIOD_NS 64000                               // Period of one line of video (ns)
+#define LINES_PER_FIELD 310                                // Number of lines in a *field*
+#define HSYNC_WIDTH_NS 4700                                // Line sync pulse width (ns)
+#define HORIZ_OVERSCAN_NS 5520                             // Horizontal overscan (ns)
+#define VSYNC_LINES_PER_FIELD 5                            // V-sync lines at start of field
+#define VERT_OVERSCAN_LINES 16                             // Vertical overscan (lines per *field*)
+#define VERT_VISIBLE_START_LINE (23 + VERT_OVERSCAN_LINES) // Start line of visible data (0-based)
+#define FRONT_PORCH_WIDTH_NS (1650 + HORIZ_OVERSCAN_NS)    // Front porch width (ns)
+#define VISIBLE_WIDTH_NS (52000 - (2 * HORIZ_OVERSCAN_NS)) // Visible area (ns)
+#define SHORT_SYNC_WIDTH_NS 2350                           // "Short" sync pulse width (ns)
+#define LONG_SYNC_WIDTH_NS 27300                           // "Long" sync pulse width (ns)
+
+// Implied back porch period
+#define BACK_PORCH_WIDTH_NS                                                                        \
+  (LINE_PERIOD_NS - VISIBLE_WIDTH_NS - FRONT_PORCH_WIDTH_NS - HSYNC_WIDTH_NS)
+
+// Start of the colour burst in the colour modes, from the start of the line sync pulse (ns)
+#define COLOUR_BURST_START_NS 5600
+
+// Offset of the visible portion of a line from the video output trigger. We need to shift the
+// visible portion by a few line timing program clock cycles because of the difference in time
+// between side effect and pin change times.
+#define TRIGGER_SHIFT_NS (2 * LINE_TIMING_CLOCK_PERIOD_NS)
+
+// A state of a line timing program in nanoseconds.
+typedef struct {
+  uint32_t sync, ns, side_effect;
+} timing_state_t;
+
+// Each line timing program holds this many lines, or half lines, so that rounding to whole line
+// timing clock cycles can be spread over them.
+#define TIMING_LINES 8
+
+#define TIMING_BLANK_LINE_STATES 2
+#define TIMING_VISIBLE_LINE_STATES 4
+#define TIMING_LONG_SYNC_HALF_LINE_STATES 2
+#define TIMING_SHORT_SYNC_HALF_LINE_STATES 2
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Each kind of line. The visible line is for video_output. The one for video_output_fast starts
+// and ends with the side effects which restart it and blank its output, see tvout.pio. The colour
+// one restarts it too but triggers it at the colour burst, which is part of its data, and leaves
+// blanking to the data.
+extern const timing_state_t timing_blank_line_states[TIMING_BLANK_LINE_STATES];
+extern const timing_state_t timing_visible_line_states[TIMING_VISIBLE_LINE_STATES];
+extern const timing_state_t timing_visible_line_fast_states[TIMING_VISIBLE_LINE_STATES];
+extern const timing_state_t timing_visible_line_colour_states[TIMING_VISIBLE_LINE_STATES];
+extern const timing_state_t timing_long_sync_half_line_states[TIMING_LONG_SYNC_HALF_LINE_STATES];
+extern const timing_state_t timing_short_sync_half_line_states[TIMING_SHORT_SYNC_HALF_LINE_STATES];
+
+// The line timing programs for each kind of line with the nominal line timing clock.
+extern const uint32_t *const timing_blank_line_nominal;
+extern const uint32_t *const timing_visible_line_nominal;
+extern const uint32_t *const timing_visible_line_fast_nominal;
+extern const uint32_t *const timing_long_sync_half_line_nominal;
+extern const uint32_t *const timing_short_sync_half_line_nominal;
+
+// The line timing programs read by DMA in ring mode, each aligned to its size.
+extern uint32_t timing_blank_line[TIMING_BLANK_LINE_STATES * TIMING_LINES];
+extern uint32_t timing_visible_line[TIMING_VISIBLE_LINE_STATES * TIMING_LINES];
+extern uint32_t timing_long_sync_half_line[TIMING_LONG_SYNC_HALF_LINE_STATES * TIMING_LINES];
+extern uint32_t timing_short_sync_half_line[TIMING_SHORT_SYNC_HALF_LINE_STATES * TIMING_LINES];
+
+#ifdef __cplusplus
+}
+#endif
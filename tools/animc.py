@@ -0,0 +1,112 @@
+#!/usr/bin/env python3
+"""
+Compile a sequence of images into a looping 1bpp animation_t for the playground. See animation.h.
+
+Usage:
+
+    animc.py --name NAME [--size WxH] [--dither METHOD] [--layout LAYOUT] [--invert]
+             (--demo COUNT | FRAME ...) OUTPUT.c OUTPUT.h
+
+Frames are PNG or PGM files, converted as by imgc.py, or with --demo the synthetic 640x256
+animation from stream.py. Each frame is coded as a delta against the frame two before it, wrapping
+around, for playback with double buffering.
+"""
+import argparse
+import os
+import sys
+
+import delta
+import imgc
+
+
+def load_frames(args):
+    if args.demo:
+        from stream import synthetic_frames
+
+        frames = list(synthetic_frames(args.demo))
+        if args.layout == "word":
+            frames = [b"".join(f[i : i + 4][::-1] for i in range(0, len(f), 4)) for f in frames]
+        return 640, 256, 80, frames
+
+    frames, size = [], args.size
+    for path in args.frames:
+        image = imgc.load_png(path) if path.lower().endswith(".png") else imgc.load_pgm(path)
+        if size is None:
+            size = (image.width, image.height)
+        if size != (image.width, image.height):
+            image = imgc.resize(image, *size)
+        if args.invert:
+            image.rows = [[1.0 - v for v in row] for row in image.rows]
+        stride, data = imgc.pack(imgc.dither(image, args.dither), image.width, args.layout)
+        frames.append(data)
+    return size[0], size[1], stride, frames
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compile images into an animation_t.")
+    parser.add_argument("--name", required=True)
+    parser.add_argument("--size", type=imgc.parse_size, help="resize to WxH pixels")
+    parser.add_argument("--dither", choices=imgc.DITHERS, default=imgc.DITHERS[0])
+    parser.add_argument("--layout", choices=imgc.LAYOUTS, default=imgc.LAYOUTS[0])
+    parser.add_argument("--invert", action="store_true", help="swap black and white")
+    parser.add_argument("--demo", type=int, metavar="COUNT", help="use a synthetic animation")
+    parser.add_argument("frames", nargs="*", metavar="FRAME")
+    parser.add_argument("output_c")
+    parser.add_argument("output_h")
+    args = parser.parse_args()
+    if bool(args.demo) == bool(args.frames):
+        parser.error("either --demo or frames are required")
+
+    try:
+        width, height, stride, frames = load_frames(args)
+    except (OSError, ValueError, KeyError, IndexError) as e:
+        sys.exit(f"animc.py: {e}")
+
+    count = len(frames)
+    black = bytes(len(frames[0]))
+    deltas = [delta.encode(frames[(i - 2) % count], frames[i]) for i in range(count)]
+    deltas += [delta.encode(black, frames[i % count]) for i in range(2)]
+    offsets, data = [], bytearray()
+    for d in deltas:
+        offsets.append(len(data))
+        data += d
+    offsets.append(len(data))
+
+    # Bytes written per frame, which with the deltas read is the decoder's memory traffic.
+    written = []
+    for i in range(count):
+        previous, current = frames[(i - 2) % count], frames[i]
+        written.append(sum(1 for a, b in zip(previous, current) if a != b))
+    name = args.name
+    source = "synthetic frames" if args.demo else f"{os.path.basename(args.frames[0])} onwards"
+
+    with open(args.output_h, "w") as f:
+        f.write(f"// Generated by tools/animc.py from {source}. Do not edit.\n")
+        f.write('#include "animation.h"\n\n')
+        f.write(f"extern const animation_t {name};\n")
+
+    with open(args.output_c, "w") as f:
+        f.write(f"// Generated by tools/animc.py from {source}. Do not edit.\n")
+        f.write(f"// {count} frames of {width}x{height}, {args.layout} layout, {len(data)} bytes. ")
+        f.write(f"Per frame: {len(data) // (count + 2)} bytes of delta on average and\n")
+        f.write(f"// {sum(written) // count} bytes written on average, {max(written)} at most.\n")
+        f.write(f'#include "{os.path.basename(args.output_h)}"\n\n')
+        f.write(f"static const uint32_t {name}_offsets[] = {{\n")
+        f.write(imgc.format_values(offsets, "{}", 8))
+        f.write("\n};\n\n")
+        f.write(f"static const uint8_t {name}_data[] = {{\n")
+        f.write(imgc.format_values(data, "0x{:02x}", 12))
+        f.write("\n};\n\n")
+        f.write(f"const animation_t {name} = {{\n")
+        f.write(f"    .width = {width},\n")
+        f.write(f"    .height = {height},\n")
+        f.write(f"    .stride = {stride},\n")
+        f.write(f"    .byte_oriented = {'true' if args.layout == 'byte' else 'false'},\n")
+        f.write(f"    .frame_count = {count},\n")
+        f.write(f"    .offsets = {name}_offsets,\n")
+        f.write(f"    .data = {name}_data,\n")
+        f.write("};\n")
+
+
+if __name__ == "__main__":
+    main()
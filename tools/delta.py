@@ -0,0 +1,91 @@
+#!/usr/bin/env python3
+"""
+Encoder for the XOR-delta run-length codec described in playground/delta.h.
+
+    encode(previous, current) -> bytes
+    decode(previous, delta) -> bytes
+
+Both frames are byte strings in the frame buffer's memory order. A key frame is encoded against a
+frame of zeros.
+"""
+
+MAX_SKIP = 128
+MAX_RUN = 64
+
+# A run of identical bytes is coded as a repeat run when it is at least this long. Shorter runs are
+# cheaper left inside a literal run.
+MIN_REPEAT = 3
+
+# Unchanged bytes inside a literal run cost one byte each whereas ending the run to skip them
+# costs a skip header plus a new literal header. Skips shorter than this are kept in the literal.
+MIN_SKIP = 3
+
+
+def _run_length(data, i, limit):
+    """Length of the run of bytes equal to data[i] starting at i, up to limit."""
+    n, end = 1, min(len(data), i + limit)
+    while i + n < end and data[i + n] == data[i]:
+        n += 1
+    return n
+
+
+def encode(previous, current):
+    if len(previous) != len(current):
+        raise ValueError("frames differ in size")
+    size = len(current)
+    x = (int.from_bytes(previous, "big") ^ int.from_bytes(current, "big")).to_bytes(size, "big")
+
+    # Trailing unchanged bytes need not be coded.
+    end = len(x.rstrip(b"\0"))
+    out = bytearray()
+    i = 0
+    while i < end:
+        if x[i] == 0:
+            n = _run_length(x, i, MAX_SKIP)
+            out.append(n - 1)
+            i += n
+            continue
+
+        n = _run_length(x, i, MAX_RUN)
+        if n >= MIN_REPEAT:
+            out += bytes([0xC0 | (n - 1), x[i]])
+            i += n
+            continue
+
+        # Literal run. Stop before a worthwhile skip or repeat run.
+        start = i
+        while i < end and i - start < MAX_RUN:
+            if x[i] == 0 and _run_length(x, i, MIN_SKIP) >= MIN_SKIP:
+                break
+            if i > start and _run_length(x, i, MIN_REPEAT) >= MIN_REPEAT:
+                break
+            i += 1
+        out.append(0x80 | (i - start - 1))
+        out += x[start:i]
+    return bytes(out)
+
+
+def decode(previous, delta):
+    frame = bytearray(previous)
+    i = pos = 0
+    while i < len(delta):
+        header = delta[i]
+        i += 1
+        if header & 0x80 == 0:
+            pos += header + 1
+            continue
+        n = (header & 0x3F) + 1
+        if pos + n > len(frame):
+            raise ValueError("delta runs past the end of the frame")
+        if header & 0x40:
+            for k in range(n):
+                frame[pos + k] ^= delta[i]
+            i += 1
+        else:
+            for k in range(n):
+                frame[pos + k] ^= delta[i + k]
+            i += n
+        pos += n
+    if pos > len(frame):
+        raise ValueError("delta runs past the end of the frame")
+    return bytes(frame)
@@ -0,0 +1,324 @@
+#!/usr/bin/env python3
+"""
+Compile a BDF or PSF font into a font_t for the playground. See font.h for the table layouts.
+
+ASCII glyphs (U+0020 to U+007E) are emitted uncompressed in the requested layout. Every other glyph
+is emitted compressed: each glyph is a row mask followed by the rows which differ from the row
+above them, row -1 being blank. Bit n of the mask is set if row n is stored. The mask is one byte
+for cells up to eight rows high and two (little-endian) for taller cells. Glyphs are grouped into
+blocks of eight with a 16-bit offset per block so that a glyph can be found by skipping at most
+seven others. See glyph.c for the decoder.
+
+Usage:
+
+    fontc.py --name NAME [--cell WxH] [--scale XxY] [--layout LAYOUT] [--ascii-only]
+             INPUT OUTPUT.c OUTPUT.h
+
+INPUT may be a BDF file or a PSF version 1 or 2 file. PSF fonts without a Unicode table are
+assumed to be indexed by code point. --scale multiplies each source pixel before the glyph is
+placed in the cell, which lets an 8x8 font fill an 8x16 cell. --cell defaults to the scaled size of
+the source font.
+"""
+import argparse
+import os
+import struct
+import sys
+
+ASCII_FIRST = 0x20
+ASCII_LAST = 0x7E
+MAX_WIDTH = 8
+MAX_HEIGHT = 16
+BLOCK_SIZE = 8
+LAYOUTS = ("rows", "interleaved")
+
+PSF1_MAGIC = b"\x36\x04"
+PSF1_MODE512 = 0x01
+PSF1_MODEHASTAB = 0x02
+PSF1_MODESEQ = 0x04
+PSF2_MAGIC = b"\x72\xb5\x4a\x86"
+PSF2_HAS_UNICODE_TABLE = 0x01
+
+
+class Font:
+    """Glyphs as lists of rows, each row a list of 0/1 pixels, plus the font's cell size."""
+
+    def __init__(self, width, height):
+        self.width = width
+        self.height = height
+        self.glyphs = {}
+
+
+def parse_size(value):
+    w, _, h = value.lower().partition("x")
+    return int(w), int(h)
+
+
+def load_bdf(path):
+    with open(path) as f:
+        lines = iter(f.read().splitlines())
+
+    bbox, ascent, font = None, None, None
+    for line in lines:
+        words = line.split()
+        if not words:
+            continue
+        if words[0] == "FONTBOUNDINGBOX":
+            bbox = [int(v) for v in words[1:5]]
+        elif words[0] == "FONT_ASCENT":
+            ascent = int(words[1])
+        elif words[0] == "CHARS":
+            break
+    if bbox is None:
+        raise ValueError(f"{path}: missing FONTBOUNDINGBOX")
+    if ascent is None:
+        ascent = bbox[1] + bbox[3]
+    font = Font(bbox[0], bbox[1])
+
+    for line in lines:
+        if not line.startswith("STARTCHAR"):
+            continue
+        encoding, bbx, bitmap = None, bbox, []
+        for line in lines:
+            words = line.split()
+            if not words:
+                continue
+            if words[0] == "ENCODING":
+                encoding = int(words[1])
+            elif words[0] == "BBX":
+                bbx = [int(v) for v in words[1:5]]
+            elif words[0] == "BITMAP":
+                for line in lines:
+                    line = line.strip()
+                    if not line:
+                        continue
+                    if line == "ENDCHAR":
+                        break
+                    bitmap.append(int(line, 16))
+                break
+        if encoding is None or encoding < 0:
+            continue
+
+        # Place the glyph's bounding box relative to the font's baseline.
+        w, h, x, y = bbx
+        row_bits = ((w + 7) // 8) * 8
+        glyph = [[0] * font.width for _ in range(font.height)]
+        top = ascent - (y + h)
+        for gy, bits in enumerate(bitmap[:h]):
+            for gx in range(w):
+                cx, cy = x - bbox[2] + gx, top + gy
+                if (bits >> (row_bits - 1 - gx)) & 1 and 0 <= cx < font.width and 0 <= cy < font.height:
+                    glyph[cy][cx] = 1
+        font.glyphs[encoding] = glyph
+    return font
+
+
+def psf_unicode_table(data, count, decode_entry):
+    """Map each glyph to the single code points listed for it. Sequences are ignored."""
+    mapping, glyph = {}, 0
+    for entry in decode_entry(data):
+        if glyph >= count:
+            break
+        for cp in entry:
+            mapping.setdefault(cp, glyph)
+        glyph += 1
+    return mapping
+
+
+def load_psf(path):
+    with open(path, "rb") as f:
+        data = f.read()
+
+    if data.startswith(PSF1_MAGIC):
+        mode, charsize = data[2], data[3]
+        width, height, count = 8, charsize, 512 if mode & PSF1_MODE512 else 256
+        bytes_per_glyph, offset = charsize, 4
+        table = None
+        if mode & (PSF1_MODEHASTAB | PSF1_MODESEQ):
+
+            def entries(raw):
+                # Little-endian 16-bit values. 0xFFFE starts a sequence, 0xFFFF ends an entry.
+                values = struct.unpack(f"<{len(raw) // 2}H", raw[: len(raw) // 2 * 2])
+                entry, in_seq = [], False
+                for v in values:
+                    if v == 0xFFFF:
+                        yield entry
+                        entry, in_seq = [], False
+                    elif v == 0xFFFE:
+                        in_seq = True
+                    elif not in_seq:
+                        entry.append(v)
+
+            table = psf_unicode_table(data[offset + count * bytes_per_glyph :], count, entries)
+    elif data.startswith(PSF2_MAGIC):
+        _, _, offset, flags, count, bytes_per_glyph, height, width = struct.unpack(
+            "<4sIIIIIII", data[:32]
+        )
+        table = None
+        if flags & PSF2_HAS_UNICODE_TABLE:
+
+            def entries(raw):
+                # UTF-8 strings. 0xFE starts a sequence, 0xFF ends an entry.
+                for chunk in raw.split(b"\xff"):
+                    yield [ord(c) for c in chunk.split(b"\xfe")[0].decode("utf-8", "replace")]
+
+            table = psf_unicode_table(data[offset + count * bytes_per_glyph :], count, entries)
+    else:
+        raise ValueError(f"{path}: not a PSF font")
+
+    if table is None:
+        print(f"fontc.py: {path} has no Unicode table, assuming glyph N is U+{0:04X}+N",
+              file=sys.stderr)
+        table = {glyph: glyph for glyph in range(count)}
+
+    font = Font(width, height)
+    row_bytes = (width + 7) // 8
+    for cp, glyph in table.items():
+        base = offset + glyph * bytes_per_glyph
+        rows = []
+        for y in range(height):
+            bits = int.from_bytes(data[base + y * row_bytes : base + (y + 1) * row_bytes], "big")
+            rows.append([(bits >> (row_bytes * 8 - 1 - x)) & 1 for x in range(width)])
+        font.glyphs[cp] = rows
+    return font
+
+
+def load_font(path):
+    with open(path, "rb") as f:
+        magic = f.read(4)
+    if magic.startswith(PSF1_MAGIC) or magic == PSF2_MAGIC:
+        return load_psf(path)
+    return load_bdf(path)
+
+
+def fit_to_cell(font, scale, cell):
+    """Scale each glyph and place it at the top-left of a cell, returning rows as MSB-first bytes."""
+    sx, sy = scale
+    width, height = cell
+    if font.width * sx > width or font.height * sy > height:
+        sys.exit(f"fontc.py: {font.width}x{font.height} font scaled by {sx}x{sy} "
+                 f"does not fit a {width}x{height} cell")
+    glyphs = {}
+    for cp, glyph in font.glyphs.items():
+        rows = [0] * height
+        for y, row in enumerate(glyph):
+            bits = 0
+            for x, pixel in enumerate(row):
+                if pixel:
+                    bits |= ((1 << sx) - 1) << (8 - (x + 1) * sx)
+            for dy in range(sy):
+                rows[y * sy + dy] = bits
+        glyphs[cp] = rows
+    return glyphs
+
+
+def compress_glyph(rows):
+    mask, data, prev = 0, [], 0
+    for i, row in enumerate(rows):
+        if row != prev:
+            mask |= 1 << i
+            data.append(row)
+        prev = row
+    mask_bytes = list(mask.to_bytes(1 if len(rows) <= 8 else 2, "little"))
+    return mask_bytes + data
+
+
+def ranges_of(codepoints):
+    """Group sorted code points into [first, count] runs."""
+    runs = []
+    for cp in codepoints:
+        if runs and runs[-1][0] + runs[-1][1] == cp:
+            runs[-1][1] += 1
+        else:
+            runs.append([cp, 1])
+    return runs
+
+
+def ascii_table(glyphs, height, layout, blank):
+    """Return the ASCII glyph table as a list of integers in the order required by layout."""
+    ascii_glyphs = [glyphs.get(cp, blank) for cp in range(ASCII_FIRST, ASCII_LAST + 1)]
+    if layout == "rows":
+        return [row for glyph in ascii_glyphs for row in glyph]
+    return [glyph[row] for row in range(height) for glyph in ascii_glyphs]
+
+
+def format_values(values, fmt, per_line, indent="  "):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append(indent + ", ".join(fmt.format(v) for v in values[i : i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.strip().splitlines()[0])
+    parser.add_argument("--name", required=True, help="C identifier of the font_t")
+    parser.add_argument("--cell", type=parse_size, help="cell size as WxH")
+    parser.add_argument("--scale", type=parse_size, default=(1, 1), help="pixel scale as XxY")
+    parser.add_argument("--layout", choices=LAYOUTS, default="rows")
+    parser.add_argument("--ascii-only", action="store_true", help="omit non-ASCII glyphs")
+    parser.add_argument("input")
+    parser.add_argument("output_c")
+    parser.add_argument("output_h")
+    args = parser.parse_args()
+
+    font = load_font(args.input)
+    cell = args.cell or (font.width * args.scale[0], font.height * args.scale[1])
+    if cell[0] > MAX_WIDTH or cell[1] > MAX_HEIGHT:
+        sys.exit(f"fontc.py: cells are limited to {MAX_WIDTH}x{MAX_HEIGHT}")
+    glyphs = fit_to_cell(font, args.scale, cell)
+    blank = [0] * cell[1]
+
+    # Glyphs beyond ASCII. C0 and C1 control characters never have glyphs.
+    ext, block_offsets, data, runs = [], [], [], []
+    if not args.ascii_only:
+        ext = sorted(cp for cp in glyphs if cp >= 0xA0)
+        for index, cp in enumerate(ext):
+            if index % BLOCK_SIZE == 0:
+                block_offsets.append(len(data))
+            data.extend(compress_glyph(glyphs[cp]))
+        if len(data) > 0xFFFF:
+            sys.exit("fontc.py: compressed glyphs too large for 16-bit block offsets")
+        glyph = 0
+        for first, count in ranges_of(ext):
+            runs.append((first, count, glyph))
+            glyph += count
+
+    ascii_values = ascii_table(glyphs, cell[1], args.layout, blank)
+    source = os.path.basename(args.input)
+    name = args.name
+
+    with open(args.output_h, "w") as f:
+        f.write(f"// Generated by tools/fontc.py from {source}. Do not edit.\n")
+        f.write('#include "font.h"\n\n')
+        f.write(f"extern const font_t {name};\n")
+
+    with open(args.output_c, "w") as f:
+        f.write(f"// Generated by tools/fontc.py from {source}. Do not edit.\n")
+        f.write(f"// {cell[0]}x{cell[1]} cells, {args.layout} layout, {len(ext)} compressed glyphs ")
+        f.write(f"in {len(data)} bytes.\n")
+        f.write(f'#include "{os.path.basename(args.output_h)}"\n\n')
+        f.write(f"static const uint8_t {name}_ascii[] = {{\n")
+        f.write(format_values(ascii_values, "0x{:02x}", 12))
+        f.write("\n};\n\n")
+        if ext:
+            f.write(f"static const font_range_t {name}_ext_ranges[] = {{\n")
+            f.write("".join(f"  {{0x{a:04x}, {n}, {g}}},\n" for a, n, g in runs))
+            f.write("};\n\n")
+            f.write(f"static const uint16_t {name}_ext_block_offsets[] = {{\n")
+            f.write(format_values(block_offsets, "{}", 12) + "\n};\n\n")
+            f.write(f"static const uint8_t {name}_ext_data[] = {{\n")
+            f.write(format_values(data, "0x{:02x}", 12) + "\n};\n\n")
+        f.write(f"const font_t {name} = {{\n")
+        f.write(f"    .width = {cell[0]},\n")
+        f.write(f"    .height = {cell[1]},\n")
+        f.write(f"    .layout = FONT_LAYOUT_{args.layout.upper()},\n")
+        f.write(f"    .ascii = {name}_ascii,\n")
+        if ext:
+            f.write(f"    .ext_ranges = {name}_ext_ranges,\n")
+            f.write(f"    .ext_range_count = {len(runs)},\n")
+            f.write(f"    .ext_block_offsets = {name}_ext_block_offsets,\n")
+            f.write(f"    .ext_data = {name}_ext_data,\n")
+        f.write("};\n")
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,300 @@
+#!/usr/bin/env python3
+"""
+Compile a PNG or PGM image into a 1bpp image_t for the playground. See image.h.
+
+Usage:
+
+    imgc.py --name NAME [--size WxH] [--dither METHOD] [--layout LAYOUT] [--invert] [--compress]
+            INPUT OUTPUT.c OUTPUT.h
+
+The image is converted to grey, resized to --size if given and reduced to black and white with
+Floyd-Steinberg error diffusion (the default), an 8x8 ordered dither or a plain threshold. Rows are
+packed MSB-first and padded to four bytes in either byte or word oriented layout, as for
+tvout_init(). With --compress the packed image is stored as a delta against a cleared frame using
+the codec in delta.py, which the device decodes with image_decode().
+
+PNG files may be of any bit depth and colour type but must not be interlaced. Transparent pixels
+are composited over black. Only the Python standard library is needed.
+"""
+import argparse
+import os
+import struct
+import sys
+import zlib
+
+import delta
+
+DITHERS = ("floyd-steinberg", "ordered", "threshold")
+LAYOUTS = ("byte", "word")
+
+PNG_MAGIC = b"\x89PNG\r\n\x1a\n"
+
+BAYER_8X8 = [
+    [0, 32, 8, 40, 2, 34, 10, 42],
+    [48, 16, 56, 24, 50, 18, 58, 26],
+    [12, 44, 4, 36, 14, 46, 6, 38],
+    [60, 28, 52, 20, 62, 30, 54, 22],
+    [3, 35, 11, 43, 1, 33, 9, 41],
+    [51, 19, 59, 27, 49, 17, 57, 25],
+    [15, 47, 7, 39, 13, 45, 5, 37],
+    [63, 31, 55, 23, 61, 29, 53, 21],
+]
+
+
+class Image:
+    """Grey pixels from 0.0 (black) to 1.0 (white) as a list of rows."""
+
+    def __init__(self, width, height, rows):
+        self.width = width
+        self.height = height
+        self.rows = rows
+
+
+def parse_size(value):
+    w, _, h = value.lower().partition("x")
+    return int(w), int(h)
+
+
+def unfilter_png(data, height, row_bytes, bpp):
+    """Undo the per-row PNG filters. bpp is the number of bytes per complete pixel, at least one."""
+    rows, previous, i = [], bytearray(row_bytes), 0
+    for _ in range(height):
+        kind, row = data[i], bytearray(data[i + 1 : i + 1 + row_bytes])
+        i += 1 + row_bytes
+        for x in range(row_bytes):
+            a = row[x - bpp] if x >= bpp else 0
+            b = previous[x]
+            c = previous[x - bpp] if x >= bpp else 0
+            if kind == 1:
+                row[x] = (row[x] + a) & 0xFF
+            elif kind == 2:
+                row[x] = (row[x] + b) & 0xFF
+            elif kind == 3:
+                row[x] = (row[x] + ((a + b) >> 1)) & 0xFF
+            elif kind == 4:
+                p = a + b - c
+                pa, pb, pc = abs(p - a), abs(p - b), abs(p - c)
+                predictor = a if pa <= pb and pa <= pc else (b if pb <= pc else c)
+                row[x] = (row[x] + predictor) & 0xFF
+            elif kind != 0:
+                raise ValueError(f"unknown PNG filter {kind}")
+        rows.append(row)
+        previous = row
+    return rows
+
+
+def load_png(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    if not data.startswith(PNG_MAGIC):
+        raise ValueError(f"{path}: not a PNG file")
+
+    header, palette, idat, i = None, None, b"", len(PNG_MAGIC)
+    while i < len(data):
+        length, kind = struct.unpack(">I4s", data[i : i + 8])
+        chunk = data[i + 8 : i + 8 + length]
+        i += 12 + length
+        if kind == b"IHDR":
+            header = struct.unpack(">IIBBBBB", chunk)
+        elif kind == b"PLTE":
+            palette = [tuple(chunk[j : j + 3]) for j in range(0, len(chunk), 3)]
+        elif kind == b"IDAT":
+            idat += chunk
+        elif kind == b"IEND":
+            break
+
+    width, height, depth, colour_type, _, _, interlace = header
+    if interlace:
+        raise ValueError(f"{path}: interlaced PNG files are not supported")
+    channels = {0: 1, 2: 3, 3: 1, 4: 2, 6: 4}[colour_type]
+    bits = depth * channels
+    rows = unfilter_png(zlib.decompress(idat), height, (width * bits + 7) // 8, max(bits // 8, 1))
+    maximum = (1 << depth) - 1
+
+    def samples(row):
+        if depth == 16:
+            return [(row[j] << 8 | row[j + 1]) for j in range(0, len(row), 2)]
+        if depth == 8:
+            return list(row)
+        per_byte = 8 // depth
+        return [(row[j // per_byte] >> (8 - depth * (j % per_byte + 1))) & maximum
+                for j in range(len(row) * per_byte)]
+
+    pixels = []
+    for row in rows:
+        s = samples(row)
+        out = []
+        for x in range(width):
+            px = s[x * channels : (x + 1) * channels]
+            if colour_type == 3:
+                r, g, b = palette[px[0]]
+                out.append(luma(r, g, b) / 255)
+                continue
+            if colour_type in (2, 6):
+                grey = luma(*px[:3]) / maximum
+            else:
+                grey = px[0] / maximum
+            if colour_type in (4, 6):
+                grey *= px[-1] / maximum
+            out.append(grey)
+        pixels.append(out)
+    return Image(width, height, pixels)
+
+
+def load_pgm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    fields, i = [], 0
+    while len(fields) < 4:
+        while data[i : i + 1].isspace():
+            i += 1
+        if data[i : i + 1] == b"#":
+            i = data.index(b"\n", i)
+            continue
+        start = i
+        while i < len(data) and not data[i : i + 1].isspace():
+            i += 1
+        fields.append(data[start:i])
+    magic, width, height, maximum = fields[0], int(fields[1]), int(fields[2]), int(fields[3])
+    if magic == b"P5":
+        size = 2 if maximum > 255 else 1
+        raw = data[i + 1 : i + 1 + width * height * size]
+        values = [int.from_bytes(raw[j : j + size], "big") for j in range(0, len(raw), size)]
+    elif magic == b"P2":
+        values = [int(v) for v in data[i:].split()]
+    else:
+        raise ValueError(f"{path}: not a PGM file")
+    rows = [[v / maximum for v in values[y * width : (y + 1) * width]] for y in range(height)]
+    return Image(width, height, rows)
+
+
+def luma(r, g, b):
+    return 0.299 * r + 0.587 * g + 0.114 * b
+
+
+def resize(image, width, height):
+    """Box filter, averaging the source pixels covered by each destination pixel."""
+    def spans(src, dest):
+        return [(d * src // dest, max((d + 1) * src // dest, d * src // dest + 1))
+                for d in range(dest)]
+
+    rows = []
+    for y0, y1 in spans(image.height, height):
+        row = []
+        for x0, x1 in spans(image.width, width):
+            total = sum(sum(image.rows[y][x0:x1]) for y in range(y0, y1))
+            row.append(total / ((x1 - x0) * (y1 - y0)))
+        rows.append(row)
+    return Image(width, height, rows)
+
+
+def dither(image, method):
+    """Return rows of 0/1 pixels."""
+    if method == "threshold":
+        return [[1 if v >= 0.5 else 0 for v in row] for row in image.rows]
+    if method == "ordered":
+        return [[1 if v * 64 > BAYER_8X8[y & 7][x & 7] + 0.5 else 0 for x, v in enumerate(row)]
+                for y, row in enumerate(image.rows)]
+
+    rows = [list(row) for row in image.rows]
+    out = []
+    for y in range(image.height):
+        row, below = rows[y], rows[y + 1] if y + 1 < image.height else None
+        bits = []
+        for x in range(image.width):
+            bit = 1 if row[x] >= 0.5 else 0
+            error = row[x] - bit
+            bits.append(bit)
+            if x + 1 < image.width:
+                row[x + 1] += error * 7 / 16
+            if below is not None:
+                if x > 0:
+                    below[x - 1] += error * 3 / 16
+                below[x] += error * 5 / 16
+                if x + 1 < image.width:
+                    below[x + 1] += error * 1 / 16
+        out.append(bits)
+    return out
+
+
+def pack(bits, width, layout):
+    stride = ((width + 31) // 32) * 4
+    data = bytearray()
+    for row in bits:
+        value = 0
+        for x, bit in enumerate(row):
+            value |= bit << (stride * 8 - 1 - x)
+        packed = value.to_bytes(stride, "big")
+        if layout == "word":
+            # Each little-endian word holds 32 pixels with the left-most in its MSB.
+            packed = b"".join(packed[i : i + 4][::-1] for i in range(0, stride, 4))
+        data += packed
+    return stride, bytes(data)
+
+
+def format_values(values, fmt, per_line):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("  " + ", ".join(fmt.format(v) for v in values[i : i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Compile an image into an image_t.")
+    parser.add_argument("--name", required=True)
+    parser.add_argument("--size", type=parse_size, help="resize to WxH pixels")
+    parser.add_argument("--dither", choices=DITHERS, default=DITHERS[0])
+    parser.add_argument("--layout", choices=LAYOUTS, default=LAYOUTS[0])
+    parser.add_argument("--invert", action="store_true", help="swap black and white")
+    parser.add_argument("--compress", action="store_true")
+    parser.add_argument("input")
+    parser.add_argument("output_c")
+    parser.add_argument("output_h")
+    args = parser.parse_args()
+
+    try:
+        if args.input.lower().endswith(".png"):
+            image = load_png(args.input)
+        else:
+            image = load_pgm(args.input)
+    except (OSError, ValueError, KeyError, IndexError) as e:
+        sys.exit(f"imgc.py: {args.input}: {e}")
+
+    if args.size is not None and args.size != (image.width, image.height):
+        image = resize(image, *args.size)
+    if args.invert:
+        image.rows = [[1.0 - v for v in row] for row in image.rows]
+
+    bits = dither(image, args.dither)
+    stride, data = pack(bits, image.width, args.layout)
+    if args.compress:
+        data = delta.encode(bytes(len(data)), data)
+    source = os.path.basename(args.input)
+    name = args.name
+
+    with open(args.output_h, "w") as f:
+        f.write(f"// Generated by tools/imgc.py from {source}. Do not edit.\n")
+        f.write('#include "image.h"\n\n')
+        f.write(f"extern const image_t {name};\n")
+
+    with open(args.output_c, "w") as f:
+        f.write(f"// Generated by tools/imgc.py from {source}. Do not edit.\n")
+        f.write(f"// {image.width}x{image.height}, {args.dither} dither, {args.layout} layout, ")
+        f.write(f"{'compressed to ' if args.compress else ''}{len(data)} bytes.\n")
+        f.write(f'#include "{os.path.basename(args.output_h)}"\n\n')
+        f.write(f"static const uint8_t __attribute__((aligned(4))) {name}_data[] = {{\n")
+        f.write(format_values(data, "0x{:02x}", 12))
+        f.write("\n};\n\n")
+        f.write(f"const image_t {name} = {{\n")
+        f.write(f"    .width = {image.width},\n")
+        f.write(f"    .height = {image.height},\n")
+        f.write(f"    .stride = {stride},\n")
+        f.write(f"    .byte_oriented = {'true' if args.layout == 'byte' else 'false'},\n")
+        f.write(f"    .compressed = {'true' if args.compress else 'false'},\n")
+        f.write(f"    .data = {name}_data,\n")
+        f.write(f"    .size = {len(data)},\n")
+        f.write("};\n")
+
+
+if __name__ == "__main__":
+    main()
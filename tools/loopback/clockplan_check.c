@@ -0,0 +1,162 @@
+// Host-side check of playground/clockplan.c: searches the plans tvout_set_clock() asks for and
+// checks them against the PLL's limits, against a brute force search of every system clock and
+// against known answers. Exits non-zero on a mismatch.
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "clockplan.h"
+
+// System clock range and tolerances, as in playground/tvout.c.
+#define MIN_SYS_CLOCK_HZ 100000000
+#define MAX_SYS_CLOCK_HZ 133000000
+#define LINE_TIMING_TOLERANCE_PPM 100
+#define VIDEO_OUTPUT_TOLERANCE_PPM 10000
+#define COLOUR_TOLERANCE_PPM 100
+
+// Line timing clock and the 640 pixel modes' output clock, 640 * 2 dots over 40.96us.
+#define LINE_TIMING_HZ 31250000
+#define VIDEO_640_HZ 31250000
+
+// Sample clocks of the colour modes, four times the subcarrier.
+#define PAL_SAMPLE_HZ 17734475
+#define NTSC_SAMPLE_HZ 14318182
+
+static unsigned failures;
+
+static void fail(const char *name, const char *what) {
+  printf("%s: %s\n", name, what);
+  failures++;
+}
+
+// Worst error of the targets at sys_hz relative to their tolerances, in thousandths, or UINT32_MAX
+// if a divider is out of range.
+static uint32_t badness(const clockplan_target_t *targets, unsigned count, uint32_t sys_hz) {
+  uint32_t worst = 0;
+  for (unsigned i = 0; i < count; i++) {
+    uint32_t divider = (sys_hz + (targets[i].hz / 2)) / targets[i].hz;
+    if ((divider < 1) || (divider > 65535)) {
+      return UINT32_MAX;
+    }
+    int32_t error_ppm = clockplan_error_ppm(sys_hz, divider << 8, targets[i].hz);
+    uint32_t b = (uint32_t)(((uint64_t)abs(error_ppm) * 1000) / targets[i].tolerance_ppm);
+    worst = (b > worst) ? b : worst;
+  }
+  return worst;
+}
+
+// Brute force: the fastest of the system clocks with the least badness which PLL_SYS makes from
+// the 12MHz crystal, a VCO of 756 to 1596MHz, the multiples of 12MHz from 750 to 1600, and post
+// dividers of 1 to 7, in whole Hz.
+static uint32_t best_sys_hz(const clockplan_target_t *targets, unsigned count) {
+  uint32_t best = UINT32_MAX, best_hz = 0;
+  for (uint32_t fbdiv = 63; fbdiv <= 133; fbdiv++) {
+    uint32_t vco_hz = 12000000 * fbdiv;
+    for (uint32_t post = 1; post <= 49; post++) {
+      uint32_t sys_hz = vco_hz / post;
+      bool makeable = false;
+      for (uint32_t postdiv1 = 1; postdiv1 <= 7; postdiv1++) {
+        makeable |= (post % postdiv1 == 0) && (post / postdiv1 <= postdiv1);
+      }
+      if (!makeable || (vco_hz % post != 0) || (sys_hz < MIN_SYS_CLOCK_HZ) ||
+          (sys_hz > MAX_SYS_CLOCK_HZ)) {
+        continue;
+      }
+      uint32_t b = badness(targets, count, sys_hz);
+      if ((b != UINT32_MAX) && ((b < best) || ((b == best) && (sys_hz > best_hz)))) {
+        best = b;
+        best_hz = sys_hz;
+      }
+    }
+  }
+  return best_hz;
+}
+
+// Search for a plan and check that it's one PLL_SYS can make, that no other system clock does
+// better and that the errors match the dividers. Returns false if there is no plan.
+static bool search(const char *name, const clockplan_target_t *targets, unsigned count,
+                   clockplan_t *plan) {
+  if (!clockplan_search(targets, count, MIN_SYS_CLOCK_HZ, MAX_SYS_CLOCK_HZ, plan)) {
+    fail(name, "no plan");
+    return false;
+  }
+  printf("%s: sys_clk %luHz, VCO %luHz / %u / %u\n", name, (unsigned long)plan->sys_hz,
+         (unsigned long)plan->vco_hz, plan->postdiv1, plan->postdiv2);
+  if ((plan->vco_hz < 750000000) || (plan->vco_hz > 1600000000) || (plan->vco_hz % 12000000)) {
+    fail(name, "VCO out of range or not a multiple of the crystal");
+  }
+  if ((plan->postdiv1 < 1) || (plan->postdiv1 > 7) || (plan->postdiv2 < 1) ||
+      (plan->postdiv2 > plan->postdiv1)) {
+    fail(name, "bad post dividers");
+  }
+  if (plan->vco_hz != plan->sys_hz * plan->postdiv1 * plan->postdiv2) {
+    fail(name, "system clock isn't the VCO over the post dividers");
+  }
+  if ((plan->sys_hz < MIN_SYS_CLOCK_HZ) || (plan->sys_hz > MAX_SYS_CLOCK_HZ)) {
+    fail(name, "system clock out of range");
+  }
+  if (plan->sys_hz != best_sys_hz(targets, count)) {
+    fail(name, "not the best system clock");
+  }
+  for (unsigned i = 0; i < count; i++) {
+    printf("  target %luHz: divider %u, %+ldppm\n", (unsigned long)targets[i].hz,
+           plan->divider[i], (long)plan->error_ppm[i]);
+    if (plan->error_ppm[i] !=
+        clockplan_error_ppm(plan->sys_hz, (uint32_t)plan->divider[i] << 8, targets[i].hz)) {
+      fail(name, "reported error doesn't match the divider");
+    }
+  }
+  return true;
+}
+
+int main(void) {
+  clockplan_t plan;
+
+  // The 640 pixel modes are exact at the default 125MHz, dividing both clocks by 4.
+  clockplan_target_t mono[] = {
+      {LINE_TIMING_HZ, LINE_TIMING_TOLERANCE_PPM},
+      {VIDEO_640_HZ, VIDEO_OUTPUT_TOLERANCE_PPM},
+  };
+  if (search("640x256", mono, 2, &plan)) {
+    if ((plan.sys_hz != 125000000) || (plan.divider[0] != 4) || (plan.divider[1] != 4) ||
+        (plan.error_ppm[0] != 0) || (plan.error_ppm[1] != 0)) {
+      fail("640x256", "expected 125MHz with dividers 4 and 4 and no error");
+    }
+  }
+
+  // The colour modes run both state machines at the sample clock. PAL's is within tolerance at
+  // 106.4MHz, 6 times the sample clock. No clock the crystal makes comes that close for NTSC, so
+  // its plan is only checked against the brute force search.
+  clockplan_target_t pal[] = {
+      {PAL_SAMPLE_HZ, COLOUR_TOLERANCE_PPM},
+      {PAL_SAMPLE_HZ, COLOUR_TOLERANCE_PPM},
+  };
+  if (search("PAL colour", pal, 2, &plan)) {
+    for (unsigned i = 0; i < 2; i++) {
+      if ((uint32_t)abs(plan.error_ppm[i]) > COLOUR_TOLERANCE_PPM) {
+        fail("PAL colour", "sample clock out of tolerance");
+      }
+    }
+  }
+  clockplan_target_t ntsc[] = {
+      {NTSC_SAMPLE_HZ, COLOUR_TOLERANCE_PPM},
+      {NTSC_SAMPLE_HZ, COLOUR_TOLERANCE_PPM},
+  };
+  search("NTSC colour", ntsc, 2, &plan);
+
+  // Ties go to the faster system clock: every clock in range divides 1MHz exactly, so the fastest
+  // whole number of MHz the PLL makes wins.
+  clockplan_target_t tie[] = {{1000000, 1}};
+  if (search("1MHz", tie, 1, &plan) && (plan.sys_hz != 133000000)) {
+    fail("1MHz", "tie not broken towards the faster clock");
+  }
+
+  // A target which needs a divider above 65535 has no plan.
+  clockplan_target_t slow[] = {{1000, 1000}};
+  if (clockplan_search(slow, 1, MIN_SYS_CLOCK_HZ, MAX_SYS_CLOCK_HZ, &plan)) {
+    fail("1kHz", "found a plan with a divider out of range");
+  }
+
+  printf("%s\n", failures ? "FAILED" : "ok");
+  return failures ? 1 : 0;
+}
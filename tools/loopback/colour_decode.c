@@ -0,0 +1,102 @@
+// Host-side check of playground/colour.c: demodulates the sample patterns from colour_encode() the
+// way a TV would and checks the burst phase and the luma and colour differences of every palette
+// entry, for PAL and NTSC, both PAL V switch states and every starting phase. Exits non-zero on a
+// mismatch.
+
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include "colour.h"
+
+#define DAC_BITS 8
+
+// Largest error allowed in a demodulated level, a little over one DAC step of the 8 bit DAC.
+#define TOLERANCE 0.01
+
+// Largest error allowed in the burst's phase, in degrees.
+#define BURST_TOLERANCE 1.0
+
+static unsigned failures;
+
+// The four samples of a pattern word in the order they reach the DAC. The output program shifts
+// each word out MSB first and DMA doesn't swap bytes in the colour modes, so the first sample is
+// the most significant byte.
+static void samples(uint32_t word, unsigned out[COLOUR_PHASES]) {
+  for (unsigned i = 0; i < COLOUR_PHASES; i++) {
+    out[i] = (word >> (24 - (8 * i))) & 0xff;
+  }
+}
+
+// Demodulate one subcarrier cycle starting at phase, in quarter cycles, into luma and colour
+// differences. The subcarrier is sin for U and cos for V, so with four samples a cycle each colour
+// difference is the mean of the samples times the subcarrier, doubled.
+static void demodulate(uint32_t word, unsigned phase, double *y, double *u, double *v) {
+  static const double sin_table[COLOUR_PHASES] = {0, 1, 0, -1};
+  static const double cos_table[COLOUR_PHASES] = {1, 0, -1, 0};
+  double full_scale = (1u << DAC_BITS) - 1;
+  unsigned s[COLOUR_PHASES];
+  samples(word, s);
+  *y = *u = *v = 0;
+  for (unsigned i = 0; i < COLOUR_PHASES; i++) {
+    double level = ((s[i] / full_scale) - 0.2) / 0.6;
+    unsigned p = (phase + i) % COLOUR_PHASES;
+    *y += level / COLOUR_PHASES;
+    *u += (2.0 / COLOUR_PHASES) * level * sin_table[p];
+    *v += (2.0 / COLOUR_PHASES) * level * cos_table[p];
+  }
+}
+
+static void check(const char *what, unsigned index, double got, double expected, double tolerance) {
+  if (fabs(got - expected) > tolerance) {
+    printf("%s %u: got %.4f, expected %.4f\n", what, index, got, expected);
+    failures++;
+  }
+}
+
+static void check_standard(colour_standard_t standard, const char *name) {
+  colour_patterns_t patterns;
+  colour_encode(standard, DAC_BITS, colour_default_palette, &patterns);
+  unsigned v_switches = (standard == COLOUR_PAL) ? 2 : 1;
+
+  for (unsigned v_switch = 0; v_switch < v_switches; v_switch++) {
+    // PAL's burst is at +135 degrees and, with the V switch, -135. NTSC's is at 180.
+    double burst_degrees = (standard == COLOUR_PAL) ? (v_switch ? -135 : 135) : 180;
+    for (unsigned phase = 0; phase < COLOUR_PHASES; phase++) {
+      double y, u, v;
+      demodulate(patterns.burst[v_switch][phase], phase, &y, &u, &v);
+      double degrees = atan2(v, u) * (180 / M_PI);
+      double error = fmod(degrees - burst_degrees + 540, 360) - 180;
+      check("burst luma, phase", phase, y, 0, TOLERANCE);
+      check("burst phase error, phase", phase, error, 0, BURST_TOLERANCE);
+
+      for (unsigned i = 0; i < COLOUR_PALETTE_SIZE; i++) {
+        uint32_t rgb = colour_default_palette[i];
+        double r = ((rgb >> 16) & 0xff) / 255.0;
+        double g = ((rgb >> 8) & 0xff) / 255.0;
+        double b = (rgb & 0xff) / 255.0;
+        double expected_y = (0.299 * r) + (0.587 * g) + (0.114 * b);
+        double expected_u = 0.493 * (b - expected_y);
+        double expected_v = ((standard == COLOUR_PAL) && v_switch ? -1 : 1) * 0.877 *
+                            (r - expected_y);
+        demodulate(patterns.pixel[v_switch][phase][i], phase, &y, &u, &v);
+        check("Y of colour", i, y, expected_y, TOLERANCE);
+        check("U of colour", i, u, expected_u, TOLERANCE);
+        check("V of colour", i, v, expected_v, TOLERANCE);
+      }
+    }
+  }
+
+  unsigned s[COLOUR_PHASES];
+  samples(patterns.blank, s);
+  for (unsigned i = 0; i < COLOUR_PHASES; i++) {
+    check("blank sample", i, s[i], s[0], 0);
+  }
+  printf("%s: %s\n", name, failures ? "FAILED" : "ok");
+}
+
+int main(void) {
+  check_standard(COLOUR_PAL, "PAL");
+  check_standard(COLOUR_NTSC, "NTSC");
+  return failures ? 1 : 0;
+}
@@ -0,0 +1,151 @@
+// Host-side check of sixel images in playground/console.c. With smooth scrolling, as in the
+// playground with PLAYGROUND_TEXT_LAYER, an image taller than the screen is drawn round the end of
+// the ring of text rows after the ring has filled with text. The rows above it must be left intact,
+// the rows beside it cleared and the screen must end up on the line below it. The same image
+// without smooth scrolling must scroll the frame buffer the same way. Exits non-zero on a mismatch.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "console.h"
+#include "font_8x8.h"
+
+// The playground's 640x256 screen and text layer ring.
+#define WIDTH 640
+#define HEIGHT 256
+#define STRIDE (WIDTH / 8)
+#define SPARE_ROWS 32
+#define RING_HEIGHT (HEIGHT + SPARE_ROWS)
+#define ROWS (RING_HEIGHT / 8)
+
+// A white image IMAGE_WIDTH pixels wide and IMAGE_ROWS text rows high.
+#define IMAGE_WIDTH 16
+#define IMAGE_ROWS 33
+
+static uint8_t frame_buffer[RING_HEIGHT * STRIDE];
+static uint origin;
+static unsigned failures;
+
+static void set_origin(uint row) { origin = row; }
+
+static void fail(const char *name, const char *what, uint row) {
+  printf("%s: %s, text row %u\n", name, what, row);
+  failures++;
+}
+
+static unsigned pixel(uint y, uint x) {
+  return (frame_buffer[(y * STRIDE) + (x >> 3)] >> (7 - (x & 7))) & 1;
+}
+
+// Check that text row row, of a frame buffer of rows text rows, shows s and nothing else.
+static void check_text(const char *name, uint rows, uint row, const char *s) {
+  row %= rows;
+  for (uint y = 0; y < 8; y++) {
+    const uint8_t *line = &frame_buffer[((row * 8) + y) * STRIDE];
+    for (uint col = 0; col < STRIDE; col++) {
+      uint8_t expected = (col < strlen(s)) ? font_ascii_rows(&font_8x8, s[col])[y] : 0;
+      if (line[col] != expected) {
+        fail(name, "text row doesn't match", row);
+        return;
+      }
+    }
+  }
+}
+
+// Check that text row row shows the image, and is clear beside it.
+static void check_image(const char *name, uint rows, uint row) {
+  row %= rows;
+  for (uint y = row * 8; y < (row + 1) * 8; y++) {
+    for (uint x = 0; x < WIDTH; x++) {
+      if (pixel(y, x) != (x < IMAGE_WIDTH)) {
+        fail(name, (x < IMAGE_WIDTH) ? "image not drawn" : "row beside the image not clear", row);
+        return;
+      }
+    }
+  }
+}
+
+static void write_string(const char *s) { console_write(s, strlen(s)); }
+
+// Write a white image, with raster attributes, in bands of six rows.
+static void write_image(void) {
+  char s[64];
+  snprintf(s, sizeof(s), "\x1bPq\"1;1;%u;%u#1;2;100;100;100#1", IMAGE_WIDTH, IMAGE_ROWS * 8);
+  write_string(s);
+  for (uint band = 0; band < (IMAGE_ROWS * 8) / 6; band++) {
+    snprintf(s, sizeof(s), "%s!%u~", band ? "-" : "", IMAGE_WIDTH);
+    write_string(s);
+  }
+  write_string("\x1b\\END");
+}
+
+static void check_smooth(void) {
+  const char *name = "smooth scroll";
+  console_init(&font_8x8, frame_buffer, WIDTH, RING_HEIGHT, STRIDE);
+  console_set_cursor_enabled(false);
+  console_set_sixel_dither(false);
+  if (!console_set_smooth_scroll(HEIGHT, set_origin)) {
+    fail(name, "not enabled", 0);
+    return;
+  }
+
+  // Fill the ring with text and leave the cursor near its end, so that the image wraps round it.
+  char s[32];
+  for (uint line = 0; line < (2 * ROWS) - 8; line++) {
+    snprintf(s, sizeof(s), "stale text %u\r\n", line);
+    write_string(s);
+  }
+  write_string("above A\r\nabove B\r\n");
+  write_image();
+
+  // Let the scrolling catch up.
+  console_scroll_stats_t stats;
+  for (uint field = 0; field < 1000; field++) {
+    console_refresh();
+  }
+  console_get_scroll_stats(&stats);
+  if ((stats.backlog != 0) || (origin % 8 != 0)) {
+    fail(name, "scrolling didn't catch up", origin / 8);
+    return;
+  }
+
+  // The screen's last row is the one below the image, and above the image are the rows written
+  // before it, still in the ring although scrolled off the screen.
+  uint end_row = (origin / 8) + (HEIGHT / 8) - 1;
+  check_text(name, ROWS, end_row, "END");
+  for (uint row = 1; row <= IMAGE_ROWS; row++) {
+    check_image(name, ROWS, end_row + ROWS - row);
+  }
+  check_text(name, ROWS, end_row + ROWS - IMAGE_ROWS - 1, "above B");
+  check_text(name, ROWS, end_row + ROWS - IMAGE_ROWS - 2, "above A");
+  printf("%s: image ends on ring row %u of %u\n", name, (end_row + ROWS - 1) % ROWS, ROWS);
+}
+
+static void check_flat(void) {
+  const char *name = "no smooth scroll";
+  uint rows = HEIGHT / 8;
+  console_init(&font_8x8, frame_buffer, WIDTH, HEIGHT, STRIDE);
+  console_set_cursor_enabled(false);
+  console_set_sixel_dither(false);
+
+  char s[32];
+  for (uint line = 0; line < 2 * rows; line++) {
+    snprintf(s, sizeof(s), "stale text %u\r\n", line);
+    write_string(s);
+  }
+  write_string("above A\r\nabove B\r\n");
+  write_image();
+
+  // An image taller than the screen scrolls everything above it, and its own top, off.
+  check_text(name, rows, rows - 1, "END");
+  for (uint row = 1; row < rows; row++) {
+    check_image(name, rows, rows - 1 - row);
+  }
+}
+
+int main(void) {
+  check_smooth();
+  check_flat();
+  printf("%s\n", failures ? "FAILED" : "ok");
+  return failures ? 1 : 0;
+}
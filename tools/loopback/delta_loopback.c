@@ -0,0 +1,90 @@
+// Host-side stand-in for the device end of frame streaming. Reads deltas from stdin, each preceded
+// by its length as a little-endian u32, and decodes them exactly as playground/stream.c does: into
+// a back buffer which is then flipped and brought up to date with the front. Each frame is written
+// to stdout once it has been flipped. The deltas are fed to the decoder in chunks of random size to
+// exercise runs which are split between STREAM_DATA commands.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "delta.h"
+
+#define FRAME_SIZE (640 / 8 * 256)
+
+// Largest STREAM_DATA payload, as in tools/remote.py.
+#define MAX_CHUNK 4092
+
+static uint8_t buffers[2][FRAME_SIZE];
+
+static double now_us(void) {
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * 1e6 + ts.tv_nsec / 1e3;
+}
+
+int main(void) {
+  uint8_t *data = NULL;
+  size_t data_size = 0;
+  unsigned front = 0;
+  unsigned frames = 0;
+  double decode_us = 0, max_decode_us = 0;
+  delta_decoder_t decoder;
+
+  srand(1);
+  delta_decoder_init(&decoder, buffers[1], FRAME_SIZE);
+
+  uint8_t header[4];
+  while (fread(header, 1, sizeof(header), stdin) == sizeof(header)) {
+    size_t n = header[0] | header[1] << 8 | header[2] << 16 | (size_t)header[3] << 24;
+    if (n > data_size) {
+      data = realloc(data, n);
+      if (data == NULL) {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+      }
+      data_size = n;
+    }
+    if (fread(data, 1, n, stdin) != n) {
+      fprintf(stderr, "frame %u: truncated\n", frames);
+      return 1;
+    }
+
+    double start = now_us();
+    for (size_t i = 0; i < n;) {
+      size_t chunk = 1 + rand() % MAX_CHUNK;
+      if (chunk > n - i) {
+        chunk = n - i;
+      }
+      if (delta_decode(&decoder, data + i, chunk) != chunk) {
+        fprintf(stderr, "frame %u: delta runs past the end of the frame\n", frames);
+        return 1;
+      }
+      i += chunk;
+    }
+    double elapsed = now_us() - start;
+    decode_us += elapsed;
+    if (elapsed > max_decode_us) {
+      max_decode_us = elapsed;
+    }
+
+    if (!delta_decoder_idle(&decoder)) {
+      fprintf(stderr, "frame %u: delta ends part way through a run\n", frames);
+      return 1;
+    }
+    front ^= 1;
+    fwrite(buffers[front], 1, FRAME_SIZE, stdout);
+    memcpy(buffers[front ^ 1], buffers[front], FRAME_SIZE);
+    delta_decoder_init(&decoder, buffers[front ^ 1], FRAME_SIZE);
+    frames++;
+  }
+
+  if (frames > 0) {
+    fprintf(stderr, "%u frames, decode %.1f us/frame average, %.1f us maximum\n", frames,
+            decode_us / frames, max_decode_us);
+  }
+  free(data);
+  return 0;
+}
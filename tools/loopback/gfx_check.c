@@ -0,0 +1,181 @@
+// Host-side check of playground/gfx.c: draws random lines into a small surface and compares the
+// pixels with the same lines drawn unclipped into a large one, checks that lines with far away end
+// points stay inside the surface, and compares random blits, overlapping or between surfaces of
+// either orientation, with a pixel by pixel copy. Exits non-zero on a mismatch.
+
+#include <stdio.h>
+#include <string.h>
+
+#include "gfx.h"
+
+#define LINES 20000
+#define BLITS 20000
+
+// Small surface, and a large one holding it at an offset, big enough that none of the lines drawn
+// into it need clipping.
+#define SMALL_WIDTH 64
+#define SMALL_HEIGHT 48
+#define LARGE_SIZE 1792
+#define LARGE_OFFSET 600
+
+// Words of guard either side of the small surface, which must stay clear.
+#define GUARD_WORDS 64
+
+#define SMALL_WORDS (SMALL_WIDTH * SMALL_HEIGHT / 32)
+
+static uint32_t small_words[GUARD_WORDS + SMALL_WORDS + GUARD_WORDS];
+static uint32_t large_words[LARGE_SIZE * LARGE_SIZE / 32];
+static uint32_t blit_words[2][SMALL_WORDS], expected_words[SMALL_WORDS];
+static uint32_t seed = 1;
+static unsigned failures;
+
+// Uniform in lo <= n <= hi.
+static int random_int(int lo, int hi) {
+  seed = (seed * 1103515245) + 12345;
+  return lo + (int)((seed >> 8) % (uint32_t)(hi - lo + 1));
+}
+
+static unsigned get_pixel(const gfx_surface_t *surface, int x, int y) {
+  const uint8_t *row = (const uint8_t *)surface->buffer + (y * surface->stride);
+  return (row[(x >> 3) ^ (surface->byte_oriented ? 0 : 3)] >> (7 - (x & 7))) & 1;
+}
+
+static void put_pixel(const gfx_surface_t *surface, int x, int y, unsigned v) {
+  uint8_t *p = (uint8_t *)surface->buffer + (y * surface->stride) +
+               ((x >> 3) ^ (surface->byte_oriented ? 0 : 3));
+  uint8_t mask = 0x80 >> (x & 7);
+  *p = v ? (*p | mask) : (*p & ~mask);
+}
+
+static void fail(const char *what, int a, int b, int c, int d) {
+  if (failures++ < 10) {
+    printf("%s: %d, %d, %d, %d\n", what, a, b, c, d);
+  }
+}
+
+static void check_lines(void) {
+  gfx_surface_t small, large;
+  gfx_surface_init(&small, small_words + GUARD_WORDS, SMALL_WIDTH, SMALL_HEIGHT, SMALL_WIDTH / 8,
+                   false);
+  gfx_surface_init(&large, large_words, LARGE_SIZE, LARGE_SIZE, LARGE_SIZE / 8, true);
+
+  unsigned visible = 0;
+  for (unsigned n = 0; n < LINES; n++) {
+    int x0, y0, x1, y1;
+    if (n % 4 == 0) {
+      // Wholly on the surface.
+      x0 = random_int(0, SMALL_WIDTH - 1), y0 = random_int(0, SMALL_HEIGHT - 1);
+      x1 = random_int(0, SMALL_WIDTH - 1), y1 = random_int(0, SMALL_HEIGHT - 1);
+    } else {
+      x0 = random_int(-470, 530), y0 = random_int(-470, 530);
+      if (n % 4 == 1) {
+        x1 = x0 + random_int(-20, 20), y1 = y0 + random_int(-20, 20);
+      } else {
+        x1 = random_int(-470, 530), y1 = random_int(-470, 530);
+      }
+    }
+    gfx_fill_rect(&small, 0, 0, SMALL_WIDTH, SMALL_HEIGHT, GFX_PATTERN_BLACK, GFX_ROP_COPY);
+    gfx_fill_rect(&large, LARGE_OFFSET - 32, LARGE_OFFSET - 32, SMALL_WIDTH + 64,
+                  SMALL_HEIGHT + 64, GFX_PATTERN_BLACK, GFX_ROP_COPY);
+    gfx_line(&small, x0, y0, x1, y1, 1, GFX_ROP_COPY);
+    gfx_line(&large, x0 + LARGE_OFFSET, y0 + LARGE_OFFSET, x1 + LARGE_OFFSET, y1 + LARGE_OFFSET,
+             1, GFX_ROP_COPY);
+    bool differ = false, any = false;
+    for (int y = 0; y < SMALL_HEIGHT; y++) {
+      for (int x = 0; x < SMALL_WIDTH; x++) {
+        unsigned expected = get_pixel(&large, x + LARGE_OFFSET, y + LARGE_OFFSET);
+        differ |= get_pixel(&small, x, y) != expected;
+        any |= expected;
+      }
+    }
+    visible += any;
+    if (differ) {
+      fail("line differs", x0, y0, x1, y1);
+    }
+  }
+  printf("lines: %u drawn, %u visible\n", LINES, visible);
+
+  // Lines with end points anywhere, which are clamped before clipping.
+  static const int far[] = {INT32_MIN + 1, -1000000, -40000, -32768, 32768, 40000, 1000000,
+                            INT32_MAX};
+  unsigned far_count = sizeof(far) / sizeof(far[0]);
+  for (unsigned n = 0; n < LINES; n++) {
+    int x0 = random_int(-100, 100), y0 = random_int(-100, 100);
+    int x1 = far[random_int(0, far_count - 1)], y1 = far[random_int(0, far_count - 1)];
+    if (n & 1) {
+      y1 = random_int(-100, 100);
+    }
+    gfx_line(&small, x0, y0, x1, y1, 1, GFX_ROP_XOR);
+  }
+  for (unsigned i = 0; i < GUARD_WORDS; i++) {
+    if (small_words[i] || small_words[GUARD_WORDS + SMALL_WORDS + i]) {
+      fail("line drawn outside the surface", i, 0, 0, 0);
+    }
+  }
+}
+
+static void check_blits(void) {
+  static const gfx_rop_t rops[] = {GFX_ROP_COPY, GFX_ROP_OR, GFX_ROP_AND, GFX_ROP_XOR};
+  static uint8_t source[SMALL_HEIGHT][SMALL_WIDTH];
+  gfx_surface_t surfaces[2][2], expected;
+
+  for (unsigned n = 0; n < BLITS; n++) {
+    // Destination, and source which is either the same surface or one of either orientation.
+    bool dest_bytes = random_int(0, 1), src_bytes = random_int(0, 1), shared = random_int(0, 1);
+    for (unsigned b = 0; b < 2; b++) {
+      gfx_surface_init(&surfaces[0][b], blit_words[0], SMALL_WIDTH, SMALL_HEIGHT,
+                       SMALL_WIDTH / 8, b);
+      gfx_surface_init(&surfaces[1][b], blit_words[1], SMALL_WIDTH, SMALL_HEIGHT,
+                       SMALL_WIDTH / 8, b);
+    }
+    const gfx_surface_t *dest = &surfaces[0][dest_bytes];
+    const gfx_surface_t *src = shared ? dest : &surfaces[1][src_bytes];
+    gfx_surface_init(&expected, expected_words, SMALL_WIDTH, SMALL_HEIGHT, SMALL_WIDTH / 8,
+                     dest->byte_oriented);
+    for (unsigned i = 0; i < SMALL_WORDS; i++) {
+      blit_words[0][i] = (uint32_t)random_int(0, 0xffff) << 16 | (uint32_t)random_int(0, 0xffff);
+      blit_words[1][i] = (uint32_t)random_int(0, 0xffff) << 16 | (uint32_t)random_int(0, 0xffff);
+    }
+
+    int dx = random_int(-40, 80), dy = random_int(-30, 60);
+    int sx = random_int(-40, 80), sy = random_int(-30, 60);
+    int w = random_int(0, 90), h = random_int(0, 60);
+    gfx_rop_t rop = rops[random_int(0, 3)];
+
+    // Pixel by pixel, reading the whole source first so that overlap doesn't matter.
+    memcpy(expected_words, dest->buffer, sizeof(expected_words));
+    for (int y = 0; y < SMALL_HEIGHT; y++) {
+      for (int x = 0; x < SMALL_WIDTH; x++) {
+        source[y][x] = get_pixel(src, x, y);
+      }
+    }
+    for (int y = 0; y < h; y++) {
+      for (int x = 0; x < w; x++) {
+        int tx = dx + x, ty = dy + y, fx = sx + x, fy = sy + y;
+        if ((tx < 0) || (ty < 0) || (tx >= SMALL_WIDTH) || (ty >= SMALL_HEIGHT) || (fx < 0) ||
+            (fy < 0) || (fx >= SMALL_WIDTH) || (fy >= SMALL_HEIGHT)) {
+          continue;
+        }
+        unsigned s = source[fy][fx], d = get_pixel(&expected, tx, ty);
+        unsigned v = (rop == GFX_ROP_COPY) ? s
+                     : (rop == GFX_ROP_OR) ? (d | s)
+                     : (rop == GFX_ROP_AND) ? (d & s)
+                                            : (d ^ s);
+        put_pixel(&expected, tx, ty, v);
+      }
+    }
+
+    gfx_blit(dest, dx, dy, src, sx, sy, w, h, rop);
+    if (memcmp(expected_words, dest->buffer, sizeof(expected_words))) {
+      fail("blit differs", dx, dy, sx, sy);
+    }
+  }
+  printf("blits: %u\n", BLITS);
+}
+
+int main(void) {
+  check_lines();
+  check_blits();
+  printf("%s\n", failures ? "FAILED" : "ok");
+  return failures ? 1 : 0;
+}
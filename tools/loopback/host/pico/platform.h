@@ -0,0 +1,4 @@
+#pragma once
+
+// Host stand-in for the Pico SDK header, with just what the playground sources built by the
+// loopback checks use. Build them with PLAYGROUND_HOT_IN_FLASH so that hotpath.h places nothing.
@@ -0,0 +1,16 @@
+#pragma once
+
+// Host stand-in for the Pico SDK header, with just what the playground sources built by the
+// loopback checks use.
+
+#include "pico/types.h"
+
+#define __force_inline inline __attribute__((always_inline))
+#define count_of(a) (sizeof(a) / sizeof((a)[0]))
+
+static inline void tight_loop_contents(void) {}
+
+#ifndef MIN
+#define MIN(a, b) ((b) < (a) ? (b) : (a))
+#define MAX(a, b) ((a) < (b) ? (b) : (a))
+#endif
@@ -0,0 +1,10 @@
+#pragma once
+
+// Host stand-in for the Pico SDK header, with just what the playground sources built by the
+// loopback checks use.
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef unsigned int uint;
@@ -0,0 +1,38 @@
+// Host-side rendering of tvout's test patterns, as scanout shows them, to a PBM on stdout, e.g. as
+// a reference for a capture of the video output. Usage: testpattern_pbm PATTERN [WIDTH HEIGHT],
+// where PATTERN is a testpattern_t number and the size defaults to 640x256.
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "testpattern.h"
+
+#define MAX_WIDTH 800
+
+int main(int argc, char **argv) {
+  if ((argc != 2) && (argc != 4)) {
+    fprintf(stderr, "usage: %s PATTERN [WIDTH HEIGHT]\n", argv[0]);
+    return 1;
+  }
+  testpattern_t pattern = (testpattern_t)atoi(argv[1]);
+  unsigned width = (argc == 4) ? (unsigned)atoi(argv[2]) : 640;
+  unsigned height = (argc == 4) ? (unsigned)atoi(argv[3]) : 256;
+  if ((pattern > TESTPATTERN_SAFE_AREA) || (width == 0) || (width > MAX_WIDTH) ||
+      ((width & 0x1f) != 0) || (height == 0)) {
+    fprintf(stderr, "bad pattern or size\n");
+    return 1;
+  }
+
+  static uint32_t rows[TESTPATTERN_ROWS * (MAX_WIDTH >> 5)];
+  testpattern_draw_rows(pattern, width, rows);
+  printf("P4\n%u %u\n", width, height);
+  for (unsigned y = 0; y < height; y++) {
+    const uint32_t *row = rows + (testpattern_row(pattern, height, y) * (width >> 5));
+    for (unsigned i = 0; i < (width >> 5); i++) {
+      uint8_t bytes[4] = {row[i] >> 24, row[i] >> 16, row[i] >> 8, row[i]};
+      fwrite(bytes, 1, sizeof(bytes), stdout);
+    }
+  }
+  return 0;
+}
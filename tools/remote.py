@@ -0,0 +1,253 @@
+#!/usr/bin/env python3
+"""
+Host-side client for the playground's binary drawing protocol. See playground/remote.h.
+
+Usage:
+
+    remote.py [--baud BAUD] DEVICE ping
+    remote.py [--baud BAUD] DEVICE demo
+    remote.py [--baud BAUD] DEVICE pattern NAME
+
+The Remote class may also be imported to drive the display from other scripts:
+
+    with Remote.open("/dev/ttyACM0") as remote:
+        remote.fill_spans(0, 640, 0, 256, 0)
+        remote.upload_tile(10, 10, 16, 16, rows)
+        remote.execute(wait_for_vblank=True)
+"""
+import argparse
+import os
+import struct
+import termios
+import tty
+
+ENTRY_SEQUENCE = b"\x1b_B\x1b\\"
+FRAME_SYNC = 0xA5
+REPLY_SYNC = 0x5A
+BATCH_SIZE = 4096
+
+FILL_SPANS = 0x01
+BLIT = 0x02
+SCROLL_RECT = 0x03
+UPLOAD_TILE = 0x04
+EXECUTE = 0x10
+EXIT = 0x11
+PING = 0x12
+STREAM_BEGIN = 0x20
+STREAM_DATA = 0x21
+STREAM_END = 0x22
+STREAM_STOP = 0x23
+STREAM_STATS = 0x24
+TEST_PATTERN = 0x30
+
+ROP_COPY, ROP_OR, ROP_AND, ROP_XOR = range(4)
+
+# Test patterns in the order of tvout_pattern_t. "none" shows the frame buffer again.
+PATTERNS = ("none", "grid", "crosshatch", "checkerboard", "bars", "safe-area")
+
+STATUS_NAMES = {
+    0: "ok",
+    1: "bad checksum",
+    2: "bad command",
+    3: "bad length",
+    4: "full",
+    5: "no memory",
+    6: "bad data",
+}
+
+# Largest STREAM_DATA payload, which fits only in an empty batch. See Remote.stream_frame().
+MAX_STREAM_CHUNK = BATCH_SIZE - 4
+
+
+class RemoteError(Exception):
+    pass
+
+
+def fletcher16(data):
+    sum1 = sum2 = 0
+    for b in data:
+        sum1 = (sum1 + b) % 255
+        sum2 = (sum2 + sum1) % 255
+    return sum1 | (sum2 << 8)
+
+
+def encode_frame(seq, command, payload=b""):
+    body = struct.pack("<BBH", seq, command, len(payload)) + payload
+    return bytes([FRAME_SYNC]) + body + struct.pack("<H", fletcher16(body))
+
+
+def pack_tile_rows(rows, w):
+    """Pack rows of 0/1 pixels, or of MSB-first bytes, into rows padded to four bytes."""
+    stride = ((w + 31) // 32) * 4
+    out = bytearray()
+    for row in rows:
+        if isinstance(row, (bytes, bytearray)):
+            data = bytes(row)
+        else:
+            bits = 0
+            for x in range(w):
+                bits |= (1 if row[x] else 0) << (stride * 8 - 1 - x)
+            data = bits.to_bytes(stride, "big")
+        out += data[:stride].ljust(stride, b"\0")
+    return bytes(out)
+
+
+class Remote:
+    """Queue commands, tracking batch usage so that EXECUTE is sent before the device refuses."""
+
+    def __init__(self, fd):
+        self.fd = fd
+        self.seq = 0
+        self.batch_used = 0
+        self.pending = []
+
+    @classmethod
+    def open(cls, device, baud=115200):
+        fd = os.open(device, os.O_RDWR | os.O_NOCTTY)
+        tty.setraw(fd)
+        attrs = termios.tcgetattr(fd)
+        speed = getattr(termios, f"B{baud}")
+        attrs[4] = attrs[5] = speed
+        termios.tcsetattr(fd, termios.TCSANOW, attrs)
+        remote = cls(fd)
+        os.write(fd, ENTRY_SEQUENCE)
+        return remote
+
+    def __enter__(self):
+        return self
+
+    def __exit__(self, *exc):
+        self.exit()
+        os.close(self.fd)
+
+    def _read_exact(self, n):
+        data = b""
+        while len(data) < n:
+            chunk = os.read(self.fd, n - len(data))
+            if not chunk:
+                raise RemoteError("connection closed")
+            data += chunk
+        return data
+
+    def _read_reply(self):
+        while self._read_exact(1)[0] != REPLY_SYNC:
+            pass
+        seq, status = self._read_exact(2)
+        return seq, status
+
+    def _check_replies(self):
+        for seq in self.pending:
+            reply_seq, status = self._read_reply()
+            if reply_seq != seq or status != 0:
+                raise RemoteError(f"frame {seq}: {STATUS_NAMES.get(status, status)}")
+        self.pending = []
+
+    def _send(self, command, payload=b"", wait=False):
+        seq = self.seq
+        self.seq = (self.seq + 1) & 0xFF
+        os.write(self.fd, encode_frame(seq, command, payload))
+        self.pending.append(seq)
+        if wait:
+            self._check_replies()
+
+    def _queue(self, command, payload):
+        size = 4 + ((len(payload) + 3) & ~3)
+        if size > BATCH_SIZE:
+            raise RemoteError("command too large for the batch")
+        if self.batch_used + size > BATCH_SIZE:
+            self.execute()
+        self._send(command, payload)
+        self.batch_used += size
+
+    def fill_spans(self, x0, x1, y, rows, pattern, rop=ROP_COPY):
+        self._queue(FILL_SPANS, struct.pack("<HHHHIB", x0, x1, y, rows, pattern, rop))
+
+    def blit(self, sx, sy, dx, dy, w, h, rop=ROP_COPY):
+        self._queue(BLIT, struct.pack("<HHHHHHB", sx, sy, dx, dy, w, h, rop))
+
+    def scroll_rect(self, x, y, w, h, dx, dy, pattern=0):
+        self._queue(SCROLL_RECT, struct.pack("<HHHHhhI", x, y, w, h, dx, dy, pattern))
+
+    def upload_tile(self, x, y, w, h, rows, rop=ROP_COPY):
+        header = struct.pack("<HHHHBxxx", x, y, w, h, rop)
+        self._queue(UPLOAD_TILE, header + pack_tile_rows(rows, w))
+
+    def execute(self, wait_for_vblank=False):
+        self._send(EXECUTE, bytes([1 if wait_for_vblank else 0]), wait=True)
+        self.batch_used = 0
+
+    def ping(self):
+        self._send(PING, wait=True)
+
+    def stream_begin(self):
+        self._send(STREAM_BEGIN, wait=True)
+
+    def _stream_chunk_size(self):
+        """Largest STREAM_DATA payload which fits in the free part of the batch."""
+        return (BATCH_SIZE - self.batch_used - 4) & ~3
+
+    def stream_frame(self, delta):
+        """Send one frame's delta and wait until it is on screen.
+
+        The device receives stream data into the free part of its batch, so queued drawing is
+        executed first if it leaves too little room for the whole delta in one chunk.
+        """
+        if self.batch_used and self._stream_chunk_size() < len(delta):
+            self.execute()
+        chunk = self._stream_chunk_size()
+        for i in range(0, len(delta), chunk):
+            self._send(STREAM_DATA, delta[i : i + chunk])
+        self._send(STREAM_END, wait=True)
+
+    def stream_stop(self):
+        self._send(STREAM_STOP, wait=True)
+
+    def stream_stats(self):
+        """Return (frames, elapsed_us, decode_us, max_decode_us)."""
+        self._send(STREAM_STATS, wait=True)
+        return struct.unpack("<4I", self._read_exact(16))
+
+    def test_pattern(self, name):
+        self._send(TEST_PATTERN, bytes([PATTERNS.index(name)]), wait=True)
+
+    def exit(self):
+        self._send(EXIT, wait=True)
+        self.batch_used = 0
+
+
+def demo(remote):
+    width, height = 640, 256
+    remote.fill_spans(0, width, 0, height, 0)
+    for i in range(16):
+        remote.fill_spans(20 + i * 36, 20 + i * 36 + 32, 20, 64, 0xAAAAAAAA if i & 1 else 0xFFFFFFFF)
+    checker = [[(x // 4 + y // 4) & 1 for x in range(32)] for y in range(32)]
+    for i in range(8):
+        remote.upload_tile(40 + i * 70, 120, 32, 32, checker, ROP_XOR)
+    remote.execute(wait_for_vblank=True)
+    for _ in range(32):
+        remote.scroll_rect(0, 100, width, 80, 4, 0)
+        remote.execute(wait_for_vblank=True)
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Drive the playground's binary drawing protocol.")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("device")
+    parser.add_argument("action", choices=("ping", "demo", "pattern"))
+    parser.add_argument("pattern", nargs="?", choices=PATTERNS, help="test pattern to show")
+    args = parser.parse_args()
+    if (args.action == "pattern") != (args.pattern is not None):
+        parser.error("a pattern is needed with, and only with, the pattern action")
+
+    with Remote.open(args.device, args.baud) as remote:
+        if args.action == "ping":
+            remote.ping()
+            print("ok")
+        elif args.action == "pattern":
+            remote.test_pattern(args.pattern)
+        else:
+            demo(remote)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,138 @@
+#!/usr/bin/env python3
+"""
+Stream delta-coded frames to the playground. See playground/stream.h and playground/delta.h.
+
+Usage:
+
+    stream.py [--baud BAUD] [--frames N] DEVICE [FRAME.pbm ...]
+    stream.py --loopback BINARY [--frames N] [FRAME.pbm ...]
+
+Frames are 640x256 binary PBM files, played in order. Without any files a synthetic animation is
+streamed instead. Each frame is coded against the previous one and the decode time and frame rate
+reported by the device are printed at the end.
+
+With --loopback the deltas are piped through the host build of the decoder in tools/loopback
+instead of to a device and every decoded frame is checked against the original.
+"""
+import argparse
+import math
+import struct
+import subprocess
+import sys
+import time
+
+import delta
+from remote import Remote
+
+WIDTH, HEIGHT = 640, 256
+STRIDE = WIDTH // 8
+
+
+def read_pbm(path):
+    with open(path, "rb") as f:
+        data = f.read()
+    fields = []
+    i = 0
+    while len(fields) < 3:
+        while data[i : i + 1].isspace():
+            i += 1
+        if data[i : i + 1] == b"#":
+            i = data.index(b"\n", i)
+            continue
+        start = i
+        while not data[i : i + 1].isspace():
+            i += 1
+        fields.append(data[start:i])
+    if fields[0] != b"P4" or (int(fields[1]), int(fields[2])) != (WIDTH, HEIGHT):
+        raise ValueError(f"{path}: expected a {WIDTH}x{HEIGHT} binary PBM")
+    pixels = data[i + 1 : i + 1 + STRIDE * HEIGHT]
+    # PBM uses 1 for black.
+    return bytes(b ^ 0xFF for b in pixels)
+
+
+def synthetic_frames(count):
+    """A bouncing filled circle over a scrolling checkerboard band."""
+    for n in range(count):
+        frame = bytearray(STRIDE * HEIGHT)
+        band = bytes(0xF0 if ((x + n) // 4) & 1 else 0x0F for x in range(STRIDE))
+        inverse = bytes(b ^ 0xFF for b in band)
+        for y in range(112, 144):
+            frame[y * STRIDE : (y + 1) * STRIDE] = band if (y // 4) & 1 else inverse
+        cx = int(WIDTH / 2 + (WIDTH / 2 - 40) * math.sin(n * 0.05))
+        cy = int(HEIGHT / 2 + (HEIGHT / 2 - 40) * math.cos(n * 0.07))
+        for dy in range(-32, 33):
+            dx = int(math.sqrt(32 * 32 - dy * dy))
+            row = (cy + dy) * STRIDE
+            for x in range(max(cx - dx, 0), min(cx + dx, WIDTH)):
+                frame[row + x // 8] |= 0x80 >> (x & 7)
+        yield bytes(frame)
+
+
+def deltas(frames):
+    previous = bytes(STRIDE * HEIGHT)
+    for frame in frames:
+        yield frame, delta.encode(previous, frame)
+        previous = frame
+
+
+def stream_to_device(args, frames):
+    total = 0
+    start = time.monotonic()
+    with Remote.open(args.device, args.baud) as remote:
+        remote.stream_begin()
+        for _, d in deltas(frames):
+            remote.stream_frame(d)
+            total += len(d)
+        count, elapsed_us, decode_us, max_decode_us = remote.stream_stats()
+        remote.stream_stop()
+    wall = time.monotonic() - start
+
+    print(f"{count} frames, {total} bytes of delta, {total / max(count, 1):.0f} bytes/frame")
+    if count > 1:
+        print(f"device: {(count - 1) * 1e6 / elapsed_us:.2f} fps")
+    print(f"host: {count / wall:.2f} fps")
+    if count:
+        print(f"decode: {decode_us / count:.0f} us/frame average, {max_decode_us} us maximum")
+
+
+def stream_to_loopback(args, frames):
+    frames = list(frames)
+    encoded = [d for _, d in deltas(frames)]
+    records = b"".join(struct.pack("<I", len(d)) + d for d in encoded)
+    result = subprocess.run([args.loopback], input=records, stdout=subprocess.PIPE, check=True)
+
+    size = STRIDE * HEIGHT
+    if len(result.stdout) != size * len(frames):
+        sys.exit(f"loopback returned {len(result.stdout)} bytes, expected {size * len(frames)}")
+    for n, frame in enumerate(frames):
+        if result.stdout[n * size : (n + 1) * size] != frame:
+            sys.exit(f"frame {n} differs")
+    total = sum(len(d) for d in encoded)
+    per_frame = total / len(frames)
+    print(f"{len(frames)} frames match, {total} bytes of delta, {per_frame:.0f} bytes/frame")
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Stream delta-coded frames to the playground.")
+    parser.add_argument("--baud", type=int, default=115200)
+    parser.add_argument("--frames", type=int, default=200, help="length of the synthetic animation")
+    parser.add_argument("--loopback", metavar="BINARY", help="decode with a host build instead")
+    parser.add_argument("device", nargs="?")
+    parser.add_argument("files", nargs="*")
+    args = parser.parse_args()
+
+    if args.loopback is not None and args.device is not None:
+        args.files.insert(0, args.device)
+        args.device = None
+    if args.loopback is None and args.device is None:
+        parser.error("a device or --loopback is required")
+
+    frames = (read_pbm(f) for f in args.files) if args.files else synthetic_frames(args.frames)
+    if args.loopback:
+        stream_to_loopback(args, frames)
+    else:
+        stream_to_device(args, frames)
+
+
+if __name__ == "__main__":
+    main()